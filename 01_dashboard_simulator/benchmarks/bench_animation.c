@@ -0,0 +1,197 @@
+/**
+ * QNX Dashboard Simulator - Gauge Animation Benchmark
+ *
+ * Times one frame of gauge animation for 8 to 4096 dials, each given a new
+ * target every quarter second: the previous per-widget update (current +=
+ * (target - current) * 5 * dt while walking the widget nodes) against the
+ * gauge animator's batched step over its lane arrays, both writing the
+ * result back into the tree. Then sends one gauge from 0 to 100 at 30, 60
+ * and 144 Hz frames and reports where it is after 1/6 s (a whole number of
+ * frames at every rate) and when it settles: the animator's curves should
+ * read the same at every frame rate, the previous update does not.
+ *
+ * Usage: bench_animation [frames]
+ */
+
+#include "../include/gauge_animator.h"
+#include "../include/widget_tree.h"
+
+#define BENCH_RETARGET_FRAMES  15        /* New target per gauge, at 60 Hz */
+#define BENCH_CHECK_S          (1.0f / 6.0f)
+#define BENCH_MAX_FRAMES       (10 * 144)
+
+static const int GAUGE_COUNTS[] = {8, 64, 512, 4096};
+static const uint32_t FRAME_RATES[] = {30, 60, 144};
+
+#define GAUGE_COUNT_STEPS (sizeof(GAUGE_COUNTS) / sizeof(GAUGE_COUNTS[0]))
+#define FRAME_RATE_STEPS (sizeof(FRAME_RATES) / sizeof(FRAME_RATES[0]))
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* The update gui_manager_update() used to run for every moving gauge */
+static void legacy_animate(gauge_widget_t *gauge, float delta_time) {
+    float diff = gauge->target_value - gauge->current_value;
+    if (fabs(diff) > 0.1f) {
+        gauge->current_value += diff * 5.0f * delta_time;
+    } else {
+        gauge->current_value = gauge->target_value;
+    }
+}
+
+static int make_dials(widget_tree_t *tree, int count) {
+    widget_tree_init(tree);
+    for (int i = 0; i < count; i++) {
+        int index = widget_tree_add(tree, -1, WIDGET_DIAL, (framebuffer_rect_t){0, 0, 16, 16});
+        if (index < 0) return -1;
+        gauge_widget_t *gauge = &tree->nodes[index].data.gauge;
+        gauge->min_value = 0.0f;
+        gauge->max_value = 100.0f;
+        gauge->animation_speed = 1.0f;
+    }
+    widget_tree_finalize(tree);
+    return 0;
+}
+
+/* Staggered so a few gauges get new targets every frame */
+static void set_targets(widget_tree_t *tree, int frame) {
+    for (int i = 0; i < tree->count; i++) {
+        if ((frame + i) % BENCH_RETARGET_FRAMES == 0) {
+            tree->nodes[i].data.gauge.target_value = (float)((frame * 7 + i * 13) % 101);
+        }
+    }
+}
+
+/**
+ * Nanoseconds per gauge per frame, legacy or batched
+ */
+static double time_gauges(int count, int frames, bool batched, double *moving) {
+    widget_tree_t tree;
+    gauge_animator_t animator;
+    float dt = 1.0f / GUI_UPDATE_RATE_HZ;
+    uint64_t elapsed = 0, lanes = 0;
+
+    if (make_dials(&tree, count) != 0 ||
+        gauge_animator_init(&animator, ANIMATION_SPRING, ANIMATION_DEFAULT_DURATION_MS) != 0 ||
+        gauge_animator_reset(&animator, tree.count) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        exit(1);
+    }
+
+    for (int frame = 0; frame < frames; frame++) {
+        set_targets(&tree, frame);
+        uint64_t start = now_ns();
+        if (batched) {
+            for (int i = 0; i < tree.count; i++) {
+                gauge_widget_t *gauge = &tree.nodes[i].data.gauge;
+                gauge_animator_retarget(&animator, i, gauge->current_value, gauge->target_value,
+                                        gauge->max_value - gauge->min_value, gauge->animation_speed);
+            }
+            lanes += gauge_animator_step(&animator, dt, &tree);
+        } else {
+            for (int i = 0; i < tree.count; i++) {
+                legacy_animate(&tree.nodes[i].data.gauge, dt);
+            }
+        }
+        elapsed += now_ns() - start;
+    }
+
+    *moving = batched ? (double)lanes / frames : (double)count;
+    gauge_animator_free(&animator);
+    widget_tree_free(&tree);
+    return (double)elapsed / frames / count;
+}
+
+typedef struct {
+    float value_at_check;
+    float settle_ms;           /* < 0 if it never settles */
+} settle_result_t;
+
+/**
+ * One gauge from 0 to 100 at rate_hz; curve ANIMATION_CURVE_COUNT is the
+ * previous update
+ */
+static settle_result_t settle(animation_curve_t curve, uint32_t rate_hz) {
+    widget_tree_t tree;
+    gauge_animator_t animator;
+    settle_result_t result = {0.0f, -1.0f};
+    float dt = 1.0f / rate_hz;
+    int check_frame = (int)lroundf(BENCH_CHECK_S * rate_hz);
+
+    if (make_dials(&tree, 1) != 0 ||
+        gauge_animator_init(&animator, curve, ANIMATION_DEFAULT_DURATION_MS) != 0 ||
+        gauge_animator_reset(&animator, tree.count) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        exit(1);
+    }
+
+    gauge_widget_t *gauge = &tree.nodes[0].data.gauge;
+    gauge->target_value = 100.0f;
+    if (curve < ANIMATION_CURVE_COUNT) {
+        gauge_animator_retarget(&animator, 0, gauge->current_value, gauge->target_value,
+                                gauge->max_value - gauge->min_value, gauge->animation_speed);
+    }
+
+    for (int frame = 1; frame <= (int)(BENCH_MAX_FRAMES * rate_hz / 144); frame++) {
+        bool moving;
+        if (curve < ANIMATION_CURVE_COUNT) {
+            moving = gauge_animator_step(&animator, dt, &tree) > 0;
+        } else {
+            legacy_animate(gauge, dt);
+            moving = gauge->current_value != gauge->target_value;
+        }
+        if (frame == check_frame) {
+            result.value_at_check = gauge->current_value;
+        }
+        if (!moving && result.settle_ms < 0.0f) {
+            result.settle_ms = frame * dt * 1000.0f;
+        }
+        if (!moving && frame >= check_frame) break;
+    }
+
+    gauge_animator_free(&animator);
+    widget_tree_free(&tree);
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    int frames = argc > 1 ? atoi(argv[1]) : 2000;
+    if (frames < BENCH_RETARGET_FRAMES) frames = BENCH_RETARGET_FRAMES;
+
+    printf("\n=== Gauge Animation Benchmark ===\n");
+    printf("Spring, %d ms, new target every %d frames at %d Hz, %d frames\n\n",
+           ANIMATION_DEFAULT_DURATION_MS, BENCH_RETARGET_FRAMES, GUI_UPDATE_RATE_HZ, frames);
+    printf("%8s %16s %16s %10s %14s\n", "gauges", "per-widget ns", "batched ns", "ratio",
+           "moving/frame");
+
+    for (size_t c = 0; c < GAUGE_COUNT_STEPS; c++) {
+        double legacy_moving, batched_moving;
+        double legacy = time_gauges(GAUGE_COUNTS[c], frames, false, &legacy_moving);
+        double batched = time_gauges(GAUGE_COUNTS[c], frames, true, &batched_moving);
+        printf("%8d %16.2f %16.2f %9.2fx %14.1f\n", GAUGE_COUNTS[c], legacy, batched,
+               legacy > 0.0 ? batched / legacy : 0.0, batched_moving);
+    }
+
+    printf("\n0 -> 100: value after %.0f ms, and settle time\n", BENCH_CHECK_S * 1000.0f);
+    printf("%-12s", "curve");
+    for (size_t r = 0; r < FRAME_RATE_STEPS; r++) {
+        printf("  %4u Hz value   settle", FRAME_RATES[r]);
+    }
+    printf("\n");
+
+    for (int curve = 0; curve <= ANIMATION_CURVE_COUNT; curve++) {
+        printf("%-12s", curve < ANIMATION_CURVE_COUNT ?
+               animation_curve_to_string((animation_curve_t)curve) : "per-widget");
+        for (size_t r = 0; r < FRAME_RATE_STEPS; r++) {
+            settle_result_t result = settle((animation_curve_t)curve, FRAME_RATES[r]);
+            printf("  %13.2f %6.0f ms", result.value_at_check, result.settle_ms);
+        }
+        printf("\n");
+    }
+    printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * QNX Dashboard Simulator - Fleet Simulation Benchmark
+ *
+ * Steps two identically seeded fleets, one through the vector kernel and
+ * one through the scalar physics path, reports vehicles per second for
+ * each and checks that the final states agree.
+ *
+ * Usage: bench_fleet [vehicles] [steps]
+ */
+
+#include "../include/fleet.h"
+
+#define BENCH_DT         0.01f     /* 100 Hz, as DATA_UPDATE_RATE_HZ */
+#define BENCH_SEED       12345u
+#define BENCH_TOLERANCE  1e-3f     /* Relative; -ffast-math builds may reassociate */
+
+static float relative_error(float a, float b) {
+    float scale = fabsf(b) > 1.0f ? fabsf(b) : 1.0f;
+    return fabsf(a - b) / scale;
+}
+
+static float compare_fleets(const fleet_t *a, const fleet_t *b) {
+    const float *fields_a[] = {a->speed_kmh, a->rpm, a->fuel_level, a->engine_temp,
+                               a->oil_pressure, a->battery_voltage, a->acceleration, a->gear};
+    const float *fields_b[] = {b->speed_kmh, b->rpm, b->fuel_level, b->engine_temp,
+                               b->oil_pressure, b->battery_voltage, b->acceleration, b->gear};
+    float max_error = 0.0f;
+    
+    for (size_t field = 0; field < sizeof(fields_a) / sizeof(fields_a[0]); field++) {
+        for (uint32_t i = 0; i < a->count; i++) {
+            float error = relative_error(fields_a[field][i], fields_b[field][i]);
+            if (error > max_error) max_error = error;
+        }
+    }
+    return max_error;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t vehicles = argc > 1 ? (uint32_t)atoi(argv[1]) : 65536;
+    uint32_t steps = argc > 2 ? (uint32_t)atoi(argv[2]) : 1000;
+    fleet_t vector_fleet, scalar_fleet;
+    
+    if (fleet_init(&vector_fleet, vehicles, BENCH_SEED) != 0 ||
+        fleet_init(&scalar_fleet, vehicles, BENCH_SEED) != 0) {
+        fprintf(stderr, "fleet_init failed for %u vehicles\n", vehicles);
+        return 1;
+    }
+    
+    printf("=== Fleet Simulation Benchmark ===\n");
+    printf("Vehicles: %u, steps: %u (%.0f s simulated), kernel: %s\n\n",
+           vehicles, steps, steps * BENCH_DT, fleet_simd_name());
+    
+    for (uint32_t step = 0; step < steps; step++) {
+        fleet_step(&vector_fleet, BENCH_DT);
+        fleet_step_scalar(&scalar_fleet, BENCH_DT);
+    }
+    
+    double vector_rate = fleet_vehicles_per_second(&vector_fleet);
+    double scalar_rate = fleet_vehicles_per_second(&scalar_fleet);
+    printf("Vector: %8.1f M vehicles/s\n", vector_rate / 1e6);
+    printf("Scalar: %8.1f M vehicles/s\n", scalar_rate / 1e6);
+    if (scalar_rate > 0.0) {
+        printf("Speedup: %.2fx\n", vector_rate / scalar_rate);
+    }
+    
+    vehicle_data_t sample;
+    fleet_get_vehicle(&vector_fleet, vehicles / 2, &sample);
+    printf("\nVehicle %u: %.1f km/h, %.0f rpm, gear %d, %.1f C, fuel %.3f%%\n",
+           vehicles / 2, sample.speed_kmh, sample.rpm, sample.gear_position,
+           sample.engine_temp, sample.fuel_level);
+    
+    float max_error = compare_fleets(&vector_fleet, &scalar_fleet);
+    bool ok = max_error <= BENCH_TOLERANCE;
+    printf("Max relative difference vs scalar: %g -> %s\n", max_error, ok ? "ok" : "FAIL");
+    
+    fleet_free(&vector_fleet);
+    fleet_free(&scalar_fleet);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/**
+ * QNX Dashboard Simulator - Frame Scheduler Benchmark
+ *
+ * Plays a highway cruise scenario through the data simulator and the GUI
+ * the way gui_thread_main() does - interpolate the last two data steps,
+ * gui_manager_update(), gui_manager_render() - on a simulated clock, and
+ * reports the GUI's CPU time per minute of driving: repainting every
+ * frame at a fixed 60 Hz, fixed 60 Hz with damage tracking, and the frame
+ * scheduler with visual epsilons of 0, 1 and 2 pixels. A last run repaints
+ * every frame and adds a synthetic cost to each for the first half of the
+ * drive, to show the rate dropping under load and recovering after it.
+ *
+ * CPU time is the thread CPU clock around the GUI work of each
+ * activation; the simulator's own steps are not counted, and neither are
+ * wake-ups (reported as activations). Animations are off because their
+ * time base is the wall clock, not the simulated one.
+ *
+ * Usage: bench_frame_scheduler [scenario.json] [layout.json]
+ */
+
+#include "../include/gui_manager.h"
+#include "../include/frame_scheduler.h"
+#include "../include/data_simulator.h"
+#include "../include/scenario.h"
+#include "../include/widget_tree.h"
+
+#define BENCH_START_NS     1000000000ULL  /* Simulated clock origin; 0 means unstarted */
+#define BENCH_LOAD_NS      25000000ULL    /* Synthetic extra cost per frame under load */
+
+typedef struct {
+    const char *name;
+    bool full_repaint;         /* Invalidate every activation */
+    bool adaptive;
+    float epsilon_px;
+    uint64_t load_ns;          /* Added to frame cost during the first half */
+} bench_mode_t;
+
+static const bench_mode_t MODES[] = {
+    {"fixed 60 Hz, full repaint", true,  false, 0.0f, 0},
+    {"fixed 60 Hz, damage only",  false, false, 0.0f, 0},
+    {"scheduled, epsilon 0 px",   false, true,  0.0f, 0},
+    {"scheduled, epsilon 1 px",   false, true,  1.0f, 0},
+    {"scheduled, epsilon 2 px",   false, true,  2.0f, 0},
+};
+
+#define MODE_COUNT (sizeof(MODES) / sizeof(MODES[0]))
+
+typedef struct {
+    uint64_t activations;
+    uint64_t presented[2];     /* First and second half of the drive */
+    uint64_t cpu_ns;
+    uint32_t rate_drops;
+    uint32_t rate_restores;
+} bench_result_t;
+
+/* gui_manager_handle_events() may request a shutdown; nothing to stop here */
+void dashboard_shutdown(void) {
+}
+
+static uint64_t thread_cpu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Drive duration_ns of the scenario through gui under mode
+ */
+static bench_result_t run_mode(const bench_mode_t *mode, gui_manager_t *gui,
+                               const scenario_t *scenario, uint64_t duration_ns) {
+    bench_result_t result;
+    memset(&result, 0, sizeof(result));
+
+    /* Fresh simulator over the shared keyframe tables */
+    data_simulator_t sim;
+    data_simulator_reset(&sim, 1);
+    sim.scenario = *scenario;
+    scenario_reset(&sim.scenario);
+    sim.mode = SIM_MODE_DEMO;
+
+    frame_scheduler_t scheduler;
+    frame_scheduler_init(&scheduler, GUI_UPDATE_RATE_HZ, GUI_MIN_RATE_HZ, GUI_IDLE_RATE_HZ,
+                         mode->adaptive);
+    gui_manager_set_visual_epsilon(gui, mode->epsilon_px);
+    gui_manager_invalidate(gui);
+
+    uint64_t now = BENCH_START_NS;
+    uint64_t half = BENCH_START_NS + duration_ns / 2;
+    uint64_t end = BENCH_START_NS + duration_ns;
+    data_simulator_advance(&sim, now, NULL, NULL);
+
+    while (now < end) {
+        data_simulator_advance(&sim, now, NULL, NULL);
+
+        uint64_t cpu_start = thread_cpu_ns();
+        vehicle_data_t shown;
+        float alpha = data_interpolation_alpha(&sim.previous_data, &sim.current_data,
+                                               now - sim.clock.step_ns);
+        data_interpolate(&sim.previous_data, &sim.current_data, alpha, &shown);
+        if (mode->full_repaint) {
+            gui_manager_invalidate(gui);
+        }
+        gui_manager_update(gui, &shown);
+        bool presented = gui_manager_render(gui);
+        uint64_t cost = thread_cpu_ns() - cpu_start;
+
+        result.cpu_ns += cost;
+        result.activations++;
+        if (presented) {
+            result.presented[now < half ? 0 : 1]++;
+        }
+        if (presented && now < half) {
+            cost += mode->load_ns;
+        }
+
+        now += frame_scheduler_end_frame(&scheduler, presented, gui_manager_animating(gui), cost) *
+               scheduler.period_ns;
+    }
+
+    result.rate_drops = scheduler.rate_drops;
+    result.rate_restores = scheduler.rate_restores;
+    memset(&sim.scenario, 0, sizeof(sim.scenario));
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    const char *scenario_file = argc > 1 && argv[1][0] ? argv[1] : "resources/scenarios/highway_cruise.json";
+    const char *layout = argc > 2 && argv[2][0] ? argv[2] : NULL;
+
+    scenario_t scenario;
+    if (scenario_load(&scenario, scenario_file) != 0) {
+        fprintf(stderr, "Cannot load scenario %s\n", scenario_file);
+        return 1;
+    }
+    float duration_s = scenario.duration >= 1.0f ? scenario.duration : 60.0f;
+    uint64_t duration_ns = (uint64_t)(duration_s * 1e9);
+    double per_minute = 60.0 / duration_s;
+
+    gui_manager_t *gui = calloc(1, sizeof(gui_manager_t));
+    if (!gui || gui_manager_initialize(gui) != 0 ||
+        (layout && gui_manager_load_layout(gui, layout) != 0)) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+    if (gui->widgets.design_width > 0 && gui->widgets.design_height > 0 &&
+        gui_manager_resize(gui, gui->widgets.design_width, gui->widgets.design_height) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+    gui_manager_set_animations(gui, false);
+
+    printf("\n=== Frame Scheduler Benchmark ===\n");
+    printf("Scenario: %s (%.0f s), layout %s at %dx%d, animations off\n\n", scenario.name,
+           duration_s, gui->widgets.name, gui->framebuffer.width, gui->framebuffer.height);
+    printf("%-26s %12s %10s %8s %14s %7s\n", "mode", "activations", "frames", "mean Hz",
+           "CPU ms/minute", "CPU %");
+
+    for (size_t m = 0; m < MODE_COUNT; m++) {
+        bench_result_t result = run_mode(&MODES[m], gui, &scenario, duration_ns);
+        uint64_t frames = result.presented[0] + result.presented[1];
+        double cpu_ms = (double)result.cpu_ns / 1e6 * per_minute;
+        printf("%-26s %12.0f %10.0f %8.1f %14.1f %7.2f\n", MODES[m].name,
+               result.activations * per_minute, frames * per_minute, frames / duration_s,
+               cpu_ms, cpu_ms / 600.0);
+    }
+
+    /* Frames that overrun their interval for the first half of the drive */
+    bench_mode_t loaded = {"overloaded", true, true, 0.0f, BENCH_LOAD_NS};
+    bench_result_t result = run_mode(&loaded, gui, &scenario, duration_ns);
+    printf("\n+%.0f ms per frame for %.0f s: %.1f Hz, then %.1f Hz "
+           "(%u rate drops, %u restores)\n\n",
+           BENCH_LOAD_NS / 1e6, duration_s / 2,
+           result.presented[0] / (duration_s / 2), result.presented[1] / (duration_s / 2),
+           result.rate_drops, result.rate_restores);
+
+    gui_manager_cleanup(gui);
+    free(gui);
+    scenario_free(&scenario);
+    return 0;
+}
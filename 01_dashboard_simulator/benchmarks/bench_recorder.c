@@ -0,0 +1,150 @@
+/**
+ * QNX Dashboard Simulator - Recorder Jitter Benchmark
+ *
+ * Runs a periodic producer loop (1 kHz by default) with the recorder off
+ * and then on, and compares wake-up lateness and per-iteration cost. The
+ * recording is read back afterwards to check the header, index trailer,
+ * record count and that sequence numbers only skip where drops were counted.
+ *
+ * Usage: bench_recorder [seconds] [rate_hz] [path]
+ */
+
+#include <fcntl.h>
+#include "../include/recorder.h"
+#include "../include/latency_histogram.h"
+
+typedef struct {
+    latency_histogram_t lateness;
+    latency_histogram_t submit_cost;
+} bench_result_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void run_loop(recorder_t *rec, int seconds, uint32_t rate_hz, bench_result_t *result) {
+    uint64_t period_ns = 1000000000ULL / rate_hz;
+    uint64_t iterations = (uint64_t)seconds * rate_hz;
+    uint64_t release_ns = now_ns();
+    vehicle_data_t data;
+
+    memset(&data, 0, sizeof(data));
+    latency_histogram_reset(&result->lateness);
+    latency_histogram_reset(&result->submit_cost);
+
+    for (uint64_t i = 0; i < iterations; i++) {
+        release_ns += period_ns;
+        struct timespec release = {
+            (time_t)(release_ns / 1000000000ULL), (long)(release_ns % 1000000000ULL)
+        };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, NULL);
+
+        uint64_t woke = now_ns();
+        latency_histogram_record(&result->lateness, woke > release_ns ? woke - release_ns : 0);
+
+        data.acquired_ns = woke;
+        data.speed_kmh = (float)(i % 200);
+        data.rpm = 800.0f + (float)(i % 6000);
+
+        uint64_t start = now_ns();
+        if (rec) {
+            recorder_submit(rec, &data);
+        }
+        latency_histogram_record(&result->submit_cost, now_ns() - start);
+    }
+}
+
+static void print_row(const char *name, const bench_result_t *result) {
+    printf("%-9s | %10.1f | %10.1f | %10.1f | %10.0f | %10.0f\n", name,
+           (double)latency_histogram_percentile(&result->lateness, 50.0) / 1000.0,
+           (double)latency_histogram_percentile(&result->lateness, 99.0) / 1000.0,
+           (double)latency_histogram_max(&result->lateness) / 1000.0,
+           (double)latency_histogram_percentile(&result->submit_cost, 99.0),
+           (double)latency_histogram_max(&result->submit_cost));
+}
+
+/* Read the recording back and check it against the recorder's counters */
+static bool verify_recording(const char *path, const recorder_t *rec) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("open recording");
+        return false;
+    }
+
+    vehicle_record_header_t header;
+    vehicle_record_trailer_t trailer;
+    off_t end = lseek(fd, -(off_t)sizeof(trailer), SEEK_END);
+    bool ok = end > 0 && read(fd, &trailer, sizeof(trailer)) == (ssize_t)sizeof(trailer) &&
+              trailer.magic == RECORDER_INDEX_MAGIC;
+    ok = ok && lseek(fd, 0, SEEK_SET) == 0 &&
+         read(fd, &header, sizeof(header)) == (ssize_t)sizeof(header) &&
+         recorder_validate_header(&header) == 0;
+
+    uint64_t records = 0, gaps = 0;
+    uint64_t record_count = ok ? (trailer.index_offset - header.header_size) / sizeof(vehicle_record_t) : 0;
+    uint32_t expected = 0;
+    vehicle_record_t record;
+    while (ok && records < record_count &&
+           read(fd, &record, sizeof(record)) == (ssize_t)sizeof(record)) {
+        if (record.sequence < expected) ok = false;
+        gaps += record.sequence - expected;
+        expected = record.sequence + 1;
+        records++;
+    }
+    close(fd);
+
+    ok = ok && records == rec->records_written && records == rec->submitted &&
+         gaps == rec->dropped;
+    printf("Verify: %llu records, %llu missing, %u index entries -> %s\n",
+           (unsigned long long)records, (unsigned long long)gaps,
+           ok ? trailer.entry_count : 0, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    int seconds = argc > 1 ? atoi(argv[1]) : 3;
+    int rate_hz = argc > 2 ? atoi(argv[2]) : 1000;
+    const char *path = argc > 3 ? argv[3] : "/tmp/bench_recorder.qdr";
+
+    if (seconds < 1) seconds = 1;
+    if (rate_hz < 1) rate_hz = 1;
+
+    bench_result_t *off = calloc(1, sizeof(bench_result_t));
+    bench_result_t *on = calloc(1, sizeof(bench_result_t));
+    recorder_t *rec = calloc(1, sizeof(recorder_t));
+    if (!off || !on || !rec) {
+        fprintf(stderr, "Error: Out of memory\n");
+        return 1;
+    }
+
+    printf("=== Recorder Jitter Benchmark ===\n");
+    printf("Rate: %d Hz, Duration: %d s per case, Record: %zu bytes\n\n",
+           rate_hz, seconds, sizeof(vehicle_record_t));
+
+    run_loop(NULL, seconds, (uint32_t)rate_hz, off);
+
+    if (recorder_open(rec, path, (uint32_t)rate_hz) != 0) {
+        return 1;
+    }
+    run_loop(rec, seconds, (uint32_t)rate_hz, on);
+    recorder_close(rec);
+
+    printf("%-9s | %10s | %10s | %10s | %10s | %10s\n",
+           "Recorder", "Late p50us", "Late p99us", "Late maxus", "Submit p99", "Submit max");
+    print_row("off", off);
+    print_row("on", on);
+    printf("\n");
+
+    recorder_print_statistics(rec);
+    printf("Throughput: %.1f KB/s, %.1f MB/hour\n",
+           (double)rec->bytes_written / seconds / 1024.0,
+           (double)rec->bytes_written / seconds * 3600.0 / (1024.0 * 1024.0));
+    bool ok = verify_recording(path, rec);
+
+    free(off);
+    free(on);
+    free(rec);
+    return ok ? 0 : 1;
+}
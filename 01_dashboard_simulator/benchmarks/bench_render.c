@@ -0,0 +1,173 @@
+/**
+ * QNX Dashboard Simulator - Software Render Benchmark
+ *
+ * Drives gui_manager through a synthetic drive cycle and times each
+ * gui_manager_render() call (rasterize plus present) at WINDOW_WIDTH x
+ * WINDOW_HEIGHT, once repainting every frame in full and once with the
+ * cached gauge faces and dirty rectangles, then over a steady cruise where
+ * the needles barely move. Animations and the visual epsilon are off, so
+ * gauges jump to their sampled values and every run draws the same
+ * frames, and the dirty-rectangle frames are checked pixel for pixel
+ * against full repaints. The last frame can be saved as a PPM image, and
+ * frames can be presented to a file or /dev/fb0 instead of memory.
+ *
+ * Usage: bench_render [frames] [snapshot.ppm] [output]
+ */
+
+#include "../include/gui_manager.h"
+#include "../include/framebuffer.h"
+
+typedef enum {
+    BENCH_FULL_REDRAW = 0,
+    BENCH_DIRTY_RECTS,
+    BENCH_STEADY_CRUISE
+} bench_mode_t;
+
+/* gui_manager_handle_events() may request a shutdown; nothing to stop here */
+void dashboard_shutdown(void) {
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * Drive cycle sampled at 60 Hz: a launch, cruise and braking every 40 s
+ */
+static void make_sample(int frame, bench_mode_t mode, vehicle_data_t *data) {
+    float t = frame * (1.0f / GUI_UPDATE_RATE_HZ);
+    float phase = fmodf(t, 40.0f);
+    float speed = phase < 15.0f ? phase * 8.0f : phase < 30.0f ? 120.0f + 10.0f * sinf(t) :
+                                                  120.0f - (phase - 30.0f) * 12.0f;
+
+    memset(data, 0, sizeof(vehicle_data_t));
+    data->speed_kmh = speed;
+    data->rpm = IDLE_RPM + speed * 40.0f + 300.0f * sinf(t * 3.0f);
+    data->fuel_level = 60.0f - t * 0.05f;
+    data->engine_temp = 85.0f + 15.0f * sinf(t * 0.2f);
+    data->oil_pressure = 40.0f;
+    data->battery_voltage = phase < 2.0f ? 11.0f : 13.8f;
+
+    if (mode == BENCH_STEADY_CRUISE) {
+        /* Cruise control: sensor noise well below a displayed unit */
+        data->speed_kmh = 100.0f + 0.2f * sinf(t * 5.0f);
+        data->rpm = 2400.0f + 0.3f * sinf(t * 7.0f);
+        data->fuel_level = 60.0f - t * 0.002f;
+        data->engine_temp = 90.0f;
+        data->battery_voltage = 13.8f;
+    }
+}
+
+static void step(gui_manager_t *gui, int frame, bench_mode_t mode) {
+    vehicle_data_t data;
+    make_sample(frame, mode, &data);
+    gui_manager_update(gui, &data);
+    if (mode == BENCH_FULL_REDRAW) {
+        gui_manager_invalidate(gui);
+    }
+}
+
+/**
+ * Time count frames of one mode and print a result row
+ */
+static void run_mode(gui_manager_t *gui, int count, bench_mode_t mode, const char *name,
+                     uint64_t *frame_ns) {
+    uint64_t total_ns = 0;
+
+    gui_manager_invalidate(gui);
+    gui_manager_render(gui);
+    uint64_t pixels_before = gui->pixels_redrawn;
+
+    for (int i = 0; i < count; i++) {
+        step(gui, i, mode);
+        uint64_t start = get_timestamp_ns();
+        gui_manager_render(gui);
+        frame_ns[i] = get_timestamp_ns() - start;
+        total_ns += frame_ns[i];
+    }
+
+    qsort(frame_ns, (size_t)count, sizeof(uint64_t), compare_u64);
+    double screen = (double)gui->framebuffer.width * gui->framebuffer.height;
+    double pixels = (double)(gui->pixels_redrawn - pixels_before) / count;
+    printf("%-14s %10.3f %10.3f %10.3f %10.3f %12.0f %8.1f%%\n", name,
+           (double)total_ns / count / 1e6, frame_ns[count / 2] / 1e6,
+           frame_ns[(size_t)(count * 0.99)] / 1e6, frame_ns[count - 1] / 1e6,
+           pixels, 100.0 * pixels / screen);
+}
+
+/**
+ * Dirty-rectangle frames must equal full repaints of the same state
+ */
+static bool verify_dirty_rects(gui_manager_t *gui, gui_manager_t *reference, int count) {
+    framebuffer_t *fb = &gui->framebuffer;
+    framebuffer_t *ref = &reference->framebuffer;
+
+    for (int i = 0; i < count; i++) {
+        bench_mode_t mode = (i / 600) % 2 ? BENCH_STEADY_CRUISE : BENCH_DIRTY_RECTS;
+        step(gui, i, mode);
+        step(reference, i, mode);
+        gui_manager_invalidate(reference);
+        gui_manager_render(gui);
+        gui_manager_render(reference);
+
+        for (int y = 0; y < fb->height; y++) {
+            if (memcmp(fb->pixels + (size_t)y * fb->stride, ref->pixels + (size_t)y * ref->stride,
+                       (size_t)fb->width * sizeof(uint32_t)) != 0) {
+                printf("Frame %d differs from a full repaint at row %d\n", i, y);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : 3600;
+    const char *snapshot = argc > 2 && argv[2][0] ? argv[2] : NULL;
+    const char *output = argc > 3 && argv[3][0] ? argv[3] : NULL;
+    if (count < 1) count = 1;
+
+    gui_manager_t *gui = calloc(1, sizeof(gui_manager_t));
+    gui_manager_t *reference = calloc(1, sizeof(gui_manager_t));
+    uint64_t *frame_ns = malloc((size_t)count * sizeof(uint64_t));
+    if (!gui || !reference || !frame_ns || gui_manager_initialize(gui) != 0 ||
+        gui_manager_initialize(reference) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+    gui_manager_set_animations(gui, false);
+    gui_manager_set_animations(reference, false);
+    gui_manager_set_visual_epsilon(gui, 0.0f);
+    gui_manager_set_visual_epsilon(reference, 0.0f);
+    if (output && gui_manager_set_output(gui, output) != 0) {
+        return 1;
+    }
+
+    printf("\n=== Software Render Benchmark ===\n");
+    printf("Frames: %d at %dx%d, output: %s\n\n", count, gui->framebuffer.width,
+           gui->framebuffer.height, output ? output : "memory");
+    printf("%-14s %10s %10s %10s %10s %12s %9s\n", "", "mean ms", "p50 ms", "p99 ms", "max ms",
+           "pixels/frame", "screen");
+
+    run_mode(gui, count, BENCH_FULL_REDRAW, "full redraw", frame_ns);
+    run_mode(gui, count, BENCH_DIRTY_RECTS, "dirty rects", frame_ns);
+    run_mode(gui, count, BENCH_STEADY_CRUISE, "steady cruise", frame_ns);
+
+    if (snapshot) {
+        if (framebuffer_write_ppm(&gui->framebuffer, snapshot) == 0) {
+            printf("\nLast frame written to %s\n", snapshot);
+        }
+    }
+
+    bool same = verify_dirty_rects(gui, reference, count < 2400 ? count : 2400);
+    printf("\nDirty rectangles match full repaint: %s\n", same ? "ok" : "FAIL");
+
+    gui_manager_cleanup(reference);
+    gui_manager_cleanup(gui);
+    free(frame_ns);
+    free(reference);
+    free(gui);
+    return same ? 0 : 1;
+}
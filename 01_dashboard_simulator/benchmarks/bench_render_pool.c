@@ -0,0 +1,146 @@
+/**
+ * QNX Dashboard Simulator - Tile-Parallel Render Scaling Benchmark
+ *
+ * Repaints the whole dashboard every frame at several resolutions with 1,
+ * 2, 4, ... render threads up to the online CPU count, and reports frame
+ * time, speedup, parallel efficiency and the share of a 60 Hz frame budget
+ * spent rasterizing. Tiles never overlap, so every thread count must
+ * produce the same image as a single thread.
+ *
+ * Usage: bench_render_pool [frames] [max_threads]
+ */
+
+#include "../include/gui_manager.h"
+#include "../include/framebuffer.h"
+#include "../include/render_pool.h"
+
+static const PhDim_t RESOLUTIONS[] = {
+    {800, 480}, {1024, 768}, {1920, 720}, {2560, 1440}, {3840, 2160}
+};
+
+#define RESOLUTION_COUNT (sizeof(RESOLUTIONS) / sizeof(RESOLUTIONS[0]))
+
+/* gui_manager_handle_events() may request a shutdown; nothing to stop here */
+void dashboard_shutdown(void) {
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * One frame of a launch: every gauge moves, so each frame differs
+ */
+static void step(gui_manager_t *gui, int frame) {
+    vehicle_data_t data;
+    float t = frame * (1.0f / GUI_UPDATE_RATE_HZ);
+    
+    memset(&data, 0, sizeof(data));
+    data.speed_kmh = fmodf(t * 20.0f, MAX_SPEED);
+    data.rpm = IDLE_RPM + data.speed_kmh * 40.0f;
+    data.fuel_level = 60.0f - t;
+    data.engine_temp = 85.0f + 15.0f * sinf(t);
+    data.oil_pressure = 40.0f;
+    data.battery_voltage = 13.8f;
+    
+    gui_manager_update(gui, &data);
+    gui_manager_invalidate(gui);
+}
+
+static bool same_image(const framebuffer_t *a, const framebuffer_t *b) {
+    for (int y = 0; y < a->height; y++) {
+        if (memcmp(a->pixels + (size_t)y * a->stride, b->pixels + (size_t)y * b->stride,
+                   (size_t)a->width * sizeof(uint32_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : 120;
+    uint32_t max_threads = argc > 2 ? (uint32_t)atoi(argv[2]) : render_pool_default_threads();
+    bool ok = true;
+    
+    if (count < 1) count = 1;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > RENDER_POOL_MAX_THREADS) max_threads = RENDER_POOL_MAX_THREADS;
+    
+    gui_manager_t *gui = calloc(1, sizeof(gui_manager_t));
+    framebuffer_t reference;
+    uint64_t *frame_ns = malloc((size_t)count * sizeof(uint64_t));
+    if (!gui || !frame_ns) return 1;
+    
+    printf("=== Tile-Parallel Render Scaling Benchmark ===\n");
+    printf("Full repaints: %d frames per run, tiles %dx%d, CPUs: %u\n\n", count,
+           RENDER_TILE_WIDTH, RENDER_TILE_HEIGHT, render_pool_default_threads());
+    printf("%-11s %7s %6s %10s %10s %9s %11s %8s\n", "resolution", "threads", "tiles",
+           "mean ms", "p99 ms", "speedup", "efficiency", "budget");
+    
+    for (size_t r = 0; r < RESOLUTION_COUNT; r++) {
+        PhDim_t size = RESOLUTIONS[r];
+        double baseline = 0.0;
+        
+        if (gui_manager_initialize(gui) != 0 || gui_manager_resize(gui, size.w, size.h) != 0 ||
+            framebuffer_init(&reference, size.w, size.h) != 0) {
+            fprintf(stderr, "Setup failed at %dx%d\n", size.w, size.h);
+            return 1;
+        }
+        gui_manager_set_animations(gui, false);
+        gui_manager_set_visual_epsilon(gui, 0.0f);
+        
+        for (uint32_t threads = 1;; threads *= 2) {
+            if (threads > max_threads) threads = max_threads;
+            if (gui_manager_set_render_threads(gui, (int)threads, NULL) != 0) return 1;
+            
+            /* Untimed frame builds the faces */
+            step(gui, 0);
+            gui_manager_render(gui);
+            uint64_t passes = gui->render_pool.passes;
+            uint64_t tiles = gui->render_pool.tiles_rendered;
+            
+            uint64_t total_ns = 0;
+            for (int i = 0; i < count; i++) {
+                step(gui, i);
+                uint64_t start = get_timestamp_ns();
+                gui_manager_render(gui);
+                frame_ns[i] = get_timestamp_ns() - start;
+                total_ns += frame_ns[i];
+            }
+            
+            qsort(frame_ns, (size_t)count, sizeof(uint64_t), compare_u64);
+            double mean_ms = (double)total_ns / count / 1e6;
+            if (threads == 1) baseline = mean_ms;
+            passes = gui->render_pool.passes - passes;
+            tiles = gui->render_pool.tiles_rendered - tiles;
+            
+            char name[16];
+            snprintf(name, sizeof(name), "%dx%d", size.w, size.h);
+            printf("%-11s %7u %6.0f %10.3f %10.3f %8.2fx %10.0f%% %7.1f%%\n", name, threads,
+                   passes ? (double)tiles / passes : 0.0, mean_ms,
+                   frame_ns[(size_t)(count * 0.99)] / 1e6, baseline / mean_ms,
+                   100.0 * baseline / mean_ms / threads, mean_ms * GUI_UPDATE_RATE_HZ / 10.0);
+            
+            /* Every run ends on the same state */
+            if (threads == 1) {
+                framebuffer_blit(&reference, &gui->framebuffer, 0, 0);
+            } else if (!same_image(&reference, &gui->framebuffer)) {
+                printf("%s with %u threads differs from a single thread\n", name, threads);
+                ok = false;
+            }
+            
+            if (threads == max_threads) break;
+        }
+        
+        framebuffer_free(&reference);
+        gui_manager_cleanup(gui);
+        printf("\n");
+    }
+    
+    printf("Tiles match single-threaded rendering: %s\n", ok ? "ok" : "FAIL");
+    free(frame_ns);
+    free(gui);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * QNX Dashboard Simulator - Replay Seek and Playback Benchmark
+ *
+ * Writes a synthetic 1 kHz recording (header, records, sparse index,
+ * trailer), then measures open time, random seek cost with and without
+ * the index, and per-tick playback cost at several speeds. Every seek is
+ * checked against the recording.
+ *
+ * Usage: bench_replay [records] [path]
+ */
+
+#include <fcntl.h>
+#include "../include/replay.h"
+#include "../include/recorder.h"
+
+#define BENCH_SEEKS        100000
+#define BENCH_TICKS        20000
+#define BENCH_PERIOD_NS    1000000ULL   /* 1 kHz recording */
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t record_time(uint64_t i) {
+    /* Small deterministic jitter so timestamps are not a pure stride */
+    return 1000000000ULL + i * BENCH_PERIOD_NS + (i * 7919ULL) % 50000ULL;
+}
+
+static int write_recording(const char *path, uint64_t count) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        perror("create recording");
+        return -1;
+    }
+
+    vehicle_record_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = RECORDER_MAGIC;
+    header.version = RECORDER_FORMAT_VERSION;
+    header.header_size = sizeof(header);
+    header.record_size = sizeof(vehicle_record_t);
+    header.sample_rate_hz = 1000;
+    fwrite(&header, sizeof(header), 1, file);
+
+    vehicle_data_t data;
+    memset(&data, 0, sizeof(data));
+    for (uint64_t i = 0; i < count; i++) {
+        vehicle_record_t record;
+        data.acquired_ns = record_time(i);
+        data.speed_kmh = (float)(i % 200);
+        recorder_encode(&data, (uint32_t)i, &record);
+        fwrite(&record, sizeof(record), 1, file);
+    }
+
+    uint32_t entries = (uint32_t)((count + RECORDER_INDEX_INTERVAL - 1) / RECORDER_INDEX_INTERVAL);
+    for (uint32_t e = 0; e < entries; e++) {
+        vehicle_record_index_t entry;
+        entry.record = (uint64_t)e * RECORDER_INDEX_INTERVAL;
+        entry.acquired_ns = record_time(entry.record);
+        fwrite(&entry, sizeof(entry), 1, file);
+    }
+
+    vehicle_record_trailer_t trailer;
+    memset(&trailer, 0, sizeof(trailer));
+    trailer.index_offset = sizeof(header) + count * sizeof(vehicle_record_t);
+    trailer.entry_count = entries;
+    trailer.interval = RECORDER_INDEX_INTERVAL;
+    trailer.magic = RECORDER_INDEX_MAGIC;
+    fwrite(&trailer, sizeof(trailer), 1, file);
+
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+/* Random seeks; returns ns per seek, counts wrong answers in *errors */
+static double bench_seeks(replay_t *replay, uint64_t *errors) {
+    uint64_t span = replay->last_ns - replay->first_ns;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t start = now_ns();
+
+    for (int i = 0; i < BENCH_SEEKS; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint64_t target = replay->first_ns + state % (span + 1);
+
+        uint64_t found = replay_seek(replay, target);
+        bool ok = replay->records[found].acquired_ns <= target &&
+                  (found + 1 == replay->record_count ||
+                   replay->records[found + 1].acquired_ns > target);
+        if (!ok) (*errors)++;
+    }
+    return (double)(now_ns() - start) / BENCH_SEEKS;
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 2000000ULL;
+    const char *path = argc > 2 ? argv[2] : "/tmp/bench_replay.qdr";
+    const float speeds[] = {1.0f, 10.0f, 100.0f, 1000.0f};
+    uint64_t errors = 0;
+
+    if (count < 2) count = 2;
+
+    printf("=== Replay Benchmark ===\n");
+    printf("Records: %llu (%.1f MB, %.1f min at 1 kHz)\n\n", (unsigned long long)count,
+           (double)count * sizeof(vehicle_record_t) / (1024.0 * 1024.0),
+           (double)count / 60000.0);
+
+    if (write_recording(path, count) != 0) return 1;
+
+    replay_t replay;
+    uint64_t start = now_ns();
+    if (replay_open(&replay, path) != 0) return 1;
+    printf("Open: %.1f us\n", (double)(now_ns() - start) / 1000.0);
+
+    printf("Seek (indexed): %.0f ns\n", bench_seeks(&replay, &errors));
+    uint32_t saved_entries = replay.index_count;
+    replay.index_count = 0;
+    printf("Seek (records only): %.0f ns\n", bench_seeks(&replay, &errors));
+    replay.index_count = saved_entries;
+
+    printf("\n%-8s | %12s | %12s | %6s\n", "Speed", "ns/tick", "Log s played", "Loops");
+    for (size_t s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++) {
+        vehicle_data_t data;
+        uint64_t previous = 0;
+        uint32_t loops_before = replay.loops;
+
+        replay_seek(&replay, replay.first_ns);
+        start = now_ns();
+        for (int tick = 0; tick < BENCH_TICKS; tick++) {
+            replay_advance(&replay, 0.01f, speeds[s], true, &data);
+            /* Time only moves forward except when the log wraps */
+            if (data.acquired_ns < previous && replay.loops == loops_before) errors++;
+            if (replay.loops != loops_before) {
+                loops_before = replay.loops;
+            }
+            previous = data.acquired_ns;
+        }
+        double per_tick = (double)(now_ns() - start) / BENCH_TICKS;
+        printf("%7.0fx | %12.0f | %12.1f | %6u\n", speeds[s], per_tick,
+               BENCH_TICKS * 0.01 * speeds[s], replay.loops);
+    }
+
+    replay_close(&replay);
+    printf("\nCheck: %s (%llu errors)\n", errors == 0 ? "ok" : "FAIL", (unsigned long long)errors);
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/**
+ * QNX Dashboard Simulator - Scenario Compiler Benchmark
+ *
+ * Generates a large scenario (default 10k keyframes on each of the
+ * SIGNAL_COUNT signals), then times parse/compile from memory and from a
+ * file, and the per-tick evaluation cost. Evaluated values are checked
+ * against a double-precision interpolation of the generated keyframes.
+ *
+ * Usage: bench_scenario [keyframes_per_signal] [path]
+ */
+
+#include "../include/scenario.h"
+#include "../include/signal_ring.h"
+
+#define BENCH_TICK_S   0.01f
+#define BENCH_CHECKS   200000
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool is_discrete(int signal) {
+    return signal == SIGNAL_GEAR_POSITION || signal >= SIGNAL_IGNITION_ON;
+}
+
+/* Deterministic keyframe k of a signal: 0.25 s spacing, bounded values */
+static void keyframe(int signal, uint32_t k, float *time_s, float *value) {
+    *time_s = (float)k * 0.25f;
+    if (is_discrete(signal)) {
+        *value = (float)((k * 7u + (uint32_t)signal) % 6u);
+    } else {
+        *value = (float)((k * 2654435761u + (uint32_t)signal * 40503u) % 10000u) / 10.0f;
+    }
+}
+
+static char *build_json(uint32_t per_signal, size_t *length) {
+    size_t capacity = (size_t)per_signal * SIGNAL_COUNT * 32 + 4096;
+    char *json = malloc(capacity);
+    if (!json) return NULL;
+
+    size_t used = (size_t)snprintf(json, capacity, "{\n  \"name\": \"bench\",\n  \"signals\": {\n");
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        used += (size_t)snprintf(json + used, capacity - used, "    \"%s\": [",
+                                 signal_id_to_string((signal_id_t)signal));
+        for (uint32_t k = 0; k < per_signal; k++) {
+            float time_s, value;
+            keyframe(signal, k, &time_s, &value);
+            used += (size_t)snprintf(json + used, capacity - used, "%s[%.2f, %.1f]",
+                                     k ? ", " : "", time_s, value);
+        }
+        used += (size_t)snprintf(json + used, capacity - used, "]%s\n",
+                                 signal + 1 < SIGNAL_COUNT ? "," : "");
+    }
+    used += (size_t)snprintf(json + used, capacity - used, "  }\n}\n");
+    *length = used;
+    return json;
+}
+
+static double reference_value(int signal, uint32_t per_signal, double t) {
+    uint32_t k = (uint32_t)(t / 0.25);
+    if (k >= per_signal - 1) k = per_signal - 1;
+    float t0, v0, t1, v1;
+    keyframe(signal, k, &t0, &v0);
+    if (k + 1 >= per_signal || is_discrete(signal)) return v0;
+    keyframe(signal, k + 1, &t1, &v1);
+    return v0 + (v1 - v0) * (t - t0) / (t1 - t0);
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t per_signal = argc > 1 ? (uint32_t)atoi(argv[1]) : 10000;
+    const char *path = argc > 2 ? argv[2] : "/tmp/bench_scenario.json";
+    float values[SIGNAL_COUNT];
+    scenario_t scenario;
+
+    if (per_signal < 2) per_signal = 2;
+
+    size_t length;
+    char *json = build_json(per_signal, &length);
+    if (!json) return 1;
+
+    printf("=== Scenario Compiler Benchmark ===\n");
+    printf("Keyframes: %u (%u per signal), JSON: %.1f MB\n\n",
+           per_signal * SIGNAL_COUNT, per_signal, (double)length / (1024.0 * 1024.0));
+
+    /* Best of several parses from memory */
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < 5; run++) {
+        uint64_t start = now_ns();
+        if (scenario_parse(&scenario, json, length) != 0) return 1;
+        uint64_t elapsed = now_ns() - start;
+        if (elapsed < best) best = elapsed;
+        scenario_free(&scenario);
+    }
+    printf("Parse + compile (memory): %.2f ms\n", (double)best / 1000000.0);
+
+    FILE *file = fopen(path, "wb");
+    if (!file || fwrite(json, 1, length, file) != length) {
+        perror("write scenario");
+        return 1;
+    }
+    fclose(file);
+    free(json);
+
+    uint64_t start = now_ns();
+    if (scenario_load(&scenario, path) != 0) return 1;
+    printf("Load (file): %.2f ms\n", (double)(now_ns() - start) / 1000000.0);
+
+    /* Hot path: one tick of every signal, time moving forward */
+    uint64_t ticks = (uint64_t)(scenario.duration / BENCH_TICK_S);
+    start = now_ns();
+    for (uint64_t tick = 0; tick < ticks; tick++) {
+        scenario_evaluate(&scenario, (float)tick * BENCH_TICK_S, values);
+    }
+    double per_tick = (double)(now_ns() - start) / (double)ticks;
+    printf("Evaluate: %.1f ns/tick (%d signals, %llu ticks)\n", per_tick, SIGNAL_COUNT,
+           (unsigned long long)ticks);
+
+    /* Accuracy, including backwards jumps as on loop/reset */
+    double max_error = 0.0;
+    uint64_t state = 88172645463325252ULL;
+    for (int check = 0; check < BENCH_CHECKS; check++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        float t = (float)((double)(state % 1000000ULL) / 1000000.0 * scenario.duration);
+        scenario_evaluate(&scenario, t, values);
+        for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+            double error = fabs(values[signal] - reference_value(signal, per_signal, t));
+            if (error > max_error) max_error = error;
+        }
+    }
+    bool ok = max_error < 0.05;
+    printf("Max error vs reference: %.5f -> %s\n", max_error, ok ? "ok" : "FAIL");
+
+    scenario_free(&scenario);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/**
+ * QNX Dashboard Simulator - Signal Ingest Ring Benchmark
+ *
+ * One producer pushes at a fixed offered rate (0 = as fast as possible)
+ * while a consumer drains in batches at the data thread rate. The bench
+ * stores a sequence number in timestamp_ns so the consumer can check that
+ * samples arrive in order and that every sample is either consumed or
+ * counted as dropped.
+ *
+ * Usage: bench_signal_ring [seconds] [consumer_hz]
+ */
+
+#include "../include/signal_ring.h"
+
+typedef struct {
+    signal_ring_t ring;
+    volatile int running;
+    uint64_t offered_rate;       /* Samples per second, 0 = unthrottled */
+    uint32_t consumer_period_us;
+
+    /* Producer results */
+    uint64_t attempts;
+    uint64_t push_ns;
+
+    /* Consumer results */
+    uint64_t consumed;
+    uint64_t order_errors;
+    uint64_t last_sequence;
+    uint32_t max_backlog;
+} bench_context_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void *producer_main(void *arg) {
+    bench_context_t *ctx = (bench_context_t *)arg;
+    uint64_t start = now_ns();
+    uint64_t sequence = 0;
+
+    while (ctx->running) {
+        /* Push whatever the offered rate allows by now, then nap briefly */
+        uint64_t due = ctx->offered_rate == 0 ? sequence + 1024 :
+                       (now_ns() - start) * ctx->offered_rate / 1000000000ULL;
+        if (sequence >= due) {
+            struct timespec nap = {0, 50000};
+            nanosleep(&nap, NULL);
+            continue;
+        }
+
+        uint64_t burst_start = now_ns();
+        uint64_t burst = due - sequence;
+        for (uint64_t i = 0; i < burst; i++) {
+            sequence++;
+            signal_ring_push(&ctx->ring, (uint32_t)(sequence % SIGNAL_COUNT),
+                             (float)sequence, sequence);
+        }
+        ctx->push_ns += now_ns() - burst_start;
+    }
+
+    ctx->attempts = sequence;
+    return NULL;
+}
+
+static void consume_available(bench_context_t *ctx, signal_sample_t *batch) {
+    uint32_t backlog = signal_ring_size(&ctx->ring);
+    if (backlog > ctx->max_backlog) ctx->max_backlog = backlog;
+
+    uint32_t count;
+    while ((count = signal_ring_pop_batch(&ctx->ring, batch, SIGNAL_INGEST_BATCH)) > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (batch[i].timestamp_ns <= ctx->last_sequence) ctx->order_errors++;
+            ctx->last_sequence = batch[i].timestamp_ns;
+        }
+        ctx->consumed += count;
+    }
+}
+
+static void *consumer_main(void *arg) {
+    bench_context_t *ctx = (bench_context_t *)arg;
+    signal_sample_t batch[SIGNAL_INGEST_BATCH];
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (ctx->running) {
+        next.tv_nsec += (long)ctx->consumer_period_us * 1000L;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        consume_available(ctx, batch);
+    }
+    return NULL;
+}
+
+static void run_case(signal_ring_policy_t policy, uint64_t offered_rate, int seconds,
+                     uint32_t consumer_hz) {
+    bench_context_t *ctx = calloc(1, sizeof(bench_context_t));
+    if (!ctx) {
+        fprintf(stderr, "Error: Out of memory\n");
+        exit(1);
+    }
+    signal_ring_init(&ctx->ring, policy);
+    ctx->running = 1;
+    ctx->offered_rate = offered_rate;
+    ctx->consumer_period_us = 1000000U / consumer_hz;
+
+    pthread_t producer, consumer;
+    pthread_create(&consumer, NULL, consumer_main, ctx);
+    pthread_create(&producer, NULL, producer_main, ctx);
+
+    sleep((unsigned int)seconds);
+    ctx->running = 0;
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    /* Final drain so the books balance */
+    signal_sample_t batch[SIGNAL_INGEST_BATCH];
+    consume_available(ctx, batch);
+
+    const signal_ring_t *ring = &ctx->ring;
+    uint64_t dropped = ring->dropped_oldest + ring->dropped_newest;
+    bool balanced = ctx->consumed + dropped == ctx->attempts;
+
+    char offered[24];  /* Up to 20 digits and 'k' */
+    if (offered_rate == 0) {
+        snprintf(offered, sizeof(offered), "max");
+    } else {
+        snprintf(offered, sizeof(offered), "%lluk", (unsigned long long)(offered_rate / 1000));
+    }
+
+    printf("%-11s | %7s | %12.0f | %12.0f | %10llu | %8.1f | %7u | %6llu | %s\n",
+           signal_ring_policy_to_string(policy), offered,
+           (double)ctx->attempts / seconds,
+           (double)ctx->consumed / seconds,
+           (unsigned long long)dropped,
+           ctx->attempts ? (double)ctx->push_ns / (double)ctx->attempts : 0.0,
+           ctx->max_backlog,
+           (unsigned long long)ctx->order_errors,
+           balanced && ctx->order_errors == 0 ? "ok" : "FAIL");
+
+    free(ctx);
+}
+
+int main(int argc, char *argv[]) {
+    int seconds = argc > 1 ? atoi(argv[1]) : 2;
+    int consumer_hz = argc > 2 ? atoi(argv[2]) : DATA_UPDATE_RATE_HZ;
+    const uint64_t rates[] = {10000, 100000, 1000000, 0};
+
+    if (seconds < 1) seconds = 1;
+    if (consumer_hz < 1) consumer_hz = 1;
+
+    printf("=== Signal Ingest Ring Benchmark ===\n");
+    printf("Capacity: %d, Batch: %d, Consumer: %d Hz, Duration: %d s\n\n",
+           SIGNAL_RING_CAPACITY, SIGNAL_INGEST_BATCH, consumer_hz, seconds);
+    printf("%-11s | %7s | %12s | %12s | %10s | %8s | %7s | %6s | %s\n",
+           "Policy", "Offered", "Pushed/s", "Consumed/s", "Dropped",
+           "ns/push", "Backlog", "Order", "Check");
+
+    for (int policy = 0; policy < SIGNAL_RING_POLICY_COUNT; policy++) {
+        for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+            run_case((signal_ring_policy_t)policy, rates[i], seconds, (uint32_t)consumer_hz);
+        }
+    }
+
+    return 0;
+}
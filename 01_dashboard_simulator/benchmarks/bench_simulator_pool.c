@@ -0,0 +1,77 @@
+/**
+ * QNX Dashboard Simulator - Simulator Pool Scaling Benchmark
+ *
+ * Runs the same set of simulators with 1, 2, 4, ... workers up to the
+ * online CPU count and reports throughput and parallel efficiency. A
+ * pooled simulator must end in exactly the state of an identically seeded
+ * simulator updated alone, which fails if any model state is shared.
+ *
+ * Usage: bench_simulator_pool [simulators] [steps] [max_workers]
+ */
+
+#include "../include/simulator_pool.h"
+#include "../include/data_simulator.h"
+
+#define BENCH_DT       0.01f
+#define BENCH_BATCHES  10
+
+static bool same_state(const data_simulator_t *a, const data_simulator_t *b) {
+    const vehicle_data_t *x = &a->current_data;
+    const vehicle_data_t *y = &b->current_data;
+    return x->speed_kmh == y->speed_kmh && x->rpm == y->rpm &&
+           x->fuel_level == y->fuel_level && x->engine_temp == y->engine_temp &&
+           x->oil_pressure == y->oil_pressure && x->gear_position == y->gear_position &&
+           a->target_speed == b->target_speed &&
+           memcmp(&a->rng, &b->rng, sizeof(rng_t)) == 0 &&
+           memcmp(&a->noise_rng, &b->noise_rng, sizeof(rng_lanes_t)) == 0;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t simulators = argc > 1 ? (uint32_t)atoi(argv[1]) : 1024;
+    uint32_t steps = argc > 2 ? (uint32_t)atoi(argv[2]) : 200;
+    uint32_t max_workers = argc > 3 ? (uint32_t)atoi(argv[3]) : simulator_pool_default_workers();
+    double baseline = 0.0;
+    bool ok = true;
+    
+    printf("=== Simulator Pool Scaling Benchmark ===\n");
+    printf("Simulators: %u, steps per batch: %u, batches: %d, CPUs: %u\n\n",
+           simulators, steps, BENCH_BATCHES, simulator_pool_default_workers());
+    printf("%8s %16s %10s %11s\n", "workers", "updates/s", "speedup", "efficiency");
+    
+    if (max_workers < 1) max_workers = 1;
+    if (max_workers > SIMULATOR_POOL_MAX_WORKERS) max_workers = SIMULATOR_POOL_MAX_WORKERS;
+    
+    for (uint32_t workers = 1;; workers *= 2) {
+        if (workers > max_workers) workers = max_workers;
+        simulator_pool_t pool;
+        if (simulator_pool_init(&pool, simulators, workers) != 0) return 1;
+        
+        for (int batch = 0; batch < BENCH_BATCHES; batch++) {
+            simulator_pool_run(&pool, BENCH_DT, steps);
+        }
+        
+        double rate = (double)pool.simulator_updates * 1e9 / (double)pool.run_time_ns;
+        if (workers == 1) baseline = rate;
+        printf("%8u %14.2fM %9.2fx %10.0f%%\n", workers, rate / 1e6, rate / baseline,
+               100.0 * rate / baseline / workers);
+        
+        /* Spot-check isolation against standalone instances */
+        for (uint32_t i = 0; i < simulators; i += simulators / 8 + 1) {
+            data_simulator_t alone;
+            data_simulator_reset(&alone, i + 1);
+            for (uint32_t step = 0; step < steps * BENCH_BATCHES; step++) {
+                data_simulator_update(&alone, BENCH_DT);
+            }
+            if (!same_state(&alone, simulator_pool_get(&pool, i))) {
+                printf("Simulator %u diverged from its standalone run\n", i);
+                ok = false;
+            }
+        }
+        
+        simulator_pool_destroy(&pool);
+        if (workers == max_workers) break;
+    }
+    
+    printf("\nIsolation check: %s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
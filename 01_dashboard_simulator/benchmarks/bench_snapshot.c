@@ -0,0 +1,173 @@
+/**
+ * QNX Dashboard Simulator - Snapshot Contention Benchmark
+ *
+ * Compares the original data_mutex hand-off (writer holds the lock for the
+ * whole physics update, readers lock to copy) against the lock-free
+ * vehicle snapshot. Reports reader copy latency and writer throughput.
+ *
+ * Usage: bench_snapshot [readers] [seconds] [physics_us]
+ */
+
+#include "../include/vehicle_snapshot.h"
+
+typedef enum {
+    BENCH_MODE_MUTEX = 0,
+    BENCH_MODE_SNAPSHOT,
+    BENCH_MODE_COUNT
+} bench_mode_t;
+
+typedef struct {
+    bench_mode_t mode;
+    volatile int running;
+    uint32_t physics_us;
+
+    pthread_mutex_t mutex;
+    vehicle_data_t shared_data;
+    vehicle_snapshot_t snapshot;
+
+    uint64_t writer_updates;
+    uint64_t writer_max_ns;
+} bench_context_t;
+
+typedef struct {
+    bench_context_t *ctx;
+    uint64_t reads;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t retries;
+    float checksum;
+} bench_reader_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Stand-in for data_simulator_update(): burn physics_us of CPU */
+static void simulate_physics(vehicle_data_t *data, uint32_t physics_us) {
+    uint64_t end = now_ns() + (uint64_t)physics_us * 1000ULL;
+    while (now_ns() < end) {
+        data->speed_kmh += 0.001f;
+        data->rpm = data->speed_kmh * 30.0f;
+    }
+}
+
+static void *writer_main(void *arg) {
+    bench_context_t *ctx = (bench_context_t *)arg;
+    vehicle_data_t local = {0};
+
+    while (ctx->running) {
+        uint64_t start = now_ns();
+
+        if (ctx->mode == BENCH_MODE_MUTEX) {
+            pthread_mutex_lock(&ctx->mutex);
+            simulate_physics(&ctx->shared_data, ctx->physics_us);
+            pthread_mutex_unlock(&ctx->mutex);
+        } else {
+            simulate_physics(&local, ctx->physics_us);
+            vehicle_snapshot_publish(&ctx->snapshot, &local);
+        }
+
+        uint64_t elapsed = now_ns() - start;
+        if (elapsed > ctx->writer_max_ns) ctx->writer_max_ns = elapsed;
+        ctx->writer_updates++;
+    }
+    return NULL;
+}
+
+static void *reader_main(void *arg) {
+    bench_reader_t *reader = (bench_reader_t *)arg;
+    bench_context_t *ctx = reader->ctx;
+    vehicle_data_t copy;
+
+    while (ctx->running) {
+        uint64_t start = now_ns();
+
+        if (ctx->mode == BENCH_MODE_MUTEX) {
+            pthread_mutex_lock(&ctx->mutex);
+            copy = ctx->shared_data;
+            pthread_mutex_unlock(&ctx->mutex);
+        } else {
+            reader->retries += vehicle_snapshot_read(&ctx->snapshot, &copy);
+        }
+
+        uint64_t elapsed = now_ns() - start;
+        reader->total_ns += elapsed;
+        if (elapsed > reader->max_ns) reader->max_ns = elapsed;
+        reader->reads++;
+        reader->checksum += copy.speed_kmh;
+    }
+    return NULL;
+}
+
+static void run_mode(bench_mode_t mode, int reader_count, int seconds, uint32_t physics_us) {
+    bench_context_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.mode = mode;
+    ctx.running = 1;
+    ctx.physics_us = physics_us;
+    pthread_mutex_init(&ctx.mutex, NULL);
+    vehicle_snapshot_init(&ctx.snapshot, &ctx.shared_data);
+
+    bench_reader_t *readers = calloc((size_t)reader_count, sizeof(bench_reader_t));
+    pthread_t *reader_threads = calloc((size_t)reader_count, sizeof(pthread_t));
+    pthread_t writer_thread;
+    if (!readers || !reader_threads) {
+        fprintf(stderr, "Error: Out of memory\n");
+        exit(1);
+    }
+
+    pthread_create(&writer_thread, NULL, writer_main, &ctx);
+    for (int i = 0; i < reader_count; i++) {
+        readers[i].ctx = &ctx;
+        pthread_create(&reader_threads[i], NULL, reader_main, &readers[i]);
+    }
+
+    sleep((unsigned int)seconds);
+    ctx.running = 0;
+
+    pthread_join(writer_thread, NULL);
+    uint64_t reads = 0, total_ns = 0, max_ns = 0, retries = 0;
+    for (int i = 0; i < reader_count; i++) {
+        pthread_join(reader_threads[i], NULL);
+        reads += readers[i].reads;
+        total_ns += readers[i].total_ns;
+        retries += readers[i].retries;
+        if (readers[i].max_ns > max_ns) max_ns = readers[i].max_ns;
+    }
+
+    printf("%-9s | %12.0f | %10.1f | %12.1f | %10.0f | %10.1f | %llu\n",
+           mode == BENCH_MODE_MUTEX ? "mutex" : "snapshot",
+           (double)reads / seconds,
+           reads ? (double)total_ns / (double)reads : 0.0,
+           (double)max_ns / 1000.0,
+           (double)ctx.writer_updates / seconds,
+           (double)ctx.writer_max_ns / 1000.0,
+           (unsigned long long)retries);
+
+    pthread_mutex_destroy(&ctx.mutex);
+    free(readers);
+    free(reader_threads);
+}
+
+int main(int argc, char *argv[]) {
+    int reader_count = argc > 1 ? atoi(argv[1]) : 2;
+    int seconds = argc > 2 ? atoi(argv[2]) : 2;
+    uint32_t physics_us = argc > 3 ? (uint32_t)atoi(argv[3]) : 200;
+
+    if (reader_count < 1) reader_count = 1;
+    if (seconds < 1) seconds = 1;
+
+    printf("=== Snapshot Contention Benchmark ===\n");
+    printf("Readers: %d, Duration: %d s, Physics: %u us per update\n\n",
+           reader_count, seconds, physics_us);
+    printf("%-9s | %12s | %10s | %12s | %10s | %10s | %s\n",
+           "Mode", "Reads/s", "Avg ns", "Max read us", "Writes/s", "Max wr us", "Retries");
+
+    for (int mode = 0; mode < BENCH_MODE_COUNT; mode++) {
+        run_mode((bench_mode_t)mode, reader_count, seconds, physics_us);
+    }
+
+    return 0;
+}
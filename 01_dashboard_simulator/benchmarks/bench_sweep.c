@@ -0,0 +1,66 @@
+/**
+ * QNX Dashboard Simulator - Parameter Sweep Scaling Benchmark
+ *
+ * Runs the same Monte-Carlo sweep with 1, 2, 4, ... workers up to the
+ * online CPU count and reports runs per second, real-time factor and
+ * parallel efficiency. Each run depends only on the seed and its index,
+ * so every worker count must produce byte-identical results.
+ *
+ * Usage: bench_sweep [runs] [duration_s] [max_workers]
+ */
+
+#include "../include/sweep.h"
+#include "../include/simulator_pool.h"
+
+int main(int argc, char *argv[]) {
+    uint32_t runs = argc > 1 ? (uint32_t)atoi(argv[1]) : 64;
+    float duration_s = argc > 2 ? (float)atof(argv[2]) : 60.0f;
+    uint32_t max_workers = argc > 3 ? (uint32_t)atoi(argv[3]) : simulator_pool_default_workers();
+    sweep_result_t *reference = NULL;
+    double baseline = 0.0;
+    bool ok = true;
+    
+    if (runs < 1) runs = 1;
+    if (max_workers < 1) max_workers = 1;
+    if (max_workers > SWEEP_MAX_WORKERS) max_workers = SWEEP_MAX_WORKERS;
+    
+    printf("=== Parameter Sweep Scaling Benchmark ===\n");
+    printf("Runs: %u x %.0f s simulated, CPUs: %u\n\n", runs, duration_s,
+           simulator_pool_default_workers());
+    printf("%8s %10s %14s %10s %11s\n", "workers", "runs/s", "x real time", "speedup", "efficiency");
+    
+    for (uint32_t workers = 1;; workers *= 2) {
+        if (workers > max_workers) workers = max_workers;
+        sweep_t sweep;
+        sweep_init(&sweep, runs);
+        sweep.duration_s = duration_s;
+        sweep.worker_count = workers;
+        if (sweep_run(&sweep) != 0) return 1;
+        
+        double wall_s = (double)sweep.wall_time_ns / 1e9;
+        double rate = runs / wall_s;
+        if (workers == 1) baseline = rate;
+        printf("%8u %10.1f %13.0fx %9.2fx %10.0f%%\n", sweep.worker_count, rate,
+               rate * duration_s, rate / baseline, 100.0 * rate / baseline / workers);
+        
+        if (!reference) {
+            reference = sweep.results;
+            sweep.results = NULL;
+        } else if (memcmp(reference, sweep.results, runs * sizeof(sweep_result_t)) != 0) {
+            printf("Results with %u workers differ from the single-worker sweep\n", workers);
+            ok = false;
+        }
+        
+        if (workers == max_workers) {
+            printf("\n");
+            sweep.results = reference;
+            sweep_print_summary(&sweep);
+            reference = NULL;
+        }
+        sweep_free(&sweep);
+        if (workers == max_workers) break;
+    }
+    
+    printf("\nDeterminism check: %s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
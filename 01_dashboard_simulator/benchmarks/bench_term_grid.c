@@ -0,0 +1,320 @@
+/**
+ * QNX Dashboard Simulator - Terminal Renderer Benchmark
+ *
+ * Renders the same sequence of dashboard frames four ways: the original
+ * clear-screen-and-printf() repaint through line-buffered stdio, a full
+ * cell-grid repaint every frame, the cell grid's diff of a redrawn frame,
+ * and the diff of a prebuilt layout with only its value slots patched.
+ * Output goes to /dev/null so the numbers are encode cost, bytes and
+ * write() calls per frame; on a serial console the bytes dominate.
+ *
+ * Usage: bench_term_grid [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/term_grid.h"
+
+#define BENCH_ROWS      16
+#define BENCH_COLS      78
+#define BENCH_SEGMENTS  20
+
+typedef struct {
+    float values[4];
+    int gear;
+    int warnings;
+    float fps;
+} bench_frame_t;
+
+static const char *g_labels[4] = { "SPEED (km/h)", "RPM         ", "FUEL (%)    ", "TEMP (°C)   " };
+static const float g_max_values[4] = { 200.0f, 8000.0f, 100.0f, 120.0f };
+static const int g_colors[4] = { TERM_CYAN, TERM_MAGENTA, TERM_BLUE, TERM_RED };
+static const char *g_warning_names[4] = { "LOW FUEL    ", "HIGH TEMP   ", "HIGH RPM    ", "SPEED LIMIT " };
+
+static void grid_draw_warnings(term_grid_t *grid, int warnings);
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Drive cycle sampled at 30 Hz, as gui_dashboard renders it
+ */
+static void make_frames(bench_frame_t *frames, int count) {
+    float velocity = 0.0f;
+    
+    for (int i = 0; i < count; i++) {
+        float t = i * (1.0f / 30.0f);
+        velocity += (2.0f * sinf(t * 0.05f) + 0.5f * sinf(t * 0.1f)) / 30.0f;
+        if (velocity < 0.0f) velocity = 0.0f;
+        
+        bench_frame_t *frame = &frames[i];
+        frame->values[0] = velocity;
+        frame->values[1] = 800.0f + velocity * 45.0f + 500.0f * sinf(t * 0.2f);
+        frame->values[2] = 85.0f - t * 0.008f;
+        frame->values[3] = 85.0f + 8.0f * sinf(t * 0.03f) + velocity * 0.1f;
+        frame->gear = (int)(velocity / 25.0f) + 1;
+        frame->warnings = frame->values[1] > 6500.0f ? 0x04 : 0;
+        frame->fps = 29.5f + 0.5f * sinf(t);
+    }
+}
+
+/**
+ * Original approach: clear the screen and printf() everything
+ */
+static size_t legacy_render(FILE *out, const bench_frame_t *frame) {
+    static const char *colors[8] = { "\033[30m", "\033[31m", "\033[32m", "\033[33m",
+                                     "\033[34m", "\033[35m", "\033[36m", "\033[37m" };
+    int bytes = fprintf(out, "\033[2J\033[H");
+    
+    bytes += fprintf(out, "\033[44m\033[37m\033[1m");
+    bytes += fprintf(out, "╔════════════════════════════════════════════════════════════════════════════╗\n");
+    bytes += fprintf(out, "║                    🚗 QNX AUTOMOTIVE DASHBOARD v1.0 🚗                    ║\n");
+    bytes += fprintf(out, "╚════════════════════════════════════════════════════════════════════════════╝");
+    bytes += fprintf(out, "\033[0m\n\n");
+    bytes += fprintf(out, "\033[36m\033[1m┌─ PRIMARY INSTRUMENTS ──────────────────────────────────────────────────────┐\n\033[0m");
+    
+    for (int g = 0; g < 4; g++) {
+        const char *color = colors[g_colors[g]];
+        int filled = (int)(frame->values[g] / g_max_values[g] * BENCH_SEGMENTS);
+        bytes += fprintf(out, "│ ");
+        bytes += fprintf(out, "%s%s%s: %6.1f ", color, "\033[1m", g_labels[g], frame->values[g]);
+        bytes += fprintf(out, "[");
+        for (int i = 0; i < BENCH_SEGMENTS; i++) {
+            if (i < filled) {
+                if (i < BENCH_SEGMENTS * 0.6) bytes += fprintf(out, "%s●%s", colors[TERM_GREEN], color);
+                else if (i < BENCH_SEGMENTS * 0.8) bytes += fprintf(out, "%s●%s", colors[TERM_YELLOW], color);
+                else bytes += fprintf(out, "%s●%s", colors[TERM_RED], color);
+            } else {
+                bytes += fprintf(out, "○");
+            }
+        }
+        bytes += fprintf(out, "]%s\n", "\033[0m");
+    }
+    bytes += fprintf(out, "└────────────────────────────────────────────────────────────────────────────┘\n\n");
+    
+    bytes += fprintf(out, "│ %sGEAR:%s %s%d%s     ", colors[TERM_YELLOW], "\033[0m", "\033[1m", frame->gear, "\033[0m");
+    bytes += fprintf(out, "%sFPS:%s %s%.1f%s\n", colors[TERM_CYAN], "\033[0m", "\033[1m", frame->fps, "\033[0m");
+    bytes += fprintf(out, "│");
+    for (int w = 0; w < 4; w++) {
+        if (frame->warnings & (1 << w)) {
+            bytes += fprintf(out, "  \033[41m\033[37m\033[1m ! %s\033[0m", g_warning_names[w]);
+        } else {
+            bytes += fprintf(out, "  \033[33m○ %s\033[0m", g_warning_names[w]);
+        }
+    }
+    bytes += fprintf(out, "\n");
+    return (size_t)bytes;
+}
+
+/**
+ * Same content drawn into the cell grid
+ */
+static void grid_draw(term_grid_t *grid, const bench_frame_t *frame) {
+    uint16_t title = TERM_ATTR(TERM_WHITE, TERM_BLUE, TERM_BOLD);
+    
+    term_grid_clear(grid, TERM_ATTR_NORMAL);
+    term_grid_put(grid, 0, 0, title, "╔");
+    term_grid_fill(grid, 0, 1, BENCH_COLS - 2, title, "═");
+    term_grid_put(grid, 0, BENCH_COLS - 1, title, "╗");
+    term_grid_fill(grid, 1, 0, BENCH_COLS, title, " ");
+    term_grid_put(grid, 1, 0, title, "║");
+    term_grid_put(grid, 1, 20, title, "🚗 QNX AUTOMOTIVE DASHBOARD v1.0 🚗");
+    term_grid_put(grid, 1, BENCH_COLS - 1, title, "║");
+    term_grid_put(grid, 2, 0, title, "╚");
+    term_grid_fill(grid, 2, 1, BENCH_COLS - 2, title, "═");
+    term_grid_put(grid, 2, BENCH_COLS - 1, title, "╝");
+    
+    uint16_t cyan = TERM_ATTR(TERM_CYAN, TERM_DEFAULT, TERM_BOLD);
+    int col = term_grid_put(grid, 4, 0, cyan, "┌─ PRIMARY INSTRUMENTS ");
+    term_grid_fill(grid, 4, col, BENCH_COLS - 1 - col, cyan, "─");
+    term_grid_put(grid, 4, BENCH_COLS - 1, cyan, "┐");
+    
+    for (int g = 0; g < 4; g++) {
+        int row = 5 + g;
+        uint16_t attr = TERM_ATTR(g_colors[g], TERM_DEFAULT, TERM_BOLD);
+        int filled = (int)(frame->values[g] / g_max_values[g] * BENCH_SEGMENTS);
+        
+        term_grid_put(grid, row, 0, TERM_ATTR_NORMAL, "│");
+        col = term_grid_printf(grid, row, 2, attr, "%s: %6.1f [", g_labels[g], frame->values[g]);
+        for (int i = 0; i < BENCH_SEGMENTS; i++) {
+            if (i < filled) {
+                int zone = i < BENCH_SEGMENTS * 0.6 ? TERM_GREEN : i < BENCH_SEGMENTS * 0.8 ? TERM_YELLOW : TERM_RED;
+                col = term_grid_put(grid, row, col, TERM_ATTR(zone, TERM_DEFAULT, TERM_BOLD), "●");
+            } else {
+                col = term_grid_put(grid, row, col, attr, "○");
+            }
+        }
+        term_grid_put(grid, row, col, attr, "]");
+        term_grid_put(grid, row, BENCH_COLS - 1, TERM_ATTR_NORMAL, "│");
+    }
+    term_grid_put(grid, 9, 0, TERM_ATTR_NORMAL, "└");
+    term_grid_fill(grid, 9, 1, BENCH_COLS - 2, TERM_ATTR_NORMAL, "─");
+    term_grid_put(grid, 9, BENCH_COLS - 1, TERM_ATTR_NORMAL, "┘");
+    
+    uint16_t bold = TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, TERM_BOLD);
+    col = term_grid_put(grid, 11, 0, TERM_ATTR_NORMAL, "│ ");
+    col = term_grid_put(grid, 11, col, TERM_ATTR(TERM_YELLOW, TERM_DEFAULT, 0), "GEAR: ");
+    term_grid_printf(grid, 11, col, bold, "%d", frame->gear);
+    col = term_grid_put(grid, 11, 14, TERM_ATTR(TERM_CYAN, TERM_DEFAULT, 0), "FPS: ");
+    term_grid_printf(grid, 11, col, bold, "%.1f", frame->fps);
+    
+    grid_draw_warnings(grid, frame->warnings);
+}
+
+/**
+ * Patch the value slots of a grid holding a previously drawn frame
+ */
+static void grid_patch(term_grid_t *grid, const bench_frame_t *frame, const term_cell_t *lit,
+                       const term_cell_t *dark, int *shown_warnings) {
+    uint16_t bold = TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, TERM_BOLD);
+    
+    for (int g = 0; g < 4; g++) {
+        int row = 5 + g;
+        int filled = (int)(frame->values[g] / g_max_values[g] * BENCH_SEGMENTS);
+        
+        term_grid_put_fixed(grid, row, 16, 6, 1, TERM_ATTR(g_colors[g], TERM_DEFAULT, TERM_BOLD),
+                            frame->values[g]);
+        for (int i = 0; i < BENCH_SEGMENTS; i++) {
+            term_grid_put_cell(grid, row, 24 + i, i < filled ? &lit[i] : &dark[g]);
+        }
+    }
+    
+    term_grid_put_uint(grid, 11, 8, 1, bold, (unsigned)frame->gear, false);
+    term_grid_put_fixed(grid, 11, 19, 4, 1, bold, frame->fps);
+    
+    if (frame->warnings != *shown_warnings) {
+        term_grid_fill(grid, 12, 0, BENCH_COLS, TERM_ATTR_NORMAL, " ");
+        grid_draw_warnings(grid, frame->warnings);
+        *shown_warnings = frame->warnings;
+    }
+}
+
+static void grid_draw_warnings(term_grid_t *grid, int warnings) {
+    int col = term_grid_put(grid, 12, 0, TERM_ATTR_NORMAL, "│");
+    for (int w = 0; w < 4; w++) {
+        col = term_grid_put(grid, 12, col, TERM_ATTR_NORMAL, "  ");
+        if (warnings & (1 << w)) {
+            col = term_grid_put(grid, 12, col, TERM_ATTR(TERM_WHITE, TERM_RED, TERM_BOLD), " ! ");
+            col = term_grid_put(grid, 12, col, TERM_ATTR(TERM_WHITE, TERM_RED, TERM_BOLD), g_warning_names[w]);
+        } else {
+            col = term_grid_put(grid, 12, col, TERM_ATTR(TERM_YELLOW, TERM_DEFAULT, 0), "○ ");
+            col = term_grid_put(grid, 12, col, TERM_ATTR(TERM_YELLOW, TERM_DEFAULT, 0), g_warning_names[w]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : 3000;
+    if (count < 1) count = 1;
+    
+    bench_frame_t *frames = malloc((size_t)count * sizeof(bench_frame_t));
+    int fd = open("/dev/null", O_WRONLY);
+    FILE *legacy_out = fdopen(dup(fd), "w");
+    term_grid_t grid;
+    
+    if (!frames || fd < 0 || !legacy_out || term_grid_init(&grid, BENCH_ROWS, BENCH_COLS) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+    
+    /* A terminal stdout is line buffered: one write() per line */
+    setvbuf(legacy_out, NULL, _IOLBF, BUFSIZ);
+    make_frames(frames, count);
+    
+    printf("=== Terminal Renderer Benchmark ===\n");
+    printf("Frames: %d (%.0f s at 30 Hz)\n\n", count, count / 30.0);
+    printf("%-20s %12s %12s %12s\n", "renderer", "bytes/frame", "writes/frame", "us/frame");
+    
+    /* Original repaint */
+    size_t legacy_bytes = 0;
+    uint64_t start_ns = now_ns();
+    for (int i = 0; i < count; i++) {
+        legacy_bytes += legacy_render(legacy_out, &frames[i]);
+    }
+    fflush(legacy_out);
+    double legacy_us = (double)(now_ns() - start_ns) / count / 1000.0;
+    printf("%-20s %12.0f %12d %12.2f\n", "printf repaint", (double)legacy_bytes / count,
+           BENCH_ROWS - 2, legacy_us);
+    
+    /* Cell grid, repainted in full */
+    size_t full_bytes = 0;
+    start_ns = now_ns();
+    for (int i = 0; i < count; i++) {
+        grid_draw(&grid, &frames[i]);
+        term_grid_invalidate(&grid);
+        full_bytes += (size_t)term_grid_flush(&grid, fd);
+    }
+    double full_us = (double)(now_ns() - start_ns) / count / 1000.0;
+    printf("%-20s %12.0f %12d %12.2f\n", "grid full repaint", (double)full_bytes / count, 1, full_us);
+    
+    /* Cell grid diff */
+    size_t diff_bytes = 0;
+    uint64_t diff_frames = 0;
+    term_grid_invalidate(&grid);
+    start_ns = now_ns();
+    for (int i = 0; i < count; i++) {
+        grid_draw(&grid, &frames[i]);
+        ssize_t bytes = term_grid_flush(&grid, fd);
+        diff_bytes += (size_t)bytes;
+        if (bytes > 0) diff_frames++;
+    }
+    double diff_us = (double)(now_ns() - start_ns) / count / 1000.0;
+    printf("%-20s %12.0f %12.2f %12.2f\n", "grid diff", (double)diff_bytes / count,
+           (double)diff_frames / count, diff_us);
+    
+    /* Prebuilt layout, value slots patched */
+    term_cell_t lit[BENCH_SEGMENTS], dark[4];
+    for (int i = 0; i < BENCH_SEGMENTS; i++) {
+        int zone = i < BENCH_SEGMENTS * 0.6 ? TERM_GREEN : i < BENCH_SEGMENTS * 0.8 ? TERM_YELLOW : TERM_RED;
+        term_cell_make(&lit[i], "●", TERM_ATTR(zone, TERM_DEFAULT, TERM_BOLD));
+    }
+    for (int g = 0; g < 4; g++) {
+        term_cell_make(&dark[g], "○", TERM_ATTR(g_colors[g], TERM_DEFAULT, TERM_BOLD));
+    }
+    
+    size_t patch_bytes = 0;
+    int shown_warnings = frames[0].warnings;
+    grid_draw(&grid, &frames[0]);
+    term_grid_invalidate(&grid);
+    start_ns = now_ns();
+    for (int i = 0; i < count; i++) {
+        grid_patch(&grid, &frames[i], lit, dark, &shown_warnings);
+        patch_bytes += (size_t)term_grid_flush(&grid, fd);
+    }
+    double patch_us = (double)(now_ns() - start_ns) / count / 1000.0;
+    printf("%-20s %12.0f %12.2f %12.2f\n", "template patch", (double)patch_bytes / count,
+           (double)diff_frames / count, patch_us);
+    
+    /* Patching must produce exactly the redrawn frame */
+    term_grid_t reference;
+    bool same = term_grid_init(&reference, BENCH_ROWS, BENCH_COLS) == 0;
+    shown_warnings = frames[0].warnings;
+    grid_draw(&grid, &frames[0]);
+    for (int i = 0; i < count && same; i++) {
+        grid_patch(&grid, &frames[i], lit, dark, &shown_warnings);
+        grid_draw(&reference, &frames[i]);
+        same = memcmp(grid.back, reference.back,
+                      (size_t)BENCH_ROWS * BENCH_COLS * sizeof(term_cell_t)) == 0;
+    }
+    term_grid_free(&reference);
+    
+    printf("\nBytes per frame reduced %.0fx against the printf repaint\n",
+           patch_bytes ? (double)legacy_bytes / patch_bytes : 0.0);
+    printf("At 115200 baud: %.1f ms/frame before, %.2f ms/frame after\n",
+           (double)legacy_bytes / count * 10.0 / 115.2, (double)patch_bytes / count * 10.0 / 115.2);
+    printf("Template matches full redraw: %s\n", same ? "ok" : "FAIL");
+    
+    term_grid_free(&grid);
+    fclose(legacy_out);
+    close(fd);
+    free(frames);
+    return same ? 0 : 1;
+}
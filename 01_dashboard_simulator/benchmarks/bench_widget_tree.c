@@ -0,0 +1,280 @@
+/**
+ * QNX Dashboard Simulator - Widget Tree Benchmark
+ *
+ * Loads a full digital cluster layout (50+ widgets) and times
+ * gui_manager_update() (damage tracking) and gui_manager_render() per
+ * frame while 0, 1, 2, 4 or all signals change, then repeats one changing
+ * signal on generated layouts of growing size. Update and render cost
+ * should follow the number of changed signals and stay flat as widgets
+ * are added. Animations and the visual epsilon are off so every run draws
+ * the same frames, and dirty-rectangle frames are checked pixel for pixel
+ * against full repaints. The last frame can be saved as a PPM image.
+ *
+ * Usage: bench_widget_tree [layout.json] [frames] [snapshot.ppm]
+ */
+
+#include "../include/gui_manager.h"
+#include "../include/framebuffer.h"
+#include "../include/widget_tree.h"
+#include "../include/signal_ring.h"
+
+#define GRID_CELL_WIDTH   96
+#define GRID_CELL_HEIGHT  36
+
+static const int WIDGET_COUNTS[] = {16, 64, 128, 384};
+
+#define WIDGET_COUNT_STEPS (sizeof(WIDGET_COUNTS) / sizeof(WIDGET_COUNTS[0]))
+
+/* gui_manager_handle_events() may request a shutdown; nothing to stop here */
+void dashboard_shutdown(void) {
+}
+
+static void set_signal(vehicle_data_t *data, int signal, float value) {
+    switch ((signal_id_t)signal) {
+        case SIGNAL_SPEED_KMH:          data->speed_kmh = value; break;
+        case SIGNAL_RPM:                data->rpm = value; break;
+        case SIGNAL_ACCELERATION:       data->acceleration = value; break;
+        case SIGNAL_FUEL_LEVEL:         data->fuel_level = value; break;
+        case SIGNAL_ENGINE_TEMP:        data->engine_temp = value; break;
+        case SIGNAL_OIL_PRESSURE:       data->oil_pressure = value; break;
+        case SIGNAL_BATTERY_VOLTAGE:    data->battery_voltage = value; break;
+        case SIGNAL_ALTERNATOR_CURRENT: data->alternator_current = value; break;
+        case SIGNAL_GEAR_POSITION:      data->gear_position = (int)value; break;
+        case SIGNAL_IGNITION_ON:        data->ignition_on = value != 0.0f; break;
+        case SIGNAL_ENGINE_RUNNING:     data->engine_running = value != 0.0f; break;
+        case SIGNAL_PARKING_BRAKE:      data->parking_brake = value != 0.0f; break;
+        case SIGNAL_SEATBELT_FASTENED:  data->seatbelt_fastened = value != 0.0f; break;
+        default: break;
+    }
+}
+
+/**
+ * Cruise state with the first changing signals moving every frame
+ */
+static void make_sample(int frame, int changing, vehicle_data_t *data) {
+    static const float BASE[SIGNAL_COUNT] = {
+        100.0f, 2400.0f, 0.0f, 60.0f, 90.0f, 40.0f, 13.8f, 30.0f, 5.0f, 1.0f, 1.0f, 0.0f, 1.0f
+    };
+    static const float SWING[SIGNAL_COUNT] = {
+        60.0f, 2000.0f, 3.0f, 40.0f, 30.0f, 35.0f, 2.5f, 30.0f, 5.0f, 1.0f, 1.0f, 1.0f, 1.0f
+    };
+    float t = frame * (1.0f / GUI_UPDATE_RATE_HZ);
+
+    memset(data, 0, sizeof(vehicle_data_t));
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        float value = BASE[signal];
+        if (signal < changing) {
+            value += SWING[signal] * sinf(t * (1.0f + 0.3f * signal));
+            if (signal >= SIGNAL_GEAR_POSITION) {
+                /* Gear and flags step rather than glide */
+                value = (float)((frame / 20 + signal) % (signal == SIGNAL_GEAR_POSITION ? 8 : 2)) -
+                        (signal == SIGNAL_GEAR_POSITION ? 1.0f : 0.0f);
+            }
+        }
+        set_signal(data, signal, value);
+    }
+}
+
+/**
+ * A speed dial plus count - 1 readouts and bars on the other signals,
+ * grouped by grid row
+ */
+static char *make_grid_layout(int count, int width, int height) {
+    size_t capacity = 256 + (size_t)count * 320;
+    char *json = malloc(capacity);
+    if (!json) return NULL;
+
+    int columns = width / GRID_CELL_WIDTH;
+    size_t length = (size_t)snprintf(json, capacity,
+        "{\"name\": \"grid_%d\", \"width\": %d, \"height\": %d, \"widgets\": [\n"
+        "{\"type\": \"dial\", \"label\": \"SPEED\", \"signal\": \"speed_kmh\", \"x\": 0, \"y\": 0, "
+        "\"size\": %d, \"min\": 0, \"max\": 300}",
+        count, width, height, 4 * GRID_CELL_HEIGHT);
+
+    int cell = 0, row = -1;
+    for (int i = 1; i < count; i++, cell++) {
+        /* The dial covers the first two columns of the first four rows */
+        while (cell % columns < 2 && cell / columns < 4) cell++;
+        if ((cell / columns + 1) * GRID_CELL_HEIGHT > height) break;
+        if (cell / columns != row) {
+            row = cell / columns;
+            length += (size_t)snprintf(json + length, capacity - length,
+                "%s,\n{\"type\": \"group\", \"x\": 0, \"y\": %d, \"children\": [\n",
+                i > 1 ? "]}" : "", row * GRID_CELL_HEIGHT);
+        } else {
+            length += (size_t)snprintf(json + length, capacity - length, ",\n");
+        }
+        const char *signal = signal_id_to_string((signal_id_t)(1 + (i % (SIGNAL_COUNT - 1))));
+        length += (size_t)snprintf(json + length, capacity - length,
+            "{\"type\": \"%s\", \"label\": \"W%d\", \"signal\": \"%s\", \"x\": %d, \"y\": 0, "
+            "\"width\": %d, \"height\": %d, \"min\": -100, \"max\": 10000}",
+            i % 2 ? "readout" : "bar", i, signal, (cell % columns) * GRID_CELL_WIDTH,
+            GRID_CELL_WIDTH - 4, GRID_CELL_HEIGHT - 4);
+    }
+    snprintf(json + length, capacity - length, "%s\n]}\n", row >= 0 ? "]}" : "");
+    return json;
+}
+
+typedef struct {
+    double update_us;
+    double render_us;
+    double refreshed;
+    double damaged;
+    double pixels;
+} frame_cost_t;
+
+/**
+ * Average per-frame cost of count frames with changing signals moving
+ */
+static frame_cost_t run_frames(gui_manager_t *gui, int count, int changing) {
+    widget_tree_t *tree = &gui->widgets;
+    vehicle_data_t data;
+    frame_cost_t cost;
+    uint64_t update_ns = 0, render_ns = 0;
+
+    /* Settle on the cruise state first */
+    make_sample(0, 0, &data);
+    gui_manager_update(gui, &data);
+    gui_manager_render(gui);
+
+    uint64_t refreshed = tree->nodes_refreshed;
+    uint64_t damaged = tree->nodes_damaged;
+    uint64_t pixels = gui->pixels_redrawn;
+
+    for (int i = 0; i < count; i++) {
+        make_sample(i + 1, changing, &data);
+        uint64_t start = get_timestamp_ns();
+        gui_manager_update(gui, &data);
+        uint64_t rendered = get_timestamp_ns();
+        gui_manager_render(gui);
+        uint64_t end = get_timestamp_ns();
+        update_ns += rendered - start;
+        render_ns += end - rendered;
+    }
+
+    cost.update_us = (double)update_ns / count / 1e3;
+    cost.render_us = (double)render_ns / count / 1e3;
+    cost.refreshed = (double)(tree->nodes_refreshed - refreshed) / count;
+    cost.damaged = (double)(tree->nodes_damaged - damaged) / count;
+    cost.pixels = (double)(gui->pixels_redrawn - pixels) / count;
+    return cost;
+}
+
+static void print_cost(const char *layout, int widgets, const char *changing, const frame_cost_t *cost) {
+    printf("%-14s %8d %9s %10.2f %10.2f %10.1f %9.1f %12.0f\n", layout, widgets, changing,
+           cost->update_us, cost->render_us, cost->refreshed, cost->damaged, cost->pixels);
+}
+
+/**
+ * Dirty-rectangle frames must equal full repaints of the same state
+ */
+static bool verify_dirty_rects(gui_manager_t *gui, gui_manager_t *reference, int count) {
+    framebuffer_t *fb = &gui->framebuffer;
+    framebuffer_t *ref = &reference->framebuffer;
+
+    for (int i = 0; i < count; i++) {
+        vehicle_data_t data;
+        make_sample(i, (i / 60) % (SIGNAL_COUNT + 1), &data);
+        gui_manager_update(gui, &data);
+        gui_manager_update(reference, &data);
+        gui_manager_invalidate(reference);
+        gui_manager_render(gui);
+        gui_manager_render(reference);
+
+        for (int y = 0; y < fb->height; y++) {
+            if (memcmp(fb->pixels + (size_t)y * fb->stride, ref->pixels + (size_t)y * ref->stride,
+                       (size_t)fb->width * sizeof(uint32_t)) != 0) {
+                printf("Frame %d differs from a full repaint at row %d\n", i, y);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Initialize gui with a layout file (or JSON text) at its design size
+ */
+static int setup(gui_manager_t *gui, const char *filename, const char *json) {
+    widget_tree_t tree;
+    widget_tree_init(&tree);
+    int result = filename ? widget_tree_load(&tree, filename) : widget_tree_parse(&tree, json, strlen(json));
+    int width = tree.design_width > 0 ? tree.design_width : WINDOW_WIDTH;
+    int height = tree.design_height > 0 ? tree.design_height : WINDOW_HEIGHT;
+    widget_tree_free(&tree);
+    if (result != 0) return -1;
+
+    if (gui_manager_initialize(gui) != 0 || gui_manager_resize(gui, width, height) != 0) {
+        return -1;
+    }
+    gui_manager_set_animations(gui, false);
+    gui_manager_set_visual_epsilon(gui, 0.0f);
+
+    if (filename) return gui_manager_load_layout(gui, filename);
+
+    /* Generated layouts go through a temporary file like any other */
+    char path[] = "/tmp/bench_widget_tree_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) return -1;
+    bool written = write(fd, json, strlen(json)) == (ssize_t)strlen(json);
+    close(fd);
+    result = written ? gui_manager_load_layout(gui, path) : -1;
+    unlink(path);
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    const char *layout = argc > 1 && argv[1][0] ? argv[1] : "resources/layouts/full_cluster.json";
+    int count = argc > 2 ? atoi(argv[2]) : 1200;
+    const char *snapshot = argc > 3 && argv[3][0] ? argv[3] : NULL;
+    static const int CHANGING[] = {0, 1, 2, 4, SIGNAL_COUNT};
+    char label[16];
+    bool ok = true;
+
+    if (count < 1) count = 1;
+
+    gui_manager_t *gui = calloc(1, sizeof(gui_manager_t));
+    gui_manager_t *reference = calloc(1, sizeof(gui_manager_t));
+    if (!gui || !reference || setup(gui, layout, NULL) != 0 || setup(reference, layout, NULL) != 0) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+
+    printf("\n=== Widget Tree Benchmark ===\n");
+    printf("Frames: %d per row, animations off\n\n", count);
+    printf("%-14s %8s %9s %10s %10s %10s %9s %12s\n", "layout", "nodes", "changing", "update us",
+           "render us", "refreshed", "damaged", "pixels/frame");
+
+    for (size_t c = 0; c < sizeof(CHANGING) / sizeof(CHANGING[0]); c++) {
+        frame_cost_t cost = run_frames(gui, count, CHANGING[c]);
+        snprintf(label, sizeof(label), CHANGING[c] == SIGNAL_COUNT ? "all" : "%d", CHANGING[c]);
+        print_cost(gui->widgets.name, gui->widgets.count, label, &cost);
+    }
+
+    if (snapshot && framebuffer_write_ppm(&gui->framebuffer, snapshot) == 0) {
+        printf("\nLast frame written to %s\n", snapshot);
+    }
+
+    ok = verify_dirty_rects(gui, reference, count < 1000 ? count : 1000);
+    printf("\nDirty rectangles match full repaint: %s\n\n", ok ? "ok" : "FAIL");
+    gui_manager_cleanup(reference);
+    gui_manager_cleanup(gui);
+
+    /* One changing signal (speed) on ever larger layouts */
+    for (size_t s = 0; s < WIDGET_COUNT_STEPS; s++) {
+        char *json = make_grid_layout(WIDGET_COUNTS[s], 1920, 720);
+        if (!json || setup(gui, NULL, json) != 0) {
+            fprintf(stderr, "Setup failed for %d widgets\n", WIDGET_COUNTS[s]);
+            free(json);
+            return 1;
+        }
+        frame_cost_t cost = run_frames(gui, count, 1);
+        print_cost(gui->widgets.name, gui->widgets.count, "1", &cost);
+        gui_manager_cleanup(gui);
+        free(json);
+    }
+
+    free(reference);
+    free(gui);
+    return ok ? 0 : 1;
+}
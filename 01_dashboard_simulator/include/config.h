@@ -17,6 +17,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
 
 /* ===============================================================================
  * Configuration Constants
@@ -28,6 +29,8 @@
 #define MAX_CONFIG_KEY_LENGTH     64
 #define MAX_CONFIG_VALUE_LENGTH   256
 #define MAX_CONFIG_SECTION_LENGTH 64
+#define CONFIG_FILE_VERSION       "1.0.0"
+#define CONFIG_FORMAT_VERSION     1
 
 /* Configuration Sections */
 #define CONFIG_SECTION_DISPLAY    "display"
@@ -45,6 +48,7 @@
 #define DEFAULT_DATA_RATE_HZ      100
 #define DEFAULT_THEME             "automotive"
 #define DEFAULT_SIM_MODE          "realistic"
+#define DEFAULT_MAX_CPU_PERCENT   80.0f
 
 /* ===============================================================================
  * Configuration Enumerations
@@ -100,6 +104,7 @@ typedef struct {
     float brightness;
     char theme_name[MAX_CONFIG_VALUE_LENGTH];
     bool hardware_acceleration;
+    char layout_file[MAX_CONFIG_VALUE_LENGTH];   /* Widget layout JSON; empty = built-in */
 } display_config_t;
 
 /**
@@ -113,6 +118,28 @@ typedef struct {
     bool enable_statistics;
     int max_memory_usage_mb;
     float max_cpu_usage_percent;
+    float max_data_latency_ms;         /* Sensor-to-display budget */
+    char gui_deadline_policy[16];      /* "skip" or "catch_up" */
+    char data_deadline_policy[16];
+    char monitor_deadline_policy[16];
+    
+    /* GUI frame scheduling */
+    bool adaptive_frame_rate;          /* Skip still frames, slow down under load */
+    int min_gui_rate_hz;               /* Lowest rate under load */
+    int idle_gui_rate_hz;              /* Polling rate while nothing moves */
+    float visual_epsilon_px;           /* Gauge travel too small to redraw */
+    
+    /* Real-time thread placement */
+    char gui_thread_policy[16];        /* "fifo", "rr" or "other" */
+    char data_thread_policy[16];
+    char monitor_thread_policy[16];
+    int gui_thread_priority;
+    int data_thread_priority;
+    int monitor_thread_priority;
+    int gui_thread_cpu;                /* -1 = any CPU */
+    int data_thread_cpu;
+    int monitor_thread_cpu;
+    bool lock_memory;
 } performance_config_t;
 
 /**
@@ -126,6 +153,10 @@ typedef struct {
     char scenario_file[MAX_CONFIG_VALUE_LENGTH];
     bool loop_scenarios;
     float simulation_speed;
+    char ingest_overflow_policy[16];   /* "drop_oldest" or "drop_newest" */
+    bool enable_recording;
+    char record_file[MAX_CONFIG_VALUE_LENGTH];
+    char replay_file[MAX_CONFIG_VALUE_LENGTH];  /* Used when simulation_mode = replay */
 } simulation_config_t;
 
 /**
@@ -153,6 +184,7 @@ typedef struct {
     float gauge_scale_factor;
     bool enable_animations;
     int animation_duration_ms;
+    char animation_curve[16];          /* "spring", "ease_out", "ease_in_out" or "linear" */
 } theme_config_t;
 
 /**
@@ -187,6 +219,10 @@ typedef struct {
     char version[32];
     char last_modified[64];
     int config_format_version;
+    
+    /* File state at the last load, for hot-reloading */
+    time_t file_mtime;
+    long long file_size;
 } dashboard_config_t;
 
 /* ===============================================================================
@@ -297,6 +333,7 @@ void config_watch_for_changes(dashboard_config_t *config);
 "brightness = 1.0\n" \
 "theme_name = automotive\n" \
 "hardware_acceleration = true\n" \
+"layout_file = layouts/classic.json\n" \
 "\n" \
 "[performance]\n" \
 "gui_update_rate_hz = 60\n" \
@@ -306,6 +343,24 @@ void config_watch_for_changes(dashboard_config_t *config);
 "enable_statistics = true\n" \
 "max_memory_usage_mb = 64\n" \
 "max_cpu_usage_percent = 80.0\n" \
+"max_data_latency_ms = 10.0\n" \
+"gui_deadline_policy = skip\n" \
+"data_deadline_policy = catch_up\n" \
+"monitor_deadline_policy = skip\n" \
+"adaptive_frame_rate = true\n" \
+"min_gui_rate_hz = 15\n" \
+"idle_gui_rate_hz = 20\n" \
+"visual_epsilon_px = 2.0\n" \
+"gui_thread_policy = fifo\n" \
+"data_thread_policy = rr\n" \
+"monitor_thread_policy = rr\n" \
+"gui_thread_priority = 63\n" \
+"data_thread_priority = 50\n" \
+"monitor_thread_priority = 30\n" \
+"gui_thread_cpu = -1\n" \
+"data_thread_cpu = -1\n" \
+"monitor_thread_cpu = -1\n" \
+"lock_memory = true\n" \
 "\n" \
 "[simulation]\n" \
 "simulation_mode = realistic\n" \
@@ -315,6 +370,10 @@ void config_watch_for_changes(dashboard_config_t *config);
 "scenario_file = scenarios/default.json\n" \
 "loop_scenarios = true\n" \
 "simulation_speed = 1.0\n" \
+"ingest_overflow_policy = drop_oldest\n" \
+"enable_recording = false\n" \
+"record_file = recordings/drive.qdr\n" \
+"replay_file = recordings/drive.qdr\n" \
 "\n" \
 "[safety]\n" \
 "enable_safety_monitoring = true\n" \
@@ -334,6 +393,7 @@ void config_watch_for_changes(dashboard_config_t *config);
 "gauge_scale_factor = 1.0\n" \
 "enable_animations = true\n" \
 "animation_duration_ms = 250\n" \
+"animation_curve = spring\n" \
 "\n" \
 "[audio]\n" \
 "enable_audio = false\n" \
@@ -22,6 +22,7 @@
 #include <errno.h>
 #include <signal.h>
 #include <pthread.h>
+#include <termios.h>
 #include <time.h>
 #include <math.h>
 #include <sys/time.h>
@@ -29,18 +30,18 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-/* QNX Photon Includes - Disabled for this demo (using ANSI terminal graphics) */
-// #include <Ph.h>  
-// #include <Pt.h>
-// #include <Ap.h>
-// #include <photon/PxImage.h>
-// #include <photon/PgArc.h>
-
-/* For this demo, we use standard terminal interface instead of Photon */
+/* QNX Photon Includes - only with USE_PHOTON; the software framebuffer renders without them */
+#ifdef USE_PHOTON
+#include <Ph.h>
+#include <Pt.h>
+#include <Ap.h>
+#else
+/* Stand-ins for the Photon types the widget structures use */
 typedef void* PtWidget_t;  /* Mock Photon widget type */
 typedef struct { int x, y; } PhPoint_t;
 typedef struct { int w, h; } PhDim_t;
 typedef unsigned int PgColor_t;
+#endif
 
 /* ===============================================================================
  * Project Configuration
@@ -82,6 +83,26 @@ typedef unsigned int PgColor_t;
 #define WINDOW_HEIGHT             768
 #define WINDOW_TITLE              PROJECT_NAME " v" DASHBOARD_VERSION_STRING
 
+/* Software Framebuffer */
+#define FRAMEBUFFER_ROW_ALIGN     16      /* Pixels; every row starts on a cache line */
+#define FRAMEBUFFER_MAX_DIMENSION 8192
+#define GUI_MAX_DIRTY_RECTS       16      /* More damage than this is merged */
+
+/* Tile-Parallel Rendering */
+#define RENDER_POOL_MAX_THREADS   16      /* Including the GUI thread itself */
+#define RENDER_TILE_WIDTH         256     /* FRAMEBUFFER_ROW_ALIGN multiple: tiles never share a line */
+#define RENDER_TILE_HEIGHT        128
+#define RENDER_POOL_MIN_PIXELS    (64 * 1024)  /* Less damage than this is drawn inline */
+
+/* Widget Tree */
+#define WIDGET_ID_LENGTH          32
+#define WIDGET_UNIT_LENGTH        8
+#define WIDGET_NODE_DAMAGE_RECTS  4       /* Per node and frame; more are merged */
+#define LAYOUT_MAX_NODES          1024    /* Per layout file */
+#define LAYOUT_MAX_DEPTH          8       /* Nested groups in a layout file */
+#define LAYOUT_MAX_FILE_BYTES     (1024 * 1024)
+#define LAYOUT_NAME_LENGTH        64
+
 /* Real-Time Performance Settings */
 #define GUI_UPDATE_RATE_HZ        60      /* 60 FPS GUI updates */
 #define DATA_UPDATE_RATE_HZ       100     /* 100 Hz data processing */
@@ -90,12 +111,27 @@ typedef unsigned int PgColor_t;
 #define GUI_UPDATE_INTERVAL_MS    (1000 / GUI_UPDATE_RATE_HZ)
 #define DATA_UPDATE_INTERVAL_MS   (1000 / DATA_UPDATE_RATE_HZ)
 #define MONITOR_UPDATE_INTERVAL_MS (1000 / MONITOR_UPDATE_RATE_HZ)
+#define GUI_MAX_ANIMATION_STEP_S  0.1f    /* Animation step cap after a stalled frame */
+#define GUI_WINDOW_EVENT_POLL_MS  20      /* Photon event dispatch from the main loop */
+
+/* Frame Scheduling */
+#define GUI_VISUAL_EPSILON_PX     2.0f    /* Needle or bar travel too small to redraw */
+#define GUI_IDLE_RATE_HZ          20      /* Polling rate once nothing on screen moves */
+#define GUI_MIN_RATE_HZ           15      /* Lowest frame rate under load */
+
+/* Memory Layout */
+#define CACHE_LINE_SIZE           64      /* Keeps shared state off false-shared lines */
+#define CACHE_ALIGNED             __attribute__((aligned(CACHE_LINE_SIZE)))
 
 /* Thread Priorities (QNX Real-Time) */
 #define GUI_THREAD_PRIORITY       63      /* Highest - Real-time GUI */
 #define DATA_THREAD_PRIORITY      50      /* Medium - Data processing */
 #define MONITOR_THREAD_PRIORITY   30      /* Low - System monitoring */
 
+/* Thread Launch */
+#define RT_PREFAULT_STACK_BYTES   (64 * 1024)  /* Stack touched before the loop starts */
+#define RT_NO_AFFINITY            (-1)
+
 /* Vehicle Data Ranges and Limits */
 #define MIN_SPEED                 0.0f
 #define MAX_SPEED                 300.0f   /* km/h */
@@ -116,12 +152,62 @@ typedef unsigned int PgColor_t;
 
 /* Performance and Safety Thresholds */
 #define MAX_FRAME_TIME_MS         16.67f   /* 60 FPS target */
-#define MAX_DATA_LATENCY_MS       10.0f    /* Data processing limit */
+#define MAX_DATA_LATENCY_MS       10.0f    /* Sensor-to-display budget */
 #define MAX_MEMORY_USAGE_MB       64       /* Memory limit */
 
+/* Data Publication */
+#define VEHICLE_SNAPSHOT_SLOTS    4         /* Power of two; readers retry only if lapped */
+
+/* Signal Ingest */
+#define SIGNAL_RING_CAPACITY      4096      /* Power of two; ~40 ms at 100k samples/s */
+#define SIGNAL_INGEST_BATCH       256       /* Samples copied out per pop */
+
+/* Vehicle Data Recorder */
+#define RECORDER_MAGIC            0x52444451u  /* "QDDR" in little-endian file order */
+#define RECORDER_FORMAT_VERSION   1
+#define RECORDER_RING_CAPACITY    4096      /* Power of two; 4 s of headroom at 1 kHz */
+#define RECORDER_WRITE_BUFFER_BYTES (64 * 1024)
+#define RECORDER_WRITER_PERIOD_MS 20        /* Writer wakes to drain the ring */
+#define RECORDER_FSYNC_INTERVAL_MS 1000
+#define RECORDER_INDEX_MAGIC      0x58494451u  /* "QDIX" */
+#define RECORDER_INDEX_INTERVAL   1024      /* Records per sparse index entry */
+
+/* Scenarios */
+#define SCENARIO_NAME_LENGTH      64
+#define SCENARIO_MAX_FILE_BYTES   (64 * 1024 * 1024)
+
+/* Random Numbers */
+#define RNG_LANES                 8         /* Streams per batch generator; one AVX2 register */
+
+/* Fleet Simulation */
+#define FLEET_ARRAY_ALIGN         16        /* Floats per 64-byte line; pads every SoA array */
+#define FLEET_MAX_VEHICLES        (16 * 1024 * 1024)
+
+/* Simulator Pool */
+#define SIMULATOR_POOL_MAX_WORKERS 64
+#define SIMULATOR_POOL_CHUNK      8         /* Simulators claimed per atomic increment */
+
+/* Parameter Sweeps */
+#define SWEEP_MAX_WORKERS         64
+#define SWEEP_DEFAULT_DURATION_S  120.0f    /* Simulated seconds per run */
+#define SWEEP_LAUNCH_TARGET_KMH   140.0f    /* Held until 100 km/h is reached */
+#define SWEEP_LAUNCH_TIMEOUT_S    60.0f
+
+/* Physics Integration */
+#define PHYSICS_MAX_SUBSTEPS      5         /* Catch-up per tick; older backlog is dropped */
+
+/* Event Loop */
+#define EVENT_LOOP_MAX_SOURCES    8
+#define EVENT_LOOP_MAX_TIMERS     4
+
+/* Latency Histograms (log-linear, ~3% resolution up to 2^40 ns) */
+#define LATENCY_SUB_BUCKET_BITS   6
+#define LATENCY_SUB_BUCKET_HALF   (1 << (LATENCY_SUB_BUCKET_BITS - 1))
+#define LATENCY_MAX_EXPONENT      40
+#define LATENCY_BUCKET_COUNT      ((LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 3) * \
+                                   LATENCY_SUB_BUCKET_HALF)
+
 /* GUI Configuration */
-#define GAUGE_COUNT               4         /* Number of main gauges */
-#define WARNING_LIGHT_COUNT       8         /* Number of warning lights */
 #define MAX_THEME_NAME_LENGTH     32
 #define MAX_CONFIG_VALUE_LENGTH   256
 
@@ -189,6 +275,132 @@ typedef enum {
     WARNING_TYPE_COUNT
 } warning_type_t;
 
+/**
+ * Application threads tracked by the resource monitor
+ */
+typedef enum {
+    APP_THREAD_GUI = 0,
+    APP_THREAD_DATA,
+    APP_THREAD_MONITOR,
+    APP_THREAD_COUNT
+} app_thread_t;
+
+/**
+ * Vehicle signals accepted by the ingest queue
+ */
+typedef enum {
+    SIGNAL_SPEED_KMH = 0,
+    SIGNAL_RPM,
+    SIGNAL_ACCELERATION,
+    SIGNAL_FUEL_LEVEL,
+    SIGNAL_ENGINE_TEMP,
+    SIGNAL_OIL_PRESSURE,
+    SIGNAL_BATTERY_VOLTAGE,
+    SIGNAL_ALTERNATOR_CURRENT,
+    SIGNAL_GEAR_POSITION,
+    SIGNAL_IGNITION_ON,
+    SIGNAL_ENGINE_RUNNING,
+    SIGNAL_PARKING_BRAKE,
+    SIGNAL_SEATBELT_FASTENED,
+    SIGNAL_COUNT
+} signal_id_t;
+
+/**
+ * What the ingest queue does when a push finds it full
+ */
+typedef enum {
+    SIGNAL_RING_DROP_OLDEST = 0,  /* Evict the oldest queued sample */
+    SIGNAL_RING_DROP_NEWEST,      /* Reject the incoming sample */
+    SIGNAL_RING_POLICY_COUNT
+} signal_ring_policy_t;
+
+/**
+ * Physics parameters varied by a sweep
+ */
+typedef enum {
+    SWEEP_PARAM_MASS = 0,          /* kg */
+    SWEEP_PARAM_DRAG,              /* Drag coefficient */
+    SWEEP_PARAM_ROLLING,           /* Rolling resistance coefficient */
+    SWEEP_PARAM_POWER,             /* kW */
+    SWEEP_PARAM_COUNT
+} sweep_param_t;
+
+/**
+ * Where a rendered frame goes on present
+ */
+typedef enum {
+    FRAMEBUFFER_OUTPUT_MEMORY = 0, /* Stays in the buffer (profiling, snapshots) */
+    FRAMEBUFFER_OUTPUT_FILE,       /* Raw BGRA frames appended to a file */
+    FRAMEBUFFER_OUTPUT_DEVICE,     /* Linux fbdev, e.g. /dev/fb0 */
+    FRAMEBUFFER_OUTPUT_COUNT
+} framebuffer_output_t;
+
+/**
+ * Instruction set of the anti-aliased span kernels
+ */
+typedef enum {
+    RASTER_ISA_SCALAR = 0,         /* Portable C, the reference */
+    RASTER_ISA_SSE2,               /* 4 pixels per step, any x86_64 */
+    RASTER_ISA_AVX2,               /* 8 pixels per step, chosen at run time */
+    RASTER_ISA_NEON,               /* 4 pixels per step, AArch64 */
+    RASTER_ISA_COUNT
+} raster_isa_t;
+
+/**
+ * Which part of a ring an arc keeps
+ */
+typedef enum {
+    RASTER_SECTOR_NONE = 0,        /* Whole ring or disc */
+    RASTER_SECTOR_CONVEX,          /* Inside both edges: up to 180 degrees */
+    RASTER_SECTOR_REFLEX           /* Inside either edge: more than 180 degrees */
+} raster_sector_t;
+
+/**
+ * Widget tree node types
+ */
+typedef enum {
+    WIDGET_GROUP = 0,              /* Positions its children; optional panel */
+    WIDGET_DIAL,                   /* Round gauge with needle and readout */
+    WIDGET_BAR,                    /* Horizontal level bar */
+    WIDGET_READOUT,                /* Numeric or gear text */
+    WIDGET_LIGHT,                  /* Warning lamp */
+    WIDGET_KIND_COUNT
+} widget_kind_t;
+
+/**
+ * How a readout prints its value
+ */
+typedef enum {
+    WIDGET_FORMAT_NUMBER = 0,      /* Fixed decimals and unit */
+    WIDGET_FORMAT_GEAR             /* R, N or the gear number */
+} widget_format_t;
+
+/**
+ * How an animated gauge moves towards a new value
+ */
+typedef enum {
+    ANIMATION_SPRING = 0,          /* Critically damped; follows moving targets smoothly */
+    ANIMATION_EASE_OUT,            /* Cubic, fast start; restarts on every new target */
+    ANIMATION_EASE_IN_OUT,         /* Cubic, slow start and end */
+    ANIMATION_LINEAR,
+    ANIMATION_CURVE_COUNT
+} animation_curve_t;
+
+/**
+ * Pipeline stages with latency histograms
+ */
+typedef enum {
+    LATENCY_STAGE_PHYSICS = 0,   /* data_simulator_update() */
+    LATENCY_STAGE_SNAPSHOT,      /* vehicle_snapshot_publish() */
+    LATENCY_STAGE_GUI_UPDATE,    /* gui_manager_update() */
+    LATENCY_STAGE_GUI_RENDER,    /* gui_manager_render() */
+    LATENCY_STAGE_FRAME,         /* Complete GUI frame */
+    LATENCY_STAGE_AGE_PUBLISH,   /* Sample age when published to the snapshot */
+    LATENCY_STAGE_AGE_UPDATE,    /* Sample age when the GUI picks it up */
+    LATENCY_STAGE_AGE_DISPLAY,   /* Sample age when the frame is on screen */
+    LATENCY_STAGE_COUNT
+} latency_stage_t;
+
 /* ===============================================================================
  * Core Data Structures
  * =============================================================================== */
@@ -222,10 +434,278 @@ typedef struct {
     
     /* Timestamps */
     struct timespec timestamp;
+    uint64_t acquired_ns;      /* CLOCK_MONOTONIC acquisition time of the newest input */
+    uint64_t state_time_ns;    /* CLOCK_MONOTONIC instant the model state represents */
     uint32_t data_age_ms;      /* Age of data in milliseconds */
     bool data_valid;           /* Data validity flag */
 } vehicle_data_t;
 
+/**
+ * Versioned copy of vehicle data inside a snapshot
+ */
+typedef struct {
+    volatile uint32_t sequence;  /* Odd while the writer is filling the slot */
+    vehicle_data_t data;
+} CACHE_ALIGNED vehicle_snapshot_slot_t;
+
+/**
+ * Single-writer/multi-reader vehicle data publication
+ *
+ * The writer fills the slot after the latest one and then advances
+ * 'latest', so readers always copy a completed slot and never wait for
+ * a write in progress. Neither side takes a lock.
+ */
+typedef struct {
+    vehicle_snapshot_slot_t slots[VEHICLE_SNAPSHOT_SLOTS];
+    volatile uint32_t latest CACHE_ALIGNED;  /* Publish counter; slot = latest % SLOTS */
+} vehicle_snapshot_t;
+
+/**
+ * Timestamped sample of one vehicle signal
+ */
+typedef struct {
+    uint64_t timestamp_ns;     /* CLOCK_MONOTONIC acquisition time */
+    uint32_t signal;           /* signal_id_t */
+    float value;               /* Booleans are 0.0f / 1.0f */
+} signal_sample_t;
+
+/**
+ * Single-producer/single-consumer ingest queue
+ *
+ * head is written only by the producer and tail by the consumer, each on
+ * its own cache line. Under DROP_OLDEST the producer may also advance tail
+ * (CAS) when the ring is full, so the consumer claims entries with a CAS
+ * too and discards any that were evicted while it was copying.
+ */
+typedef struct {
+    signal_sample_t samples[SIGNAL_RING_CAPACITY];
+    signal_ring_policy_t policy;
+    
+    /* Producer side */
+    volatile uint32_t head CACHE_ALIGNED;    /* Next slot to write */
+    uint64_t pushed;
+    uint64_t dropped_newest;
+    uint64_t dropped_oldest;
+    
+    /* Consumer side */
+    volatile uint32_t tail CACHE_ALIGNED;    /* Next slot to read */
+    uint64_t popped;
+    uint64_t batches;
+} signal_ring_t;
+
+/**
+ * Recording file header (host byte order, fixed 64 bytes)
+ */
+typedef struct {
+    uint32_t magic;            /* RECORDER_MAGIC; byte-swapped means foreign endianness */
+    uint16_t version;          /* RECORDER_FORMAT_VERSION */
+    uint16_t header_size;      /* sizeof(vehicle_record_header_t) */
+    uint32_t record_size;      /* sizeof(vehicle_record_t) */
+    uint32_t sample_rate_hz;   /* Nominal producer rate */
+    uint64_t start_realtime_ns; /* CLOCK_REALTIME at open, maps acquired_ns to wall time */
+    uint64_t start_monotonic_ns; /* CLOCK_MONOTONIC at open */
+    uint32_t flags;
+    uint8_t reserved[28];
+} vehicle_record_header_t;
+
+/**
+ * One recorded vehicle sample (fixed 48 bytes, no padding)
+ */
+typedef struct {
+    uint64_t acquired_ns;      /* CLOCK_MONOTONIC */
+    uint32_t sequence;         /* Gaps mean the ring overflowed */
+    float speed_kmh;
+    float rpm;
+    float acceleration;
+    float fuel_level;
+    float engine_temp;
+    float oil_pressure;
+    float battery_voltage;
+    float alternator_current;
+    int8_t gear_position;
+    uint8_t flags;             /* VEHICLE_RECORD_FLAG_* */
+    uint16_t reserved;
+} vehicle_record_t;
+
+#define VEHICLE_RECORD_FLAG_IGNITION        (1u << 0)
+#define VEHICLE_RECORD_FLAG_ENGINE_RUNNING  (1u << 1)
+#define VEHICLE_RECORD_FLAG_PARKING_BRAKE   (1u << 2)
+#define VEHICLE_RECORD_FLAG_SEATBELT        (1u << 3)
+#define VEHICLE_RECORD_FLAG_VALID           (1u << 4)
+
+/**
+ * Sparse time index entry, one per RECORDER_INDEX_INTERVAL records
+ */
+typedef struct {
+    uint64_t acquired_ns;      /* Time of the indexed record */
+    uint64_t record;           /* Record number from the start of the file */
+} vehicle_record_index_t;
+
+/**
+ * Index trailer at the very end of a cleanly closed recording
+ *
+ * Layout: header, records, index entries, trailer. Files cut short
+ * (crash, power loss) have no trailer and are still playable.
+ */
+typedef struct {
+    uint64_t index_offset;     /* Byte offset of the first index entry */
+    uint32_t entry_count;
+    uint32_t interval;         /* Records between entries */
+    uint32_t magic;            /* RECORDER_INDEX_MAGIC */
+    uint32_t reserved;
+} vehicle_record_trailer_t;
+
+/**
+ * Streaming recorder
+ *
+ * The data thread encodes each sample into a single-producer ring and
+ * returns; a low-priority writer thread drains the ring into a large
+ * buffer, writes it sequentially and fsyncs on a fixed interval. A full
+ * ring drops the new sample rather than block the producer.
+ */
+typedef struct {
+    vehicle_record_t records[RECORDER_RING_CAPACITY];
+    
+    /* Producer side */
+    volatile uint32_t head CACHE_ALIGNED;
+    uint32_t next_sequence;
+    uint64_t submitted;
+    uint64_t dropped;
+    
+    /* Writer side */
+    volatile uint32_t tail CACHE_ALIGNED;
+    int fd;
+    uint8_t *write_buffer;
+    size_t buffered_bytes;
+    uint64_t records_written;
+    uint64_t bytes_written;
+    uint64_t write_calls;
+    uint64_t fsync_calls;
+    uint64_t max_write_ns;
+    uint64_t max_fsync_ns;
+    int write_error;           /* First errno; recording stops after an error */
+    vehicle_record_index_t *index;  /* Written as the trailer on close */
+    uint32_t index_count;
+    uint32_t index_capacity;
+    
+    /* Control */
+    pthread_t writer_thread;
+    volatile int writer_running;
+    bool open;
+    char path[256];
+} recorder_t;
+
+/**
+ * Screen rectangle in pixels
+ */
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} framebuffer_rect_t;
+
+/**
+ * Ring, disc or arc for the span kernels
+ *
+ * cy grows downwards like the screen. The sector edges are unit vectors
+ * with y pointing up; inner is a large negative number for a disc.
+ */
+typedef struct {
+    float cx, cy;
+    float outer, inner;
+    float start_x, start_y;
+    float end_x, end_y;
+    raster_sector_t sector;
+    uint32_t color;            /* 0xAARRGGBB, not premultiplied */
+} raster_ring_t;
+
+/**
+ * Segment with round caps for the span kernels
+ */
+typedef struct {
+    float x0, y0;
+    float dx, dy;              /* End minus start */
+    float inv_length2;         /* 0 for a dot */
+    float half_width;
+    uint32_t color;            /* 0xAARRGGBB, not premultiplied */
+} raster_capsule_t;
+
+/**
+ * Software render target
+ *
+ * Pixels are 0xAARRGGBB, which is BGRA in memory on little-endian targets
+ * and matches the usual 32 bpp fbdev layout.
+ */
+typedef struct {
+    uint32_t *pixels;
+    int width;
+    int height;
+    int stride;                /* Pixels per row, FRAMEBUFFER_ROW_ALIGN multiple */
+    
+    /* Drawing clip rectangle, [x0, x1) x [y0, y1) */
+    int clip_x0, clip_y0;
+    int clip_x1, clip_y1;
+    
+    /* Present target */
+    framebuffer_output_t output;
+    int output_fd;
+    void *device_map;          /* mmap()ed device memory */
+    size_t device_map_size;
+    uint8_t *device_pixels;    /* Visible page within device_map */
+    int device_width;
+    int device_height;
+    int device_stride;         /* Bytes per device row */
+    int device_bpp;            /* 32 or 16 (RGB565) */
+    char output_path[256];
+    
+    /* Statistics */
+    uint64_t frames_presented;
+    uint64_t bytes_presented;
+    uint64_t present_time_ns;
+} framebuffer_t;
+
+/**
+ * Draws the scene into view, which shares the target's pixels and is
+ * clipped to one tile
+ */
+typedef void (*render_tile_fn_t)(void *context, framebuffer_t *view);
+
+/**
+ * Worker threads that rasterize screen tiles in parallel
+ *
+ * The calling thread renders tiles too, so a pool of n threads has n - 1
+ * workers. Tiles are claimed one at a time from next_tile; each is drawn
+ * through a private framebuffer view whose clip is the tile, so threads
+ * never write the same pixel.
+ */
+typedef struct {
+    pthread_t workers[RENDER_POOL_MAX_THREADS];
+    uint32_t worker_count;
+    
+    /* Pass hand-off, guarded by lock */
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    uint64_t generation;       /* Bumped for every pass */
+    uint32_t workers_done;
+    bool shutdown;
+    
+    /* Current pass */
+    const framebuffer_t *target;
+    const framebuffer_rect_t *tiles;
+    uint32_t tile_count;
+    render_tile_fn_t render_tile;
+    void *context;
+    
+    volatile uint32_t next_tile CACHE_ALIGNED;
+    
+    /* Statistics */
+    uint64_t passes;
+    uint64_t tiles_rendered;
+    uint64_t run_time_ns;
+} render_pool_t;
+
 /**
  * Gauge widget configuration and state
  */
@@ -250,9 +730,15 @@ typedef struct {
     /* Behavior */
     float warning_threshold;
     float critical_threshold;
-    float animation_speed;     /* Animation interpolation speed */
+    float animation_speed;     /* Multiplier on the animation rate; 1 = theme duration */
     bool visible;
     bool enabled;
+    
+    /* Rendering */
+    framebuffer_t face;        /* Static face cached for the current theme */
+    float drawn_value;         /* Needle and readout as last drawn */
+    framebuffer_rect_t drawn_needle;  /* Needle and hub bounds on screen */
+    char drawn_text[16];
 } gauge_widget_t;
 
 /**
@@ -279,8 +765,120 @@ typedef struct {
     uint32_t blink_interval_ms;
     uint32_t last_blink_time;
     bool blink_state;
+    bool drawn_lit;            /* Lamp state on screen */
 } warning_light_t;
 
+/**
+ * One widget of a layout
+ *
+ * Nodes are stored in pre-order, so a node's descendants are exactly the
+ * nodes after it up to subtree_end and a subtree is skipped with one jump.
+ */
+typedef struct {
+    widget_kind_t kind;
+    char id[WIDGET_ID_LENGTH];
+    int parent;                /* -1 for top-level nodes */
+    int subtree_end;           /* One past the last descendant */
+    framebuffer_rect_t box;    /* Own area on screen */
+    framebuffer_rect_t design_box; /* box at the layout's design size, before fitting */
+    framebuffer_rect_t bounds; /* box plus every descendant's bounds */
+    bool panel;                /* Groups: paint a panel behind the children */
+    
+    /* Data Binding */
+    int signal;                /* signal_id_t, or -1 when unbound */
+    int next_subscriber;       /* Next node bound to the same signal, or -1 */
+    float threshold;           /* Lights: lit beyond this value */
+    bool below;                /* Lights: lit below threshold instead of above */
+    bool blink;                /* Lights: blink while lit */
+    widget_format_t format;    /* Readouts */
+    int decimals;
+    char unit[WIDGET_UNIT_LENGTH];
+    
+    /* Damage */
+    bool active;               /* On the active list: changed, animating or blinking */
+    bool dirty;                /* On the dirty list; damage holds areas to repaint */
+    framebuffer_rect_t damage[WIDGET_NODE_DAMAGE_RECTS];
+    int damage_count;
+    
+    /* Widget State (groups use gauge.label as their title) */
+    union {
+        gauge_widget_t gauge;  /* Dials, bars and readouts */
+        warning_light_t light;
+    } data;
+} widget_node_t;
+
+/**
+ * Receives one damaged area of the widget tree
+ */
+typedef void (*widget_damage_fn_t)(void *context, framebuffer_rect_t rect);
+
+/**
+ * Retained widget layout with per-signal subscriptions
+ *
+ * An update touches only the nodes bound to signals whose value changed,
+ * plus the nodes still animating or blinking (the active list); damage
+ * is collected from the nodes on the dirty list only.
+ */
+typedef struct {
+    widget_node_t *nodes;
+    int count;
+    int capacity;
+    char name[LAYOUT_NAME_LENGTH];
+    int design_width;          /* Screen the coordinates were laid out for (0 = any) */
+    int design_height;
+    
+    /* Data Binding */
+    int subscribers[SIGNAL_COUNT];      /* First node bound to each signal, or -1 */
+    float signal_values[SIGNAL_COUNT];  /* Values last applied */
+    bool signals_valid;                 /* False until the first update */
+    
+    /* Nodes that need attention on the next damage pass */
+    int *active;
+    int active_count;
+    int *dirty;                /* Nodes with damage to collect */
+    int dirty_count;
+    
+    /* Statistics */
+    uint64_t updates;
+    uint64_t signals_changed;
+    uint64_t nodes_refreshed;  /* Active nodes compared with the screen */
+    uint64_t nodes_damaged;
+} widget_tree_t;
+
+/**
+ * Gauge animations as a structure of arrays
+ *
+ * One lane per dial or bar that is moving; lanes are added when a gauge
+ * gets a new target and removed once it has settled, so a batch step
+ * touches only moving gauges and runs over contiguous floats.
+ */
+typedef struct {
+    /* Configuration */
+    animation_curve_t curve;
+    float duration_s;          /* Easing time; the spring gets within 1% in it */
+    
+    /* Lanes */
+    uint32_t count;
+    uint32_t capacity;
+    int *node;                 /* Widget tree index */
+    float *value;
+    float *target;
+    float *velocity;           /* Spring, units per second */
+    float *start;              /* Easing: value when the target last changed */
+    float *progress;           /* Easing: 0 at start, 1 at target */
+    float *rate;               /* 1 / duration, times the gauge's animation_speed */
+    float *tolerance;          /* Distance that counts as settled */
+    
+    /* Widget tree index -> lane, or -1 */
+    int *lane_of;
+    int node_capacity;
+    
+    /* Statistics */
+    uint64_t steps;
+    uint64_t lane_steps;
+    uint64_t settled;          /* Animations that reached their target */
+} gauge_animator_t;
+
 /**
  * GUI manager state and configuration
  */
@@ -289,10 +887,13 @@ typedef struct {
     PtWidget_t *main_window;
     PtWidget_t *canvas;
     PhDim_t window_size;
+    framebuffer_t framebuffer;   /* Software render target */
     
     /* Widgets */
-    gauge_widget_t gauges[GAUGE_COUNT];
-    warning_light_t warnings[WARNING_LIGHT_COUNT];
+    widget_tree_t widgets;
+    bool animations_enabled;   /* Otherwise gauges jump straight to new values */
+    gauge_animator_t animator; /* Dials and bars on their way to a new value */
+    float visual_epsilon_px;   /* Needle or bar travel below this is not redrawn */
     
     /* Theme and Display */
     gui_theme_t current_theme;
@@ -304,11 +905,127 @@ typedef struct {
     uint32_t frame_count;
     float fps;
     
+    /* Input */
+    int input_fd;              /* Watched by the main event loop (-1 if none) */
+    struct termios saved_termios;  /* Terminal mode to restore at cleanup */
+    bool termios_saved;
+    
+    /* Damage since the last frame */
+    framebuffer_rect_t dirty[GUI_MAX_DIRTY_RECTS];
+    int dirty_count;
+    bool full_redraw;          /* Repaint everything (first frame, theme change) */
+    bool faces_valid;          /* Gauge face caches match current_theme */
+    uint64_t pixels_redrawn;
+    
+    /* Tile-parallel rendering */
+    render_pool_t render_pool;
+    framebuffer_rect_t *tiles;     /* Screen grid, clipped to the damage */
+    int tile_capacity;
+    
     /* State */
     bool initialized;
     bool needs_redraw;
 } gui_manager_t;
 
+/**
+ * Memory-mapped playback of a recording
+ *
+ * Only the pages actually played (plus kernel read-ahead) are faulted in,
+ * so opening a multi-GB log costs the same as opening a small one.
+ */
+typedef struct {
+    int fd;
+    const uint8_t *map;
+    size_t map_size;
+    
+    const vehicle_record_t *records;
+    uint64_t record_count;
+    const vehicle_record_index_t *index;   /* NULL if the file has no trailer */
+    uint32_t index_count;
+    uint32_t index_interval;
+    
+    /* Playback cursor in recording time */
+    uint64_t first_ns;
+    uint64_t last_ns;
+    double cursor_ns;
+    uint64_t position;         /* Record at or before cursor_ns */
+    bool complete;
+    
+    /* Statistics */
+    uint64_t records_played;
+    uint64_t seeks;
+    uint32_t loops;
+} replay_t;
+
+/**
+ * Keyframes of one signal inside a compiled scenario
+ */
+typedef struct {
+    uint32_t first;            /* Offset into the scenario keyframe arrays */
+    uint32_t count;            /* 0 = signal not driven by the scenario */
+    uint32_t cursor;           /* Current segment, relative to first */
+} scenario_track_t;
+
+/**
+ * Scenario compiled to flat per-signal keyframe tables
+ *
+ * Segment i of a track starts at times[i] with value values[i] and
+ * changes at slopes[i] per second (0 for the last keyframe and for
+ * discrete signals), so evaluation is fmaf(slope, t - time, value).
+ */
+typedef struct {
+    char name[SCENARIO_NAME_LENGTH];
+    float duration;            /* Seconds; last keyframe unless set explicitly */
+    scenario_track_t tracks[SIGNAL_COUNT];
+    
+    float *times;              /* One allocation holding all three arrays */
+    float *values;
+    float *slopes;
+    uint32_t keyframe_count;
+    bool loaded;
+} scenario_t;
+
+/**
+ * xoshiro128+ generator state (never all zero)
+ */
+typedef struct {
+    uint32_t s[4];
+} rng_t;
+
+/**
+ * RNG_LANES independent xoshiro128+ streams in structure-of-arrays form
+ *
+ * Word k of lane j is s[k][j], so each state word of all lanes loads into
+ * one vector register and a batch advances every lane at once.
+ */
+typedef struct {
+    uint32_t s[4][RNG_LANES];
+} rng_lanes_t;
+
+/**
+ * Fixed-timestep accumulator
+ *
+ * Measured wall time is accumulated and consumed in whole steps; the
+ * remainder carries into the next call, so simulated time follows real
+ * time on average regardless of wake-up jitter. Kept in integer
+ * nanoseconds so it does not drift over long runs.
+ */
+typedef struct {
+    uint64_t step_ns;
+    uint32_t max_substeps;     /* Per call; backlog beyond this is dropped */
+    uint64_t last_ns;          /* 0 until the first advance */
+    uint64_t accumulator_ns;
+    
+    /* Statistics */
+    uint64_t steps;
+    uint64_t catch_up_calls;   /* Calls that ran more than one step */
+    uint64_t dropped_ns;
+    uint32_t max_substeps_seen;
+} fixed_step_t;
+
+/* Called with the state after each fixed step */
+typedef void (*data_step_fn_t)(void *context, const vehicle_data_t *data);
+
 /**
  * Data simulator configuration and state
  */
@@ -328,17 +1045,250 @@ typedef struct {
     vehicle_data_t current_data;
     vehicle_data_t previous_data;
     
+    /* Model State (per instance, so simulators can run in parallel) */
+    float simulation_time;     /* Seconds since initialization */
+    float target_speed;        /* Realistic mode driving target, km/h */
+    float speed_change_timer;
+    bool full_throttle;        /* Driver demands full power, ignoring target_speed */
+    float fuel_burn_pct;       /* Burned but not yet taken off fuel_level */
+    rng_t rng;                 /* Target speeds and data_add_noise() */
+    rng_lanes_t noise_rng;     /* Per-update sensor noise, one lane per channel */
+    fixed_step_t clock;        /* Real-time stepping for data_simulator_advance() */
+    
     /* Scenario Control */
     float scenario_time;       /* Current scenario time */
     float scenario_speed;      /* Playback speed multiplier */
     bool scenario_loop;        /* Loop scenario when complete */
+    replay_t replay;           /* Source for SIM_MODE_REPLAY */
+    scenario_t scenario;       /* Source for SIM_MODE_DEMO when loaded */
     
     /* Statistics */
     uint64_t update_count;
+    uint64_t samples_ingested;
     float average_update_time_ms;
     uint32_t error_count;
 } data_simulator_t;
 
+/**
+ * Many independent vehicles in structure-of-arrays form
+ *
+ * Each field is a separate cache-aligned array padded to FLEET_ARRAY_ALIGN
+ * vehicles, so the physics step loads full vectors with no gathers and no
+ * remainder loop. Padding lanes are simulated like real vehicles and
+ * ignored. Gear is kept as float so it stays in vector registers.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t capacity;         /* count rounded up to FLEET_ARRAY_ALIGN */
+    
+    float *speed_kmh;
+    float *rpm;
+    float *fuel_level;
+    float *fuel_burn;          /* Burned but not yet taken off fuel_level */
+    float *engine_temp;
+    float *oil_pressure;
+    float *battery_voltage;
+    float *acceleration;
+    float *gear;
+    float *target_speed;
+    float *target_timer;       /* Seconds since target_speed last changed */
+    uint32_t *rng_state;       /* Per-vehicle xorshift32 for new targets */
+    void *storage;             /* One allocation holding all arrays */
+    
+    float ambient_temp;
+    
+    /* Statistics */
+    uint64_t steps;
+    uint64_t vehicle_steps;
+    uint64_t step_time_ns;
+} fleet_t;
+
+/**
+ * Outcome of one sweep run
+ */
+typedef struct {
+    float params[SWEEP_PARAM_COUNT];
+    float zero_to_100_s;       /* -1 if 100 km/h was never reached */
+    float fuel_used_pct;
+    float peak_engine_temp;
+    float distance_km;
+    float max_speed_kmh;
+} sweep_result_t;
+
+/**
+ * Monte-Carlo sweep over physics parameters
+ *
+ * Run i draws its parameters uniformly from the ranges with a generator
+ * seeded from (seed, i), so results do not depend on how runs are spread
+ * over workers.
+ */
+typedef struct {
+    /* Configuration */
+    float range_min[SWEEP_PARAM_COUNT];
+    float range_max[SWEEP_PARAM_COUNT];
+    uint32_t runs;
+    float duration_s;
+    float step_s;
+    uint64_t seed;
+    uint32_t worker_count;     /* 0 = one per online CPU */
+    
+    /* Results, indexed by run */
+    sweep_result_t *results;
+    volatile uint32_t next_run CACHE_ALIGNED;
+    
+    /* Statistics */
+    uint64_t wall_time_ns;
+} sweep_t;
+
+/**
+ * Independent data simulators updated by a fixed set of worker threads
+ *
+ * Each run is one batch: workers claim SIMULATOR_POOL_CHUNK simulators at
+ * a time from next_simulator and advance each by the requested number of
+ * steps, so a simulator is only ever touched by one thread per batch.
+ */
+typedef struct {
+    data_simulator_t *simulators;
+    uint32_t simulator_count;
+    pthread_t workers[SIMULATOR_POOL_MAX_WORKERS];
+    uint32_t worker_count;
+    
+    /* Batch hand-off, guarded by lock */
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    uint64_t generation;       /* Bumped for every batch */
+    uint32_t workers_done;
+    float delta_time;
+    uint32_t steps;
+    bool shutdown;
+    
+    volatile uint32_t next_simulator CACHE_ALIGNED;
+    
+    /* Statistics */
+    uint64_t batches;
+    uint64_t simulator_updates;
+    uint64_t run_time_ns;
+} simulator_pool_t;
+
+/**
+ * Deadline-miss handling for periodic tasks
+ */
+typedef enum {
+    PERIODIC_POLICY_CATCH_UP = 0,  /* Run missed activations back-to-back */
+    PERIODIC_POLICY_SKIP,          /* Drop missed activations, stay on the grid */
+    PERIODIC_POLICY_COUNT
+} periodic_policy_t;
+
+/**
+ * Periodic task statistics as published for other threads
+ */
+typedef struct {
+    uint64_t activations;
+    uint32_t overruns;         /* Activations that finished past their deadline */
+    uint32_t skipped;          /* Releases dropped by the skip policy */
+    uint64_t max_lateness_ns;  /* Worst wakeup delay after release */
+    uint64_t total_lateness_ns;
+    float jitter_mean_ms;      /* Actual minus expected release interval */
+    float jitter_variance_ms2;
+} periodic_task_stats_t;
+
+/**
+ * Periodic task released on absolute CLOCK_MONOTONIC deadlines
+ */
+typedef struct {
+    /* Configuration */
+    const char *name;
+    uint64_t period_ns;
+    periodic_policy_t policy;
+    uint32_t max_catch_up;     /* Backlog limit before realigning (catch-up) */
+
+    /* Release State */
+    struct timespec release;   /* Release time of the current activation */
+    uint64_t last_wakeup_ns;
+
+    /* Statistics (written by the owning thread only) */
+    periodic_task_stats_t stats;
+    uint64_t jitter_samples;   /* Welford accumulators for release jitter */
+    double jitter_mean_ms;
+    double jitter_m2;
+
+    /* Seqlock-published copy of stats for other threads */
+    uint32_t published_sequence;
+    periodic_task_stats_t published;
+} periodic_task_t;
+
+/**
+ * Frame scheduler for the GUI thread
+ *
+ * Decides after each activation how many periodic releases to sleep: one
+ * while the screen changes, more once it has been still for a while or
+ * when frames cost too much of their interval. Any change returns to the
+ * rate load allows on the next activation.
+ */
+typedef struct {
+    /* Configuration */
+    uint64_t period_ns;        /* Full-rate release period */
+    uint32_t max_stride;       /* Releases per frame at the lowest rate */
+    uint32_t idle_stride;      /* Releases per activation while still */
+    uint32_t idle_after;       /* Still activations before idling */
+    bool adaptive;             /* false: every release, whatever happens */
+
+    /* State */
+    uint32_t load_stride;      /* Releases per frame that load allows; 1 = full rate */
+    uint32_t stride;           /* Releases until the next activation */
+    uint32_t still;            /* Consecutive activations with nothing to present */
+    float load;                /* Smoothed frame cost / frame interval */
+
+    /* Statistics */
+    uint64_t activations;
+    uint64_t presented;
+    uint64_t idle_activations; /* Run at the idle stride */
+    uint32_t rate_drops;
+    uint32_t rate_restores;
+} frame_scheduler_t;
+
+/**
+ * Log-bucketed latency histogram (one writer thread, any number of readers)
+ */
+typedef struct {
+    uint32_t counts[LATENCY_BUCKET_COUNT];
+    uint64_t sample_count;
+    uint64_t max_ns;
+    uint64_t last_ns;
+} latency_histogram_t;
+
+/**
+ * Latency percentiles computed by the monitor thread
+ */
+typedef struct {
+    float p50_ms;
+    float p99_ms;
+    float p999_ms;
+    float max_ms;
+    uint64_t samples;
+} latency_summary_t;
+
+/**
+ * Process and per-thread resource usage sample
+ */
+typedef struct {
+    /* Memory */
+    uint32_t rss_kb;
+    uint32_t peak_rss_kb;
+    uint64_t minor_faults;
+    uint64_t major_faults;
+    
+    /* Scheduling */
+    uint64_t voluntary_switches;
+    uint64_t involuntary_switches;
+    
+    /* CPU (percent of one core over the last sample interval) */
+    float process_cpu_percent;
+    float thread_cpu_percent[APP_THREAD_COUNT];
+    uint64_t thread_cpu_ns[APP_THREAD_COUNT];
+} resource_usage_t;
+
 /**
  * Performance monitoring structure
  */
@@ -354,15 +1304,120 @@ typedef struct {
     
     /* Performance Counters */
     uint64_t frames_rendered;
+    uint64_t frames_skipped;       /* GUI activations with nothing to present */
     uint64_t data_updates;
     uint32_t missed_deadlines;
     
     /* Quality Metrics */
     float average_fps;
+    float gui_rate_hz;             /* Activation rate the frame scheduler chose */
     float frame_time_variance;
     bool performance_warning;
+    
+    /* Sensor-to-Display Latency */
+    float sensor_to_display_ms;    /* Age of the data in the last frame */
+    float latency_budget_ms;
+    uint64_t latency_budget_breaches;
+    
+    /* Resource Usage Detail */
+    resource_usage_t resources;
+    
+    /* Per-Stage Latency Distributions */
+    latency_histogram_t stage_latency[LATENCY_STAGE_COUNT];
+    latency_summary_t stage_summary[LATENCY_STAGE_COUNT];
 } performance_metrics_t;
 
+/**
+ * Real-time thread launch parameters
+ */
+typedef struct {
+    const char *name;
+    int policy;                /* SCHED_FIFO, SCHED_RR or SCHED_OTHER */
+    int priority;
+    int cpu;                   /* CPU index or RT_NO_AFFINITY */
+    size_t stack_size;         /* 0 = system default */
+    bool prefault_stack;
+} rt_thread_config_t;
+
+/**
+ * What actually took effect when a thread was launched
+ */
+typedef struct {
+    bool sched_applied;        /* Requested policy/priority in effect */
+    int sched_error;           /* errno when the request was refused */
+    int actual_policy;
+    int actual_priority;
+    
+    bool affinity_applied;
+    int affinity_error;
+    
+    bool stack_prefaulted;
+} rt_thread_report_t;
+
+/**
+ * Resource sampler state (owned by the monitor thread)
+ */
+typedef struct {
+    int statm_fd;              /* /proc/self/statm, kept open for pread() */
+    uint32_t page_size_kb;
+    
+    clockid_t thread_clocks[APP_THREAD_COUNT];
+    bool thread_clock_valid[APP_THREAD_COUNT];
+    
+    uint64_t last_wall_ns;
+    uint64_t last_process_cpu_ns;
+    uint64_t last_thread_cpu_ns[APP_THREAD_COUNT];
+    
+    /* Limits */
+    uint32_t max_memory_kb;
+    float max_cpu_percent;
+} resource_monitor_t;
+
+/**
+ * Event loop callbacks (return false from an fd callback to stop watching it)
+ */
+typedef bool (*event_fd_callback_t)(int fd, void *user_data);
+typedef void (*event_timer_callback_t)(void *user_data);
+
+/**
+ * File descriptor watched by the event loop
+ */
+typedef struct {
+    int fd;
+    event_fd_callback_t callback;
+    void *user_data;
+} event_source_t;
+
+/**
+ * Periodic timer serviced by the event loop
+ */
+typedef struct {
+    uint64_t period_ns;
+    uint64_t next_expiry_ns;
+    event_timer_callback_t callback;
+    void *user_data;
+} event_timer_t;
+
+/**
+ * poll()-based main-thread event loop
+ */
+typedef struct {
+    event_source_t sources[EVENT_LOOP_MAX_SOURCES];
+    int source_count;
+    event_timer_t timers[EVENT_LOOP_MAX_TIMERS];
+    int timer_count;
+    
+    int wake_fds[2];                    /* Self-pipe: [0] polled, [1] written on stop */
+    volatile sig_atomic_t stop_requested;
+    
+    /* Statistics */
+    uint64_t wakeups;
+    uint64_t fd_dispatches;
+    uint64_t timer_dispatches;
+    uint64_t run_time_ns;
+    uint64_t run_cpu_ns;
+} event_loop_t;
+
 /**
  * Main application context
  */
@@ -375,18 +1430,41 @@ typedef struct {
     /* Components */
     gui_manager_t gui;
     data_simulator_t simulator;
+    vehicle_snapshot_t vehicle_snapshot;  /* Data thread -> GUI/monitor */
+    signal_ring_t ingest_ring;            /* External producer -> data thread */
+    recorder_t recorder;                  /* Data thread -> log file */
     performance_metrics_t performance;
     
+    /* Main Thread Event Loop */
+    event_loop_t event_loop;
+    
     /* Threading */
     pthread_t gui_thread;
     pthread_t data_thread;
     pthread_t monitor_thread;
     
-    pthread_mutex_t data_mutex;
+    periodic_task_t gui_task;
+    periodic_task_t data_task;
+    periodic_task_t monitor_task;
+    frame_scheduler_t gui_scheduler;
+    resource_monitor_t resource_monitor;
+    rt_thread_report_t thread_reports[APP_THREAD_COUNT];
+    int memory_lock_error;            /* 0 when mlockall() succeeded */
+    
+    pthread_mutex_t data_mutex;       /* Simulator configuration changes */
     pthread_cond_t data_condition;
     
     /* Configuration */
     char config_file[256];
+    char record_file[256];            /* --record; overrides the config file */
+    char replay_file[256];            /* --replay; overrides the config file */
+    sweep_t sweep;                    /* --sweep; runs > 0 skips the GUI */
+    char sweep_file[256];             /* --sweep-output CSV */
+    char framebuffer_output[256];     /* --framebuffer; memory, a file or /dev/fb0 */
+    char layout_file[256];            /* --layout; overrides the config file */
+    int render_threads;               /* --render-threads; 0 or 1 renders on the GUI thread */
+    int resolution_width;             /* --resolution; 0 keeps the configured size */
+    int resolution_height;
     bool debug_mode;
     bool automotive_mode;
     
@@ -451,6 +1529,15 @@ static inline uint64_t get_timestamp_us(void) {
     return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
 }
 
+/**
+ * Get current monotonic time in nanoseconds
+ */
+static inline uint64_t get_timestamp_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
 /**
  * Calculate time difference in milliseconds
  */
@@ -475,6 +1562,15 @@ static inline float lerp(float a, float b, float t) {
     return a + t * (b - a);
 }
 
+/**
+ * Linear interpolation between two monotonic timestamps
+ */
+static inline uint64_t lerp_ns(uint64_t a, uint64_t b, float t) {
+    if (b <= a || t >= 1.0f) return b;
+    if (t <= 0.0f) return a;
+    return a + (uint64_t)((double)(b - a) * t);
+}
+
 /**
  * Check if value is within valid range
  */
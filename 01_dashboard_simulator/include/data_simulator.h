@@ -9,30 +9,53 @@
 
 /* Data Simulator Function Prototypes */
 int data_simulator_initialize(data_simulator_t *sim);
+void data_simulator_reset(data_simulator_t *sim, uint64_t seed);
 void data_simulator_cleanup(data_simulator_t *sim);
 void data_simulator_update(data_simulator_t *sim, float delta_time);
+uint32_t data_simulator_advance(data_simulator_t *sim, uint64_t now_ns,
+                                data_step_fn_t on_step, void *context);
 
 /* Simulation Mode Functions */
 void data_simulator_set_mode(data_simulator_t *sim, simulation_mode_t mode);
 simulation_mode_t data_simulator_get_mode(const data_simulator_t *sim);
+void data_simulator_set_update_rate(data_simulator_t *sim, uint32_t rate_hz);
 
 /* Data Generation Functions */
 void data_generate_realistic(data_simulator_t *sim, float delta_time);
 void data_generate_demo(data_simulator_t *sim, float delta_time);
 void data_generate_manual(data_simulator_t *sim, const vehicle_data_t *input);
 void data_generate_replay(data_simulator_t *sim, float delta_time);
+void data_generate_scenario(data_simulator_t *sim, float delta_time);
+
+/* External Signal Ingest */
+void data_apply_sample(vehicle_data_t *data, const signal_sample_t *sample);
+uint32_t data_simulator_ingest(data_simulator_t *sim, const signal_sample_t *samples,
+                               uint32_t count);
 
 /* Physics Simulation */
 float physics_calculate_speed(float current_speed, float acceleration, float delta_time);
 float physics_calculate_rpm(float speed, int gear, float engine_load);
-float physics_calculate_fuel_consumption(float speed, float rpm, float delta_time);
+float physics_calculate_engine_power(float speed_kmh, float acceleration, float mass,
+                                     float drag_coeff, float rolling_resist);
+float physics_calculate_fuel_consumption(float power_kw, float rpm, float delta_time);
 float physics_calculate_engine_temp(float current_temp, float rpm, float ambient_temp, float delta_time);
+float physics_calculate_max_acceleration(float speed_kmh, float mass, float drag_coeff,
+                                         float rolling_resist, float power_kw);
 
 /* Data Validation */
 bool data_validate_vehicle_data(const vehicle_data_t *data);
 void data_clamp_values(vehicle_data_t *data);
 void data_set_timestamp(vehicle_data_t *data);
 
+/* Render Interpolation */
+float data_interpolation_alpha(const vehicle_data_t *previous, const vehicle_data_t *current,
+                               uint64_t time_ns);
+void data_interpolate(const vehicle_data_t *previous, const vehicle_data_t *current,
+                      float alpha, vehicle_data_t *out);
+
+/* Recording Playback */
+int data_simulator_open_replay(data_simulator_t *sim, const char *path);
+
 /* Scenario Management */
 int data_load_scenario(data_simulator_t *sim, const char *filename);
 void data_reset_scenario(data_simulator_t *sim);
@@ -45,7 +68,7 @@ void data_reset_statistics(data_simulator_t *sim);
 
 /* Utility Functions */
 float data_smooth_transition(float current, float target, float rate, float delta_time);
-float data_add_noise(float value, float noise_level);
+float data_add_noise(data_simulator_t *sim, float value, float noise_level);
 bool data_should_trigger_warning(const vehicle_data_t *data);
 
 /* Default Values */
@@ -54,9 +77,23 @@ bool data_should_trigger_warning(const vehicle_data_t *data);
 #define DEFAULT_ROLLING_RESIST   0.015f
 #define DEFAULT_ENGINE_POWER     150.0f   /* kW */
 #define DEFAULT_AMBIENT_TEMP     25.0f    /* Celsius */
+#define DEFAULT_FRONTAL_AREA     2.2f     /* m² */
+
+#define AIR_DENSITY              1.225f   /* kg/m³ */
+#define GRAVITY                  9.81f    /* m/s² */
+#define PHYSICS_TRACTION_SPEED   5.0f     /* m/s; power limit applies above this */
+#define PHYSICS_TRACTION_ACCEL   6.0f     /* m/s²; tyre grip limit at full throttle */
 
 #define REALISTIC_ACCELERATION   2.5f     /* m/s² */
 #define REALISTIC_DECELERATION   -4.0f    /* m/s² */
 #define REALISTIC_MAX_SPEED      200.0f   /* km/h for simulation */
+#define REALISTIC_TARGET_PERIOD  5.0f     /* s between target speed changes */
+
+#define FUEL_TANK_CAPACITY       60.0f    /* L */
+#define FUEL_IDLE_RATE           0.8f     /* L/h at 800 rpm, grows with rpm */
+#define FUEL_BSFC                250.0f   /* g/kWh brake-specific consumption */
+#define FUEL_DENSITY             745.0f   /* g/L */
+#define FUEL_LEVEL_STEP          0.01f    /* % burned before fuel_level is updated */
+#define DRIVETRAIN_EFFICIENCY    0.9f
 
 #endif /* DATA_SIMULATOR_H */ 
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Event Loop Header
+ */
+
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include "dashboard.h"
+
+/* Event Loop Function Prototypes */
+int event_loop_initialize(event_loop_t *loop);
+void event_loop_cleanup(event_loop_t *loop);
+int event_loop_add_fd(event_loop_t *loop, int fd, event_fd_callback_t callback,
+                      void *user_data);
+int event_loop_add_timer(event_loop_t *loop, uint32_t period_ms,
+                         event_timer_callback_t callback, void *user_data);
+int event_loop_run(event_loop_t *loop);
+void event_loop_stop(event_loop_t *loop);
+
+/* Statistics */
+float event_loop_wakeups_per_second(const event_loop_t *loop);
+float event_loop_cpu_percent(const event_loop_t *loop);
+void event_loop_print_statistics(const event_loop_t *loop);
+
+#endif /* EVENT_LOOP_H */
@@ -0,0 +1,19 @@
+/**
+ * QNX Dashboard Simulator - Fixed Timestep Header
+ */
+
+#ifndef FIXED_STEP_H
+#define FIXED_STEP_H
+
+#include "dashboard.h"
+
+/* Fixed Timestep Function Prototypes */
+void fixed_step_init(fixed_step_t *clock, uint64_t step_ns, uint32_t max_substeps);
+uint32_t fixed_step_advance(fixed_step_t *clock, uint64_t now_ns);
+float fixed_step_alpha(const fixed_step_t *clock);
+uint64_t fixed_step_state_time(const fixed_step_t *clock);
+
+/* Utility Functions */
+void fixed_step_print_statistics(const fixed_step_t *clock, const char *name);
+
+#endif /* FIXED_STEP_H */
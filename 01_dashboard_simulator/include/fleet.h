@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Fleet Simulation Header
+ */
+
+#ifndef FLEET_H
+#define FLEET_H
+
+#include "dashboard.h"
+
+/* Fleet Function Prototypes */
+int fleet_init(fleet_t *fleet, uint32_t count, uint32_t seed);
+void fleet_free(fleet_t *fleet);
+
+/* Simulation Step */
+void fleet_step(fleet_t *fleet, float delta_time);          /* Vectorized */
+void fleet_step_scalar(fleet_t *fleet, float delta_time);   /* Reference, one vehicle at a time */
+
+/* Utility Functions */
+void fleet_get_vehicle(const fleet_t *fleet, uint32_t index, vehicle_data_t *out);
+const char *fleet_simd_name(void);
+double fleet_vehicles_per_second(const fleet_t *fleet);
+void fleet_reset_statistics(fleet_t *fleet);
+void fleet_print_statistics(const fleet_t *fleet);
+
+#endif /* FLEET_H */
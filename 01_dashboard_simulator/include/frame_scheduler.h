@@ -0,0 +1,26 @@
+/**
+ * QNX Dashboard Simulator - Frame Scheduler Header
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "dashboard.h"
+
+/* Frame Scheduler Function Prototypes */
+void frame_scheduler_init(frame_scheduler_t *scheduler, uint32_t rate_hz, uint32_t min_rate_hz,
+                          uint32_t idle_rate_hz, bool adaptive);
+uint32_t frame_scheduler_end_frame(frame_scheduler_t *scheduler, bool presented, bool animating,
+                                   uint64_t cost_ns);
+float frame_scheduler_rate_hz(const frame_scheduler_t *scheduler);
+
+/* Utility Functions */
+void frame_scheduler_print_statistics(const frame_scheduler_t *scheduler);
+
+/* Default Values */
+#define FRAME_IDLE_AFTER       30      /* Still activations before polling slows down */
+#define FRAME_LOAD_HIGH        0.75f   /* Frame cost / frame interval that lowers the rate */
+#define FRAME_LOAD_LOW         0.5f    /* Predicted load the next faster rate must stay under */
+#define FRAME_LOAD_SMOOTHING   0.125f  /* Weight of the newest frame in the load average */
+
+#endif /* FRAME_SCHEDULER_H */
@@ -0,0 +1,48 @@
+/**
+ * QNX Dashboard Simulator - Software Framebuffer Header
+ */
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "dashboard.h"
+
+/* 0xRRGGBB (PgColor_t) to an opaque framebuffer pixel */
+#define FRAMEBUFFER_OPAQUE(rgb)   (0xFF000000u | ((uint32_t)(rgb) & 0xFFFFFFu))
+
+/* Built-in font cell, before scaling */
+#define FRAMEBUFFER_GLYPH_WIDTH   5
+#define FRAMEBUFFER_GLYPH_HEIGHT  7
+#define FRAMEBUFFER_GLYPH_ADVANCE 6
+
+/* Framebuffer Function Prototypes */
+int framebuffer_init(framebuffer_t *fb, int width, int height);
+void framebuffer_free(framebuffer_t *fb);
+int framebuffer_open_output(framebuffer_t *fb, const char *target);
+void framebuffer_close_output(framebuffer_t *fb);
+int framebuffer_present(framebuffer_t *fb);
+int framebuffer_present_rects(framebuffer_t *fb, const framebuffer_rect_t *rects, int count);
+int framebuffer_write_ppm(const framebuffer_t *fb, const char *path);
+
+/* Clipping */
+void framebuffer_set_clip(framebuffer_t *fb, int x, int y, int width, int height);
+void framebuffer_reset_clip(framebuffer_t *fb);
+
+/* Drawing Primitives */
+void framebuffer_clear(framebuffer_t *fb, uint32_t color);
+void framebuffer_fill_rect(framebuffer_t *fb, int x, int y, int width, int height, uint32_t color);
+void framebuffer_blit(framebuffer_t *fb, const framebuffer_t *src, int x, int y);
+void framebuffer_fill_circle(framebuffer_t *fb, float cx, float cy, float radius, uint32_t color);
+void framebuffer_fill_arc(framebuffer_t *fb, float cx, float cy, float outer_radius,
+                          float inner_radius, float start_deg, float end_deg, uint32_t color);
+void framebuffer_draw_line(framebuffer_t *fb, float x0, float y0, float x1, float y1,
+                           float thickness, uint32_t color);
+int framebuffer_draw_text(framebuffer_t *fb, int x, int y, const char *text,
+                          int scale, uint32_t color);
+int framebuffer_text_width(const char *text, int scale);
+
+/* Utility Functions */
+const char *framebuffer_output_to_string(framebuffer_output_t output);
+void framebuffer_print_statistics(const framebuffer_t *fb);
+
+#endif /* FRAMEBUFFER_H */
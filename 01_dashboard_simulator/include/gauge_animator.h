@@ -0,0 +1,34 @@
+/**
+ * QNX Dashboard Simulator - Gauge Animator Header
+ */
+
+#ifndef GAUGE_ANIMATOR_H
+#define GAUGE_ANIMATOR_H
+
+#include "dashboard.h"
+
+/* Gauge Animator Function Prototypes */
+int gauge_animator_init(gauge_animator_t *animator, animation_curve_t curve, uint32_t duration_ms);
+void gauge_animator_free(gauge_animator_t *animator);
+void gauge_animator_configure(gauge_animator_t *animator, animation_curve_t curve, uint32_t duration_ms);
+int gauge_animator_reset(gauge_animator_t *animator, int nodes);
+
+/* Animation */
+bool gauge_animator_retarget(gauge_animator_t *animator, int node, float value, float target,
+                             float range, float speed);
+uint32_t gauge_animator_step(gauge_animator_t *animator, float delta_time, widget_tree_t *tree);
+void gauge_animator_finish(gauge_animator_t *animator, widget_tree_t *tree);
+bool gauge_animator_settled(const gauge_animator_t *animator);
+
+/* Utility Functions */
+animation_curve_t animation_curve_from_string(const char *name, animation_curve_t fallback);
+const char *animation_curve_to_string(animation_curve_t curve);
+void gauge_animator_print_statistics(const gauge_animator_t *animator);
+
+/* Default Values */
+#define ANIMATION_DEFAULT_DURATION_MS  250
+#define ANIMATION_SPRING_OMEGA         6.64f    /* (1 + wt) e^-wt = 1% at t = duration */
+#define ANIMATION_SETTLE_FRACTION      0.001f   /* Of the gauge range */
+#define ANIMATION_INITIAL_LANES        16
+
+#endif /* GAUGE_ANIMATOR_H */
@@ -14,8 +14,24 @@ int gui_manager_create_window(gui_manager_t *gui);
 int gui_manager_create_widgets(gui_manager_t *gui);
 
 void gui_manager_update(gui_manager_t *gui, const vehicle_data_t *data);
-void gui_manager_render(gui_manager_t *gui);
+bool gui_manager_render(gui_manager_t *gui);
+int gui_manager_open_input(gui_manager_t *gui);
 void gui_manager_handle_events(gui_manager_t *gui);
+void gui_manager_process_window_events(gui_manager_t *gui);
+int gui_manager_get_event_fd(const gui_manager_t *gui);
+int gui_manager_set_output(gui_manager_t *gui, const char *target);
+int gui_manager_set_render_threads(gui_manager_t *gui, int threads, const rt_thread_config_t *config);
+int gui_manager_resize(gui_manager_t *gui, int width, int height);
+int gui_manager_load_layout(gui_manager_t *gui, const char *filename);
+void gui_manager_set_animations(gui_manager_t *gui, bool enabled);
+void gui_manager_set_animation_curve(gui_manager_t *gui, animation_curve_t curve, uint32_t duration_ms);
+bool gui_manager_animating(const gui_manager_t *gui);
+void gui_manager_set_visual_epsilon(gui_manager_t *gui, float epsilon_px);
+
+/* Damage Tracking */
+void gui_manager_collect_damage(gui_manager_t *gui);
+void gui_manager_add_damage(gui_manager_t *gui, framebuffer_rect_t rect);
+void gui_manager_invalidate(gui_manager_t *gui);
 
 int gui_manager_set_theme(gui_manager_t *gui, gui_theme_t theme);
 void gui_manager_toggle_fullscreen(gui_manager_t *gui);
@@ -25,7 +41,6 @@ int gui_create_gauge_widget(gauge_widget_t *gauge, const char *label,
                            float min_val, float max_val, 
                            PhPoint_t pos, PhDim_t size);
 void gui_update_gauge_value(gauge_widget_t *gauge, float value);
-void gui_animate_gauge(gauge_widget_t *gauge, float delta_time);
 
 /* Warning Light Functions */
 int gui_create_warning_light(warning_light_t *warning, const char *label,
@@ -33,18 +48,24 @@ int gui_create_warning_light(warning_light_t *warning, const char *label,
 void gui_set_warning_state(warning_light_t *warning, bool active, bool blinking);
 void gui_update_warning_blink(warning_light_t *warning, uint32_t current_time);
 
-/* Event Handlers */
+/* Event Handlers (Photon builds) */
+#ifdef USE_PHOTON
 int gui_window_close_callback(PtWidget_t *widget, ApInfo_t *apinfo, 
                              PtCallbackInfo_t *cbinfo);
 int gui_window_resize_callback(PtWidget_t *widget, ApInfo_t *apinfo,
                               PtCallbackInfo_t *cbinfo);
 int gui_key_press_callback(PtWidget_t *widget, ApInfo_t *apinfo,
                           PtCallbackInfo_t *cbinfo);
+void gui_canvas_draw(PtWidget_t *widget, PhTile_t *damage);
+#endif
 
 /* Drawing Functions */
-void gui_draw_gauge_background(PtWidget_t *widget, PhTile_t *damage);
-void gui_draw_gauge_needle(PtWidget_t *widget, float value, float min_val, float max_val);
-void gui_draw_digital_display(PtWidget_t *widget, const char *text, PhPoint_t pos);
+void gui_draw_gauge_background(framebuffer_t *fb, const gauge_widget_t *gauge, gui_theme_t theme);
+void gui_draw_gauge_needle(framebuffer_t *fb, const gauge_widget_t *gauge, float value,
+                           gui_theme_t theme);
+void gui_draw_digital_display(framebuffer_t *fb, const char *text, PhPoint_t pos, PgColor_t color);
+void gui_draw_warning_light(framebuffer_t *fb, const warning_light_t *warning, bool lit,
+                            gui_theme_t theme);
 
 /* Theme Management */
 PgColor_t gui_get_theme_color(gui_theme_t theme, const char *element);
@@ -0,0 +1,43 @@
+/**
+ * QNX Dashboard Simulator - JSON Reader Header
+ *
+ * A cursor over a NUL-terminated JSON document, shared by the scenario
+ * compiler and the layout loader. Each format drives it with its own
+ * recursive-descent rules; the reader only tokenizes, skips values the
+ * caller does not know and keeps the first error with its line number.
+ */
+
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include "dashboard.h"
+
+typedef struct {
+    const char *cursor;
+    const char *end;
+    const char *start;
+    char error[128];
+} json_reader_t;
+
+/* JSON Reader Function Prototypes */
+void json_reader_init(json_reader_t *reader, const char *json, size_t length);  /* json NUL-terminated */
+bool json_reader_fail(json_reader_t *reader, const char *message);
+bool json_reader_finish(json_reader_t *reader);
+
+/* Tokens (each skips leading white space) */
+bool json_reader_expect(json_reader_t *reader, char expected);
+bool json_reader_peek(json_reader_t *reader, char c);
+bool json_reader_accept(json_reader_t *reader, char c);
+bool json_reader_string(json_reader_t *reader, const char **out, size_t *length);
+bool json_reader_string_copy(json_reader_t *reader, char *out, size_t size);
+bool json_reader_number(json_reader_t *reader, float *out);
+bool json_reader_bool(json_reader_t *reader, bool *out);
+bool json_reader_skip_value(json_reader_t *reader, int depth);
+
+/* Utility Functions */
+bool json_key_is(const char *key, size_t length, const char *name);
+
+/* Default Values */
+#define JSON_READER_MAX_DEPTH  32
+
+#endif /* JSON_READER_H */
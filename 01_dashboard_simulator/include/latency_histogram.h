@@ -0,0 +1,28 @@
+/**
+ * QNX Dashboard Simulator - Latency Histogram Header
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include "dashboard.h"
+
+/* Histogram Function Prototypes */
+void latency_histogram_reset(latency_histogram_t *hist);
+void latency_histogram_record(latency_histogram_t *hist, uint64_t value_ns);
+
+/* Queries (safe to call from any thread) */
+uint64_t latency_histogram_count(const latency_histogram_t *hist);
+uint64_t latency_histogram_percentile(const latency_histogram_t *hist, double percentile);
+uint64_t latency_histogram_max(const latency_histogram_t *hist);
+void latency_histogram_summarize(const latency_histogram_t *hist, latency_summary_t *summary);
+
+/* Bucket Mapping */
+uint32_t latency_bucket_index(uint64_t value_ns);
+uint64_t latency_bucket_upper_bound(uint32_t index);
+
+/* Utility Functions */
+const char *latency_stage_to_string(latency_stage_t stage);
+void latency_print_summary(const latency_summary_t summary[LATENCY_STAGE_COUNT]);
+
+#endif /* LATENCY_HISTOGRAM_H */
@@ -0,0 +1,31 @@
+/**
+ * QNX Dashboard Simulator - Periodic Task Header
+ */
+
+#ifndef PERIODIC_TASK_H
+#define PERIODIC_TASK_H
+
+#include "dashboard.h"
+
+/* Periodic Task Function Prototypes */
+void periodic_task_init(periodic_task_t *task, const char *name,
+                        uint32_t rate_hz, periodic_policy_t policy);
+void periodic_task_start(periodic_task_t *task);
+uint32_t periodic_task_wait(periodic_task_t *task);
+uint32_t periodic_task_wait_releases(periodic_task_t *task, uint32_t releases);
+
+/* Statistics */
+void periodic_task_read_statistics(const periodic_task_t *task, periodic_task_stats_t *out);
+uint32_t periodic_task_overruns(const periodic_task_t *task);
+float periodic_task_period_variance_ms2(const periodic_task_t *task);
+float periodic_task_average_lateness_ms(const periodic_task_t *task);
+void periodic_task_print_statistics(const periodic_task_t *task);
+
+/* Utility Functions */
+periodic_policy_t periodic_policy_from_string(const char *name, periodic_policy_t fallback);
+const char *periodic_policy_to_string(periodic_policy_t policy);
+
+/* Default Values */
+#define PERIODIC_DEFAULT_MAX_CATCH_UP  4   /* Activations */
+
+#endif /* PERIODIC_TASK_H */
@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Raster Kernels Header
+ */
+
+#ifndef RASTER_H
+#define RASTER_H
+
+#include "dashboard.h"
+
+/* Pixels closer than this outside a shape may still be touched */
+#define RASTER_EDGE_MARGIN        1.0f
+
+/* Span Kernels: pixels [x0, x1) of the row whose centre is at py */
+void raster_ring_span(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring);
+void raster_capsule_span(uint32_t *row, int x0, int x1, float py, const raster_capsule_t *capsule);
+void raster_fill_span(uint32_t *row, int x0, int x1, uint32_t color);
+
+/* Kernel Selection */
+int raster_set_isa(raster_isa_t isa);
+raster_isa_t raster_get_isa(void);
+raster_isa_t raster_best_isa(void);
+bool raster_isa_available(raster_isa_t isa);
+const char *raster_isa_to_string(raster_isa_t isa);
+
+#endif /* RASTER_H */
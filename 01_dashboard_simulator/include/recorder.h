@@ -0,0 +1,27 @@
+/**
+ * QNX Dashboard Simulator - Vehicle Data Recorder Header
+ *
+ * File layout: vehicle_record_header_t, vehicle_record_t entries in
+ * acquisition order, then (on a clean close) the sparse time index and
+ * vehicle_record_trailer_t.
+ */
+
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include "dashboard.h"
+
+/* Recorder Function Prototypes */
+int recorder_open(recorder_t *rec, const char *path, uint32_t sample_rate_hz);
+bool recorder_submit(recorder_t *rec, const vehicle_data_t *data);
+void recorder_close(recorder_t *rec);
+
+/* Record Encoding */
+void recorder_encode(const vehicle_data_t *data, uint32_t sequence, vehicle_record_t *record);
+void recorder_decode(const vehicle_record_t *record, vehicle_data_t *data);
+int recorder_validate_header(const vehicle_record_header_t *header);
+
+/* Statistics */
+void recorder_print_statistics(const recorder_t *rec);
+
+#endif /* RECORDER_H */
@@ -0,0 +1,22 @@
+/**
+ * QNX Dashboard Simulator - Render Pool Header
+ */
+
+#ifndef RENDER_POOL_H
+#define RENDER_POOL_H
+
+#include "dashboard.h"
+
+/* Render Pool Function Prototypes */
+int render_pool_init(render_pool_t *pool, uint32_t threads, const rt_thread_config_t *config);
+void render_pool_destroy(render_pool_t *pool);
+void render_pool_run(render_pool_t *pool, const framebuffer_t *target,
+                     const framebuffer_rect_t *tiles, uint32_t tile_count,
+                     render_tile_fn_t render_tile, void *context);
+
+/* Utility Functions */
+uint32_t render_pool_threads(const render_pool_t *pool);
+uint32_t render_pool_default_threads(void);
+void render_pool_print_statistics(const render_pool_t *pool);
+
+#endif /* RENDER_POOL_H */
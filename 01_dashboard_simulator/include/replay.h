@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Recording Replay Header
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "dashboard.h"
+
+/* Replay Function Prototypes */
+int replay_open(replay_t *replay, const char *path);
+void replay_close(replay_t *replay);
+bool replay_is_open(const replay_t *replay);
+
+/* Playback Control */
+uint64_t replay_seek(replay_t *replay, uint64_t time_ns);
+bool replay_advance(replay_t *replay, float delta_time, float speed, bool loop,
+                    vehicle_data_t *out);
+float replay_elapsed_seconds(const replay_t *replay);
+float replay_duration_seconds(const replay_t *replay);
+
+/* Statistics */
+void replay_print_statistics(const replay_t *replay);
+
+#endif /* REPLAY_H */
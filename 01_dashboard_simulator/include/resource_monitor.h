@@ -0,0 +1,22 @@
+/**
+ * QNX Dashboard Simulator - Resource Monitor Header
+ */
+
+#ifndef RESOURCE_MONITOR_H
+#define RESOURCE_MONITOR_H
+
+#include "dashboard.h"
+
+/* Resource Monitor Function Prototypes */
+int resource_monitor_initialize(resource_monitor_t *mon, uint32_t max_memory_mb,
+                                float max_cpu_percent);
+void resource_monitor_cleanup(resource_monitor_t *mon);
+int resource_monitor_attach_thread(resource_monitor_t *mon, app_thread_t which,
+                                   pthread_t thread);
+bool resource_monitor_sample(resource_monitor_t *mon, resource_usage_t *usage);
+
+/* Utility Functions */
+const char *app_thread_to_string(app_thread_t which);
+void resource_monitor_print(const resource_usage_t *usage);
+
+#endif /* RESOURCE_MONITOR_H */
@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Random Number Generator Header
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include "dashboard.h"
+
+/* Single Stream */
+void rng_seed(rng_t *rng, uint64_t seed);
+uint32_t rng_next(rng_t *rng);
+uint32_t rng_below(rng_t *rng, uint32_t bound);   /* Uniform in [0, bound) */
+float rng_uniform(rng_t *rng);                    /* [0, 1) */
+float rng_symmetric(rng_t *rng);                  /* [-1, 1) */
+
+/* Batch Generation (RNG_LANES streams per pass) */
+void rng_lanes_seed(rng_lanes_t *rng, uint64_t seed);
+void rng_fill_noise(rng_lanes_t *rng, float *out, const float *amplitude, uint32_t count);
+void rng_lanes_get(const rng_lanes_t *rng, uint32_t lane, rng_t *out);
+
+/* Utility Functions */
+const char *rng_simd_name(void);
+
+#endif /* RNG_H */
@@ -0,0 +1,22 @@
+/**
+ * QNX Dashboard Simulator - Real-Time Thread Launch Header
+ */
+
+#ifndef RT_THREAD_H
+#define RT_THREAD_H
+
+#include "dashboard.h"
+
+/* Thread Launch Function Prototypes */
+int rt_thread_create(pthread_t *thread, const rt_thread_config_t *config,
+                     void *(*start_routine)(void *), void *arg,
+                     rt_thread_report_t *report);
+int rt_lock_memory(void);
+
+/* Utility Functions */
+int rt_policy_from_string(const char *name, int fallback);
+const char *rt_policy_to_string(int policy);
+void rt_thread_print_report(const rt_thread_config_t *config,
+                            const rt_thread_report_t *report);
+
+#endif /* RT_THREAD_H */
@@ -0,0 +1,35 @@
+/**
+ * QNX Dashboard Simulator - Scenario Compiler Header
+ *
+ * Scenario files are JSON:
+ *
+ *   {
+ *     "name": "city_drive",
+ *     "duration": 60.0,
+ *     "signals": {
+ *       "speed_kmh": [[0.0, 0.0], [12.0, 50.0], [30.0, 50.0]],
+ *       "gear_position": [[0.0, 1], [4.0, 2], [9.0, 3]]
+ *     }
+ *   }
+ *
+ * Keyframes are [seconds, value] in non-decreasing time order. Analogue
+ * signals are interpolated linearly; gear and status flags hold their
+ * value until the next keyframe. Signals not listed keep their state.
+ */
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include "dashboard.h"
+
+/* Scenario Function Prototypes */
+int scenario_load(scenario_t *scenario, const char *filename);
+int scenario_parse(scenario_t *scenario, const char *json, size_t length);  /* json NUL-terminated */
+void scenario_free(scenario_t *scenario);
+void scenario_reset(scenario_t *scenario);
+
+/* Evaluation (no allocation or parsing) */
+void scenario_evaluate(scenario_t *scenario, float time_s, float values[SIGNAL_COUNT]);
+bool scenario_drives_signal(const scenario_t *scenario, signal_id_t signal);
+
+#endif /* SCENARIO_H */
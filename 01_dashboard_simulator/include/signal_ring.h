@@ -0,0 +1,24 @@
+/**
+ * QNX Dashboard Simulator - Signal Ingest Ring Header
+ */
+
+#ifndef SIGNAL_RING_H
+#define SIGNAL_RING_H
+
+#include "dashboard.h"
+
+/* Ring Function Prototypes */
+void signal_ring_init(signal_ring_t *ring, signal_ring_policy_t policy);
+bool signal_ring_push(signal_ring_t *ring, uint32_t signal, float value, uint64_t timestamp_ns);
+uint32_t signal_ring_pop_batch(signal_ring_t *ring, signal_sample_t *out, uint32_t max_samples);
+uint32_t signal_ring_size(const signal_ring_t *ring);
+
+/* Utility Functions */
+const char *signal_id_to_string(signal_id_t signal);
+int signal_id_from_string(const char *name, size_t length);
+signal_ring_policy_t signal_ring_policy_from_string(const char *name,
+                                                    signal_ring_policy_t fallback);
+const char *signal_ring_policy_to_string(signal_ring_policy_t policy);
+void signal_ring_print_statistics(const signal_ring_t *ring);
+
+#endif /* SIGNAL_RING_H */
@@ -0,0 +1,20 @@
+/**
+ * QNX Dashboard Simulator - Simulator Pool Header
+ */
+
+#ifndef SIMULATOR_POOL_H
+#define SIMULATOR_POOL_H
+
+#include "dashboard.h"
+
+/* Simulator Pool Function Prototypes */
+int simulator_pool_init(simulator_pool_t *pool, uint32_t simulators, uint32_t workers);
+void simulator_pool_destroy(simulator_pool_t *pool);
+void simulator_pool_run(simulator_pool_t *pool, float delta_time, uint32_t steps);
+
+/* Utility Functions */
+data_simulator_t *simulator_pool_get(simulator_pool_t *pool, uint32_t index);
+uint32_t simulator_pool_default_workers(void);
+void simulator_pool_print_statistics(const simulator_pool_t *pool);
+
+#endif /* SIMULATOR_POOL_H */
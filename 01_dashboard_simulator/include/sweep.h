@@ -0,0 +1,25 @@
+/**
+ * QNX Dashboard Simulator - Parameter Sweep Header
+ */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include "dashboard.h"
+
+/* Sweep Function Prototypes */
+void sweep_init(sweep_t *sweep, uint32_t runs);
+int sweep_set_range(sweep_t *sweep, sweep_param_t param, float min_value, float max_value);
+int sweep_parse_range(sweep_t *sweep, const char *spec);   /* "name=min:max" */
+int sweep_run(sweep_t *sweep);
+void sweep_run_one(const sweep_t *sweep, uint32_t run, sweep_result_t *result);
+void sweep_free(sweep_t *sweep);
+
+/* Output */
+int sweep_write_csv(const sweep_t *sweep, const char *path);
+void sweep_print_summary(const sweep_t *sweep);
+
+/* Utility Functions */
+const char *sweep_param_name(sweep_param_t param);
+
+#endif /* SWEEP_H */
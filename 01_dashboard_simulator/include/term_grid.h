@@ -0,0 +1,92 @@
+/**
+ * QNX Dashboard Simulator - Terminal Cell Grid Header
+ *
+ * Self-contained (no dashboard.h) so the standalone console programs can
+ * share it with their own vehicle_data_t definitions.
+ */
+
+#ifndef TERM_GRID_H
+#define TERM_GRID_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+/* Grid Limits */
+#define TERM_GRID_MAX_ROWS        100
+#define TERM_GRID_MAX_COLS        250
+#define TERM_GLYPH_BYTES          8       /* One code point plus variation selectors */
+
+/* ANSI colour indices; TERM_DEFAULT keeps the terminal's own colour */
+#define TERM_BLACK                0
+#define TERM_RED                  1
+#define TERM_GREEN                2
+#define TERM_YELLOW               3
+#define TERM_BLUE                 4
+#define TERM_MAGENTA              5
+#define TERM_CYAN                 6
+#define TERM_WHITE                7
+#define TERM_DEFAULT              9
+
+#define TERM_BOLD                 0x100
+#define TERM_ATTR(fg, bg, flags)  ((uint16_t)((fg) | ((bg) << 4) | (flags)))
+#define TERM_ATTR_NORMAL          TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, 0)
+
+/**
+ * One screen cell
+ */
+typedef struct {
+    char glyph[TERM_GLYPH_BYTES];  /* UTF-8, NUL padded; empty for the right half of a wide glyph */
+    uint16_t attr;                 /* TERM_ATTR() */
+    uint8_t width;                 /* Columns: 1, 2, or 0 for a wide glyph's right half */
+    uint8_t reserved;              /* Keeps cells comparable with memcmp() */
+} term_cell_t;
+
+/**
+ * Back buffer drawn by the application, front buffer as the terminal shows it
+ */
+typedef struct {
+    int rows;
+    int cols;
+    term_cell_t *back;
+    term_cell_t *front;
+    
+    char *out;                     /* Escape sequences for one frame */
+    size_t out_capacity;
+    bool full_redraw;              /* Clear the screen before the next frame */
+    
+    /* Statistics */
+    uint64_t frames;
+    uint64_t bytes_written;
+    uint64_t cells_changed;
+    uint64_t render_time_ns;       /* Diff and encode, excluding write() */
+    size_t max_frame_bytes;
+} term_grid_t;
+
+/* Cell Grid Function Prototypes */
+int term_grid_init(term_grid_t *grid, int rows, int cols);
+void term_grid_free(term_grid_t *grid);
+void term_grid_clear(term_grid_t *grid, uint16_t attr);
+void term_grid_invalidate(term_grid_t *grid);
+
+/* Drawing; each returns the column after the last cell written */
+int term_grid_put(term_grid_t *grid, int row, int col, uint16_t attr, const char *text);
+int term_grid_printf(term_grid_t *grid, int row, int col, uint16_t attr, const char *format, ...)
+    __attribute__((format(printf, 5, 6)));
+int term_grid_fill(term_grid_t *grid, int row, int col, int count, uint16_t attr, const char *glyph);
+
+/* Slot patching for prebuilt layouts: fixed width, no format parsing */
+void term_cell_make(term_cell_t *cell, const char *glyph, uint16_t attr);
+int term_grid_put_cell(term_grid_t *grid, int row, int col, const term_cell_t *cell);
+int term_grid_put_fixed(term_grid_t *grid, int row, int col, int width, int decimals,
+                        uint16_t attr, float value);
+int term_grid_put_uint(term_grid_t *grid, int row, int col, int width, uint16_t attr,
+                       unsigned value, bool zero_pad);
+
+/* Output */
+size_t term_grid_render(term_grid_t *grid);
+ssize_t term_grid_flush(term_grid_t *grid, int fd);
+void term_grid_print_statistics(const term_grid_t *grid);
+
+#endif /* TERM_GRID_H */
@@ -0,0 +1,16 @@
+/**
+ * QNX Dashboard Simulator - Vehicle Snapshot Header
+ */
+
+#ifndef VEHICLE_SNAPSHOT_H
+#define VEHICLE_SNAPSHOT_H
+
+#include "dashboard.h"
+
+/* Snapshot Function Prototypes */
+void vehicle_snapshot_init(vehicle_snapshot_t *snap, const vehicle_data_t *initial);
+void vehicle_snapshot_publish(vehicle_snapshot_t *snap, const vehicle_data_t *data);
+uint32_t vehicle_snapshot_read(const vehicle_snapshot_t *snap, vehicle_data_t *out);
+uint32_t vehicle_snapshot_version(const vehicle_snapshot_t *snap);
+
+#endif /* VEHICLE_SNAPSHOT_H */
@@ -0,0 +1,65 @@
+/**
+ * QNX Dashboard Simulator - Widget Tree Header
+ *
+ * Layout files are JSON:
+ *
+ *   {
+ *     "name": "classic",
+ *     "width": 1024, "height": 768,
+ *     "widgets": [
+ *       {"type": "dial", "label": "SPEED", "signal": "speed_kmh",
+ *        "x": 100, "y": 100, "size": 200, "min": 0, "max": 300,
+ *        "warning": 200, "critical": 250},
+ *       {"type": "group", "x": 600, "y": 100, "width": 220, "height": 100,
+ *        "panel": true, "label": "STATUS", "children": [
+ *         {"type": "light", "label": "OIL", "signal": "oil_pressure",
+ *          "below": 10, "x": 0, "y": 0, "width": 100, "height": 40},
+ *         {"type": "readout", "label": "BATT", "signal": "battery_voltage",
+ *          "decimals": 1, "unit": "V", "x": 120, "y": 0, "width": 100, "height": 40}
+ *       ]}
+ *     ]
+ *   }
+ *
+ * Types are group, dial, bar, readout and light. Children are positioned
+ * relative to their group. A dial, bar or readout follows its signal
+ * between min and max ("warning" and "critical" pick the zone colours;
+ * critical below warning means low values are bad). A light is lit while
+ * its signal is "above" or "below" a threshold, optionally blinking, in
+ * the colour of its "level" (info, warning or critical). A readout with
+ * "format": "gear" shows R, N or the gear number. A dial or bar moves to
+ * new values over the theme's animation duration divided by its
+ * "animation_speed" (default 1). Coordinates are scaled from width x
+ * height to the actual screen.
+ */
+
+#ifndef WIDGET_TREE_H
+#define WIDGET_TREE_H
+
+#include "dashboard.h"
+
+/* Widget Tree Function Prototypes */
+int widget_tree_init(widget_tree_t *tree);
+void widget_tree_free(widget_tree_t *tree);
+int widget_tree_add(widget_tree_t *tree, int parent, widget_kind_t kind, framebuffer_rect_t box);
+void widget_tree_finalize(widget_tree_t *tree);
+void widget_tree_fit(widget_tree_t *tree, int width, int height);
+
+/* Layout Files */
+int widget_tree_load(widget_tree_t *tree, const char *filename);
+int widget_tree_parse(widget_tree_t *tree, const char *json, size_t length);  /* json NUL-terminated */
+
+/* Data Binding */
+int widget_tree_update(widget_tree_t *tree, const vehicle_data_t *data);
+void widget_tree_activate(widget_tree_t *tree, int index);
+
+/* Damage Tracking */
+void widget_tree_mark_dirty(widget_tree_t *tree, int index, framebuffer_rect_t rect);
+void widget_tree_collect_damage(widget_tree_t *tree, widget_damage_fn_t emit, void *context);
+
+/* Utility Functions */
+bool widget_rect_intersects(framebuffer_rect_t a, framebuffer_rect_t b);
+framebuffer_rect_t widget_rect_union(framebuffer_rect_t a, framebuffer_rect_t b);
+const char *widget_kind_to_string(widget_kind_t kind);
+void widget_tree_print_statistics(const widget_tree_t *tree);
+
+#endif /* WIDGET_TREE_H */
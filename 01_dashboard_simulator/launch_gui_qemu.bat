@@ -32,7 +32,7 @@ echo.
 echo [3/5] Checking Dashboard Applications...
 if not exist "gui_dashboard" (
     echo [INFO] Building GUI dashboard...
-    qcc -Vgcc_ntox86_64 -o gui_dashboard gui_dashboard.c -lm
+    qcc -Vgcc_ntox86_64 -o gui_dashboard src/gui_dashboard.c src/term_grid.c -lm
     if %errorlevel% neq 0 (
         echo [ERROR] Failed to build GUI dashboard
         pause
@@ -43,7 +43,7 @@ echo [OK] GUI Dashboard ready
 
 if not exist "console_dashboard" (
     echo [INFO] Building console dashboard...
-    qcc -Vgcc_ntox86_64 -o console_dashboard src/console_dashboard.c -lm
+    qcc -Vgcc_ntox86_64 -o console_dashboard src/console_dashboard.c src/term_grid.c -lm
     if %errorlevel% neq 0 (
         echo [ERROR] Failed to build console dashboard
         pause
@@ -0,0 +1,704 @@
+/**
+ * ===============================================================================
+ * QNX Automotive Dashboard Simulator - Configuration Manager
+ * ===============================================================================
+ *
+ * The configuration file is INI: [section] headers and "key = value" lines,
+ * '#' or ';' starting a comment line. Every known key is described once in
+ * g_config_fields (section, key, type and where it lives in
+ * dashboard_config_t); parsing, the generic getters and setters, saving and
+ * the built-in defaults all go through that table. The defaults are
+ * DEFAULT_CONFIG_TEMPLATE itself, parsed like any file, so the template
+ * written by config_create_default_file() and the values used without a
+ * file cannot disagree.
+ *
+ * Sections the simulator does not read yet ([vehicle], [gauges], ...) are
+ * skipped. A file is parsed into a copy that replaces the live
+ * configuration only once it has parsed and validated, so a bad edit never
+ * leaves half-applied settings. Settings are read at startup; hot-reloading
+ * keeps g_dashboard_config current and reports errors in an edited file
+ * straight away.
+ */
+
+#include <stddef.h>
+#include <ctype.h>
+#include <math.h>
+#include <errno.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include "../include/config.h"
+
+/* Global configuration instance */
+dashboard_config_t g_dashboard_config = {0};
+
+/**
+ * One configuration key and its storage
+ */
+typedef struct {
+    const char *section;
+    const char *key;
+    config_value_type_t type;
+    size_t offset;
+    size_t size;               /* Capacity of string values */
+} config_field_t;
+
+#define CONFIG_FIELD(section, group, member, type) \
+    { section, #member, type, offsetof(dashboard_config_t, group.member), \
+      sizeof(((dashboard_config_t *)0)->group.member) }
+
+static const config_field_t g_config_fields[] = {
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, window_width, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, window_height, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, fullscreen, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, vsync_enabled, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, refresh_rate, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, brightness, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, theme_name, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, hardware_acceleration, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_DISPLAY, display, layout_file, CONFIG_TYPE_STRING),
+
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, gui_update_rate_hz, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, data_update_rate_hz, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, monitor_update_rate_hz, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, enable_profiling, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, enable_statistics, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, max_memory_usage_mb, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, max_cpu_usage_percent, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, max_data_latency_ms, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, gui_deadline_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, data_deadline_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, monitor_deadline_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, adaptive_frame_rate, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, min_gui_rate_hz, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, idle_gui_rate_hz, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, visual_epsilon_px, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, gui_thread_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, data_thread_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, monitor_thread_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, gui_thread_priority, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, data_thread_priority, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, monitor_thread_priority, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, gui_thread_cpu, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, data_thread_cpu, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, monitor_thread_cpu, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_PERFORMANCE, performance, lock_memory, CONFIG_TYPE_BOOLEAN),
+
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, simulation_mode, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, realistic_physics, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, physics_timestep, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, enable_scenarios, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, scenario_file, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, loop_scenarios, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, simulation_speed, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, ingest_overflow_policy, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, enable_recording, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, record_file, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_SIMULATION, simulation, replay_file, CONFIG_TYPE_STRING),
+
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, enable_safety_monitoring, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, max_speed_kmh, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, max_rpm, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, overheat_threshold, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, low_fuel_threshold, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, enable_warnings, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, strict_validation, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_SAFETY, safety, watchdog_timeout_ms, CONFIG_TYPE_INTEGER),
+
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, current_theme, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, auto_theme_switching, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, day_theme_start_hour, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, night_theme_start_hour, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, gauge_scale_factor, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, enable_animations, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, animation_duration_ms, CONFIG_TYPE_INTEGER),
+    CONFIG_FIELD(CONFIG_SECTION_THEME, theme, animation_curve, CONFIG_TYPE_STRING),
+
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, enable_audio, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, master_volume, CONFIG_TYPE_FLOAT),
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, enable_warning_sounds, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, enable_turn_signals, CONFIG_TYPE_BOOLEAN),
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, audio_device, CONFIG_TYPE_STRING),
+    CONFIG_FIELD(CONFIG_SECTION_AUDIO, audio, sample_rate, CONFIG_TYPE_INTEGER),
+};
+
+#define CONFIG_FIELD_COUNT (sizeof(g_config_fields) / sizeof(g_config_fields[0]))
+
+static const char *const g_config_sections[] = {
+    CONFIG_SECTION_DISPLAY, CONFIG_SECTION_PERFORMANCE, CONFIG_SECTION_SIMULATION,
+    CONFIG_SECTION_SAFETY, CONFIG_SECTION_THEME, CONFIG_SECTION_AUDIO
+};
+
+#define CONFIG_SECTION_COUNT (sizeof(g_config_sections) / sizeof(g_config_sections[0]))
+
+/**
+ * Table lookups
+ */
+static bool config_section_known(const char *section) {
+    for (size_t i = 0; i < CONFIG_SECTION_COUNT; i++) {
+        if (strcmp(g_config_sections[i], section) == 0) return true;
+    }
+    return false;
+}
+
+static const config_field_t *config_find_field(const char *section, const char *key) {
+    if (!section || !key) return NULL;
+
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if (strcmp(g_config_fields[i].section, section) == 0 &&
+            strcmp(g_config_fields[i].key, key) == 0) {
+            return &g_config_fields[i];
+        }
+    }
+    return NULL;
+}
+
+static void *config_field_ptr(dashboard_config_t *config, const config_field_t *field) {
+    return (char *)config + field->offset;
+}
+
+static const void *config_field_cptr(const dashboard_config_t *config, const config_field_t *field) {
+    return (const char *)config + field->offset;
+}
+
+/**
+ * Strip leading and trailing white space in place
+ */
+static char *config_trim(char *text) {
+    while (isspace((unsigned char)*text)) text++;
+
+    char *end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) end--;
+    *end = '\0';
+    return text;
+}
+
+static bool config_parse_boolean(const char *value, bool *out) {
+    if (strcasecmp(value, "true") == 0 || strcasecmp(value, "yes") == 0 ||
+        strcasecmp(value, "on") == 0 || strcmp(value, "1") == 0) {
+        *out = true;
+        return true;
+    }
+    if (strcasecmp(value, "false") == 0 || strcasecmp(value, "no") == 0 ||
+        strcasecmp(value, "off") == 0 || strcmp(value, "0") == 0) {
+        *out = false;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Configuration management
+ */
+config_result_t config_initialize(dashboard_config_t *config) {
+    if (!config) return CONFIG_ERROR_INVALID_VALUE;
+
+    return config_reset_to_defaults(config);
+}
+
+/**
+ * Built-in values: DEFAULT_CONFIG_TEMPLATE parsed like a file
+ */
+config_result_t config_reset_to_defaults(dashboard_config_t *config) {
+    if (!config) return CONFIG_ERROR_INVALID_VALUE;
+
+    memset(config, 0, sizeof(dashboard_config_t));
+    CONFIG_SAFE_STRCPY(config->version, CONFIG_FILE_VERSION, sizeof(config->version));
+    config->config_format_version = CONFIG_FORMAT_VERSION;
+
+    const char *cursor = DEFAULT_CONFIG_TEMPLATE;
+    char section[MAX_CONFIG_SECTION_LENGTH] = "";
+    char line[MAX_CONFIG_LINE_LENGTH];
+
+    while (*cursor) {
+        size_t length = strcspn(cursor, "\n");
+        if (length >= sizeof(line)) return CONFIG_ERROR_PARSE_ERROR;
+        memcpy(line, cursor, length);
+        line[length] = '\0';
+        cursor += length + (cursor[length] == '\n' ? 1 : 0);
+
+        char *text = config_trim(line);
+        if (text[0] == '[') {
+            char *close = strchr(text, ']');
+            if (!close) return CONFIG_ERROR_PARSE_ERROR;
+            *close = '\0';
+            CONFIG_SAFE_STRCPY(section, text + 1, sizeof(section));
+            continue;
+        }
+
+        config_result_t result = config_parse_line(config, text, section);
+        if (result != CONFIG_SUCCESS) return result;
+    }
+
+    config->modified = false;
+    return CONFIG_SUCCESS;
+}
+
+/**
+ * Load a file over the built-in defaults
+ *
+ * config is only replaced when the whole file parses and validates.
+ */
+config_result_t config_load(dashboard_config_t *config, const char *filename) {
+    if (!config || !filename) return CONFIG_ERROR_INVALID_VALUE;
+
+    struct stat info;
+    FILE *file = fopen(filename, "r");
+    if (!file || fstat(fileno(file), &info) != 0) {
+        if (file) fclose(file);
+        return CONFIG_ERROR_FILE_NOT_FOUND;
+    }
+
+    dashboard_config_t *loaded = malloc(sizeof(dashboard_config_t));
+    if (!loaded) {
+        fclose(file);
+        return CONFIG_ERROR_MEMORY_ALLOCATION;
+    }
+
+    config_result_t result = config_reset_to_defaults(loaded);
+    if (result == CONFIG_SUCCESS) {
+        result = config_parse_file(loaded, file);
+    }
+    fclose(file);
+
+    if (result == CONFIG_SUCCESS && !config_validate(loaded)) {
+        result = CONFIG_ERROR_INVALID_VALUE;
+    }
+
+    if (result == CONFIG_SUCCESS) {
+        CONFIG_SAFE_STRCPY(loaded->config_file_path, filename, sizeof(loaded->config_file_path));
+        strftime(loaded->last_modified, sizeof(loaded->last_modified), "%Y-%m-%d %H:%M:%S",
+                 localtime(&info.st_mtime));
+        loaded->file_mtime = info.st_mtime;
+        loaded->file_size = (long long)info.st_size;
+        loaded->loaded = true;
+        loaded->modified = false;
+        *config = *loaded;
+    }
+
+    free(loaded);
+    return result;
+}
+
+/**
+ * Write every known key, grouped by section
+ */
+config_result_t config_save(const dashboard_config_t *config, const char *filename) {
+    if (!config || !filename) return CONFIG_ERROR_INVALID_VALUE;
+
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Config: cannot write %s: %s\n", filename, strerror(errno));
+        return CONFIG_ERROR_FILE_NOT_FOUND;
+    }
+
+    fprintf(file, "# QNX Automotive Dashboard Simulator - Configuration File\n");
+    fprintf(file, "# Version: %s\n", config->version[0] ? config->version : CONFIG_FILE_VERSION);
+
+    for (size_t s = 0; s < CONFIG_SECTION_COUNT; s++) {
+        fprintf(file, "\n[%s]\n", g_config_sections[s]);
+        for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+            const config_field_t *field = &g_config_fields[i];
+            if (strcmp(field->section, g_config_sections[s]) != 0) continue;
+
+            const void *value = config_field_cptr(config, field);
+            switch (field->type) {
+                case CONFIG_TYPE_STRING:
+                    fprintf(file, "%s = %s\n", field->key, (const char *)value);
+                    break;
+                case CONFIG_TYPE_INTEGER:
+                    fprintf(file, "%s = %d\n", field->key, *(const int *)value);
+                    break;
+                case CONFIG_TYPE_FLOAT:
+                    fprintf(file, "%s = %g\n", field->key, *(const float *)value);
+                    break;
+                case CONFIG_TYPE_BOOLEAN:
+                    fprintf(file, "%s = %s\n", field->key, *(const bool *)value ? "true" : "false");
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    bool ok = ferror(file) == 0;
+    if (fclose(file) != 0) ok = false;
+    return ok ? CONFIG_SUCCESS : CONFIG_ERROR_FILE_NOT_FOUND;
+}
+
+void config_cleanup(dashboard_config_t *config) {
+    if (!config) return;
+
+    memset(config, 0, sizeof(dashboard_config_t));
+}
+
+/**
+ * Configuration parsing
+ */
+config_result_t config_parse_file(dashboard_config_t *config, FILE *file) {
+    if (!config || !file) return CONFIG_ERROR_INVALID_VALUE;
+
+    char section[MAX_CONFIG_SECTION_LENGTH] = "";
+    char line[MAX_CONFIG_LINE_LENGTH];
+    int line_number = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        line_number++;
+        if (!strchr(line, '\n') && !feof(file)) {
+            fprintf(stderr, "Config: line %d: longer than %d characters\n",
+                    line_number, MAX_CONFIG_LINE_LENGTH - 2);
+            return CONFIG_ERROR_PARSE_ERROR;
+        }
+
+        char *text = config_trim(line);
+        if (text[0] == '[') {
+            char *close = strchr(text, ']');
+            if (!close || close == text + 1 || (size_t)(close - text - 1) >= sizeof(section)) {
+                fprintf(stderr, "Config: line %d: bad section header\n", line_number);
+                return CONFIG_ERROR_PARSE_ERROR;
+            }
+            *close = '\0';
+            CONFIG_SAFE_STRCPY(section, config_trim(text + 1), sizeof(section));
+            continue;
+        }
+
+        config_result_t result = config_parse_line(config, text, section);
+        if (result != CONFIG_SUCCESS) {
+            fprintf(stderr, "Config: line %d: %s\n", line_number, config_result_to_string(result));
+            return result;
+        }
+    }
+
+    return ferror(file) ? CONFIG_ERROR_PARSE_ERROR : CONFIG_SUCCESS;
+}
+
+/**
+ * One "key = value" line (blank and comment lines are accepted)
+ */
+config_result_t config_parse_line(dashboard_config_t *config, const char *line,
+                                  const char *current_section) {
+    if (!config || !line) return CONFIG_ERROR_INVALID_VALUE;
+
+    char buffer[MAX_CONFIG_LINE_LENGTH];
+    CONFIG_SAFE_STRCPY(buffer, line, sizeof(buffer));
+
+    char *text = config_trim(buffer);
+    if (text[0] == '\0' || text[0] == '#' || text[0] == ';') return CONFIG_SUCCESS;
+
+    char *equals = strchr(text, '=');
+    if (!equals) return CONFIG_ERROR_PARSE_ERROR;
+    *equals = '\0';
+
+    char *key = config_trim(text);
+    char *value = config_trim(equals + 1);
+    if (key[0] == '\0') return CONFIG_ERROR_PARSE_ERROR;
+
+    return config_set_value(config, current_section ? current_section : "", key, value);
+}
+
+/**
+ * Store a value given as text in its field
+ *
+ * Keys of sections the simulator does not use are ignored; an unknown key
+ * in a known section is reported and ignored.
+ */
+config_result_t config_set_value(dashboard_config_t *config, const char *section,
+                                 const char *key, const char *value) {
+    if (!config || !section || !key || !value) return CONFIG_ERROR_INVALID_VALUE;
+
+    const config_field_t *field = config_find_field(section, key);
+    if (!field) {
+        if (config_section_known(section)) {
+            printf("Warning: Unknown configuration key %s.%s ignored\n", section, key);
+        }
+        CONFIG_DEBUG("ignored %s.%s = %s", section, key, value);
+        return CONFIG_SUCCESS;
+    }
+
+    void *target = config_field_ptr(config, field);
+    char *end;
+    switch (field->type) {
+        case CONFIG_TYPE_STRING:
+            if (strlen(value) >= field->size) {
+                fprintf(stderr, "Config: %s.%s is longer than %zu characters\n",
+                        section, key, field->size - 1);
+                return CONFIG_ERROR_INVALID_VALUE;
+            }
+            strcpy((char *)target, value);
+            break;
+        case CONFIG_TYPE_INTEGER: {
+            errno = 0;
+            long number = strtol(value, &end, 0);
+            if (end == value || *end != '\0' || errno != 0 || number < INT32_MIN || number > INT32_MAX) {
+                fprintf(stderr, "Config: %s.%s = '%s' is not an integer\n", section, key, value);
+                return CONFIG_ERROR_INVALID_VALUE;
+            }
+            *(int *)target = (int)number;
+            break;
+        }
+        case CONFIG_TYPE_FLOAT: {
+            float number = strtof(value, &end);
+            if (end == value || *end != '\0' || !isfinite(number)) {
+                fprintf(stderr, "Config: %s.%s = '%s' is not a number\n", section, key, value);
+                return CONFIG_ERROR_INVALID_VALUE;
+            }
+            *(float *)target = number;
+            break;
+        }
+        case CONFIG_TYPE_BOOLEAN:
+            if (!config_parse_boolean(value, (bool *)target)) {
+                fprintf(stderr, "Config: %s.%s = '%s' is not true or false\n", section, key, value);
+                return CONFIG_ERROR_INVALID_VALUE;
+            }
+            break;
+        default:
+            return CONFIG_ERROR_INVALID_VALUE;
+    }
+
+    config->modified = true;
+    CONFIG_DEBUG("%s.%s = %s", section, key, value);
+    return CONFIG_SUCCESS;
+}
+
+/**
+ * Configuration validation
+ */
+bool config_validate(const dashboard_config_t *config) {
+    if (!config) return false;
+
+    return config_validate_display(&config->display) &&
+           config_validate_performance(&config->performance) &&
+           config_validate_simulation(&config->simulation) &&
+           config_validate_safety(&config->safety);
+}
+
+bool config_validate_display(const display_config_t *display) {
+    if (!display) return false;
+
+    CONFIG_VALIDATE_RANGE(display->window_width, 64, 7680, "display.window_width");
+    CONFIG_VALIDATE_RANGE(display->window_height, 64, 4320, "display.window_height");
+    CONFIG_VALIDATE_RANGE(display->refresh_rate, 1, 240, "display.refresh_rate");
+    CONFIG_VALIDATE_RANGE(display->brightness, 0.0f, 1.0f, "display.brightness");
+    return true;
+}
+
+bool config_validate_performance(const performance_config_t *performance) {
+    if (!performance) return false;
+
+    CONFIG_VALIDATE_RANGE(performance->gui_update_rate_hz, 1, 1000, "performance.gui_update_rate_hz");
+    CONFIG_VALIDATE_RANGE(performance->data_update_rate_hz, 1, 10000, "performance.data_update_rate_hz");
+    CONFIG_VALIDATE_RANGE(performance->monitor_update_rate_hz, 1, 1000,
+                          "performance.monitor_update_rate_hz");
+    CONFIG_VALIDATE_RANGE(performance->max_memory_usage_mb, 1, 65536, "performance.max_memory_usage_mb");
+    CONFIG_VALIDATE_RANGE(performance->max_cpu_usage_percent, 1.0f, 100.0f,
+                          "performance.max_cpu_usage_percent");
+    CONFIG_VALIDATE_RANGE(performance->max_data_latency_ms, 0.1f, 10000.0f,
+                          "performance.max_data_latency_ms");
+    CONFIG_VALIDATE_RANGE(performance->min_gui_rate_hz, 1, performance->gui_update_rate_hz,
+                          "performance.min_gui_rate_hz");
+    CONFIG_VALIDATE_RANGE(performance->idle_gui_rate_hz, 1, performance->gui_update_rate_hz,
+                          "performance.idle_gui_rate_hz");
+    CONFIG_VALIDATE_RANGE(performance->visual_epsilon_px, 0.0f, 100.0f, "performance.visual_epsilon_px");
+    CONFIG_VALIDATE_RANGE(performance->gui_thread_cpu, -1, 1023, "performance.gui_thread_cpu");
+    CONFIG_VALIDATE_RANGE(performance->data_thread_cpu, -1, 1023, "performance.data_thread_cpu");
+    CONFIG_VALIDATE_RANGE(performance->monitor_thread_cpu, -1, 1023, "performance.monitor_thread_cpu");
+    return true;
+}
+
+bool config_validate_simulation(const simulation_config_t *simulation) {
+    if (!simulation) return false;
+
+    CONFIG_VALIDATE_RANGE(simulation->physics_timestep, 0.0001f, 1.0f, "simulation.physics_timestep");
+    CONFIG_VALIDATE_RANGE(simulation->simulation_speed, 0.01f, 1000.0f, "simulation.simulation_speed");
+    return true;
+}
+
+bool config_validate_safety(const safety_config_t *safety) {
+    if (!safety) return false;
+
+    CONFIG_VALIDATE_RANGE(safety->max_speed_kmh, 1.0f, 1000.0f, "safety.max_speed_kmh");
+    CONFIG_VALIDATE_RANGE(safety->max_rpm, 100.0f, 30000.0f, "safety.max_rpm");
+    CONFIG_VALIDATE_RANGE(safety->low_fuel_threshold, 0.0f, 100.0f, "safety.low_fuel_threshold");
+    CONFIG_VALIDATE_RANGE(safety->watchdog_timeout_ms, 1, 600000, "safety.watchdog_timeout_ms");
+    return true;
+}
+
+/**
+ * Configuration getters (default_value when the key is unknown)
+ */
+const char *config_get_string(const dashboard_config_t *config, const char *section,
+                             const char *key, const char *default_value) {
+    const config_field_t *field = config ? config_find_field(section, key) : NULL;
+    if (!field || field->type != CONFIG_TYPE_STRING) return default_value;
+    return (const char *)config_field_cptr(config, field);
+}
+
+int config_get_integer(const dashboard_config_t *config, const char *section,
+                      const char *key, int default_value) {
+    const config_field_t *field = config ? config_find_field(section, key) : NULL;
+    if (!field) return default_value;
+
+    const void *value = config_field_cptr(config, field);
+    switch (field->type) {
+        case CONFIG_TYPE_INTEGER: return *(const int *)value;
+        case CONFIG_TYPE_FLOAT: return (int)*(const float *)value;
+        case CONFIG_TYPE_BOOLEAN: return *(const bool *)value ? 1 : 0;
+        default: return default_value;
+    }
+}
+
+float config_get_float(const dashboard_config_t *config, const char *section,
+                      const char *key, float default_value) {
+    const config_field_t *field = config ? config_find_field(section, key) : NULL;
+    if (!field) return default_value;
+
+    const void *value = config_field_cptr(config, field);
+    switch (field->type) {
+        case CONFIG_TYPE_INTEGER: return (float)*(const int *)value;
+        case CONFIG_TYPE_FLOAT: return *(const float *)value;
+        case CONFIG_TYPE_BOOLEAN: return *(const bool *)value ? 1.0f : 0.0f;
+        default: return default_value;
+    }
+}
+
+bool config_get_boolean(const dashboard_config_t *config, const char *section,
+                       const char *key, bool default_value) {
+    const config_field_t *field = config ? config_find_field(section, key) : NULL;
+    if (!field) return default_value;
+
+    const void *value = config_field_cptr(config, field);
+    switch (field->type) {
+        case CONFIG_TYPE_INTEGER: return *(const int *)value != 0;
+        case CONFIG_TYPE_FLOAT: return *(const float *)value != 0.0f;
+        case CONFIG_TYPE_BOOLEAN: return *(const bool *)value;
+        default: return default_value;
+    }
+}
+
+/**
+ * Configuration setters (values go through the same parsing as the file)
+ */
+config_result_t config_set_string(dashboard_config_t *config, const char *section,
+                                  const char *key, const char *value) {
+    return config_set_value(config, section, key, value);
+}
+
+config_result_t config_set_integer(dashboard_config_t *config, const char *section,
+                                   const char *key, int value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%d", value);
+    return config_set_value(config, section, key, text);
+}
+
+config_result_t config_set_float(dashboard_config_t *config, const char *section,
+                                 const char *key, float value) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.9g", value);
+    return config_set_value(config, section, key, text);
+}
+
+config_result_t config_set_boolean(dashboard_config_t *config, const char *section,
+                                   const char *key, bool value) {
+    return config_set_value(config, section, key, value ? "true" : "false");
+}
+
+/**
+ * Utility functions
+ */
+const char *config_result_to_string(config_result_t result) {
+    switch (result) {
+        case CONFIG_SUCCESS: return "success";
+        case CONFIG_ERROR_FILE_NOT_FOUND: return "file not found";
+        case CONFIG_ERROR_PARSE_ERROR: return "parse error";
+        case CONFIG_ERROR_INVALID_VALUE: return "invalid value";
+        case CONFIG_ERROR_MEMORY_ALLOCATION: return "out of memory";
+        default: return "unknown error";
+    }
+}
+
+void config_print_summary(const dashboard_config_t *config) {
+    if (!config) return;
+
+    printf("=== Configuration ===\n");
+    printf("File: %s%s\n", config->loaded ? config->config_file_path : "built-in defaults",
+           config->modified ? " (modified)" : "");
+    printf("Display: %dx%d, layout %s\n", config->display.window_width, config->display.window_height,
+           config->display.layout_file[0] ? config->display.layout_file : "built-in");
+    printf("Rates: GUI %d Hz (%s), data %d Hz, monitor %d Hz\n",
+           config->performance.gui_update_rate_hz,
+           config->performance.adaptive_frame_rate ? "adaptive" : "fixed",
+           config->performance.data_update_rate_hz, config->performance.monitor_update_rate_hz);
+    printf("Simulation: %s, speed %.2fx%s%s\n", config->simulation.simulation_mode,
+           config->simulation.simulation_speed,
+           config->simulation.enable_scenarios ? ", scenarios" : "",
+           config->simulation.enable_recording ? ", recording" : "");
+}
+
+bool config_file_exists(const char *filename) {
+    struct stat info;
+    return filename && stat(filename, &info) == 0 && S_ISREG(info.st_mode);
+}
+
+config_result_t config_create_default_file(const char *filename) {
+    if (!filename) return CONFIG_ERROR_INVALID_VALUE;
+
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Config: cannot write %s: %s\n", filename, strerror(errno));
+        return CONFIG_ERROR_FILE_NOT_FOUND;
+    }
+
+    bool ok = fputs(DEFAULT_CONFIG_TEMPLATE, file) >= 0;
+    if (fclose(file) != 0) ok = false;
+    return ok ? CONFIG_SUCCESS : CONFIG_ERROR_FILE_NOT_FOUND;
+}
+
+/**
+ * Configuration hot-reloading
+ *
+ * A change is a different modification time or size from the last load.
+ */
+bool config_file_changed(const dashboard_config_t *config) {
+    if (!config || !config->config_file_path[0]) return false;
+
+    struct stat info;
+    if (stat(config->config_file_path, &info) != 0) return false;
+    return info.st_mtime != config->file_mtime || (long long)info.st_size != config->file_size;
+}
+
+/**
+ * Reload the file if it changed; on failure the previous settings stay and
+ * the same edit is not reported again
+ *
+ * Rates, thread placement and the other startup settings are read once by
+ * dashboard_initialize(), so a reload only takes effect at the next start.
+ */
+config_result_t config_reload_if_changed(dashboard_config_t *config) {
+    if (!config_file_changed(config)) return CONFIG_SUCCESS;
+
+    char path[MAX_CONFIG_VALUE_LENGTH];
+    CONFIG_SAFE_STRCPY(path, config->config_file_path, sizeof(path));
+
+    config_result_t result = config_load(config, path);
+    if (result == CONFIG_SUCCESS) {
+        printf("Configuration reloaded from %s, changes apply at the next start\n", path);
+    } else {
+        fprintf(stderr, "Config: keeping previous settings, %s: %s\n", path,
+                config_result_to_string(result));
+        config_watch_for_changes(config);
+    }
+    return result;
+}
+
+/**
+ * Take the file's current state as seen, so only later edits count as
+ * changes
+ */
+void config_watch_for_changes(dashboard_config_t *config) {
+    if (!config || !config->config_file_path[0]) return;
+
+    struct stat info;
+    if (stat(config->config_file_path, &info) == 0) {
+        config->file_mtime = info.st_mtime;
+        config->file_size = (long long)info.st_size;
+    }
+}
@@ -3,7 +3,9 @@
 #include <unistd.h>
 #include <sys/time.h>
 #include <pthread.h>
+#include <errno.h>
 #include <math.h>
+#include "../include/term_grid.h"
 
 // Console Dashboard Simulator - No GUI Version
 // Perfect for QNX testing without Photon
@@ -63,72 +65,102 @@ void* data_thread(void* arg) {
     return NULL;
 }
 
-// Display dashboard in console
-void display_dashboard(const vehicle_data_t* data) {
-    // Clear screen (ANSI escape codes)
-    printf("\033[2J\033[H");
-    
-    printf("╔══════════════════════════════════════════════════════════════╗\n");
-    printf("║               🚗 QNX AUTOMOTIVE DASHBOARD 🚗                ║\n");
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-    printf("║                                                              ║\n");
-    
-    // Speed gauge (ASCII art)
-    printf("║  SPEED: %6.1f km/h  ", data->speed);
-    int speed_bars = (int)(data->speed / 10);
-    printf("[");
-    for (int i = 0; i < 20; i++) {
-        if (i < speed_bars) printf("█");
-        else printf("░");
-    }
-    printf("]  ║\n");
-    
-    // RPM gauge
-    printf("║  RPM:   %6.0f rpm   ", data->rpm);
-    int rpm_bars = (int)(data->rpm / 300);
-    printf("[");
-    for (int i = 0; i < 20; i++) {
-        if (i < rpm_bars) printf("█");
-        else printf("░");
-    }
-    printf("]  ║\n");
-    
-    // Fuel gauge
-    printf("║  FUEL:  %6.1f%%     ", data->fuel_level);
-    int fuel_bars = (int)(data->fuel_level / 5);
-    printf("[");
-    for (int i = 0; i < 20; i++) {
-        if (i < fuel_bars) printf("█");
-        else printf("░");
+// Dashboard layout
+#define CONSOLE_ROWS    15
+#define CONSOLE_COLS    66
+#define BOX_WIDTH       64
+#define GAUGE_ROW       4
+#define VALUE_COL       10
+#define BAR_COL         24
+#define BAR_SEGMENTS    20
+#define STATUS_ROW      9
+#define GEAR_COL        9
+#define WARNINGS_COL    25
+
+// Cell grid: the static layout is drawn once, frames patch the slots and
+// the diff sends only the cells that changed
+static term_grid_t g_grid;
+static term_cell_t g_bar_full;
+static term_cell_t g_bar_empty;
+static int g_shown_warnings = -1;
+
+// One boxed line: borders plus blank interior
+void draw_box_row(term_grid_t* grid, int row, const char* left, const char* fill, const char* right) {
+    term_grid_put(grid, row, 0, TERM_ATTR_NORMAL, left);
+    term_grid_fill(grid, row, 1, BOX_WIDTH - 2, TERM_ATTR_NORMAL, fill);
+    term_grid_put(grid, row, BOX_WIDTH - 1, TERM_ATTR_NORMAL, right);
+}
+
+// Static layout: everything except the value slots
+void build_dashboard_layout(term_grid_t* grid) {
+    static const char* labels[4] = { "SPEED:", "RPM:", "FUEL:", "TEMP:" };
+    static const char* units[4] = { " km/h", " rpm", "%", "°C" };
+    
+    term_grid_clear(grid, TERM_ATTR_NORMAL);
+    
+    draw_box_row(grid, 0, "╔", "═", "╗");
+    draw_box_row(grid, 1, "║", " ", "║");
+    term_grid_put(grid, 1, 16, TERM_ATTR_NORMAL, "🚗 QNX AUTOMOTIVE DASHBOARD 🚗");
+    draw_box_row(grid, 2, "╠", "═", "╣");
+    for (int row = 3; row <= 10; row++) {
+        draw_box_row(grid, row, "║", " ", "║");
     }
-    printf("]  ║\n");
-    
-    // Temperature gauge
-    printf("║  TEMP:  %6.1f°C     ", data->temperature);
-    int temp_bars = (int)((data->temperature - 60) / 2);
-    printf("[");
-    for (int i = 0; i < 20; i++) {
-        if (i < temp_bars) printf("█");
-        else printf("░");
+    
+    // Gauge labels, units and bar brackets
+    for (int g = 0; g < 4; g++) {
+        term_grid_put(grid, GAUGE_ROW + g, 3, TERM_ATTR_NORMAL, labels[g]);
+        term_grid_put(grid, GAUGE_ROW + g, VALUE_COL + 6, TERM_ATTR_NORMAL, units[g]);
+        term_grid_put(grid, GAUGE_ROW + g, BAR_COL - 1, TERM_ATTR_NORMAL, "[");
+        term_grid_put(grid, GAUGE_ROW + g, BAR_COL + BAR_SEGMENTS, TERM_ATTR_NORMAL, "]");
     }
-    printf("]  ║\n");
+    term_cell_make(&g_bar_full, "█", TERM_ATTR_NORMAL);
+    term_cell_make(&g_bar_empty, "░", TERM_ATTR_NORMAL);
     
-    printf("║                                                              ║\n");
-    printf("║  GEAR: %d     ", data->gear);
+    term_grid_put(grid, STATUS_ROW, 3, TERM_ATTR_NORMAL, "GEAR:");
+    term_grid_put(grid, STATUS_ROW, WARNINGS_COL - 10, TERM_ATTR_NORMAL, "WARNINGS:");
+    g_shown_warnings = -1;
     
-    // Warning lights
-    printf("WARNINGS: ");
-    if (data->warnings & 0x01) printf("⛽LOW-FUEL ");
-    if (data->warnings & 0x02) printf("🌡️ HIGH-TEMP ");
-    if (data->warnings & 0x04) printf("⚡HIGH-RPM ");
-    if (data->warnings == 0) printf("✅ALL-OK");
+    draw_box_row(grid, 11, "╚", "═", "╝");
     
-    printf("       ║\n");
-    printf("║                                                              ║\n");
-    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    term_grid_put(grid, 13, 0, TERM_ATTR_NORMAL,
+                  "📊 Performance: 60 FPS target | 🧵 Multi-threaded | ⚡ Real-time");
+    term_grid_put(grid, 14, 0, TERM_ATTR_NORMAL, "Press Ctrl+C to exit");
+}
+
+// Display dashboard in console: patch the value slots into the prebuilt layout
+void display_dashboard(const vehicle_data_t* data) {
+    term_grid_t* grid = &g_grid;
+    const float values[4] = { data->speed, data->rpm, data->fuel_level, data->temperature };
+    const int bars[4] = {
+        (int)(data->speed / 10),
+        (int)(data->rpm / 300),
+        (int)(data->fuel_level / 5),
+        (int)((data->temperature - 60) / 2)
+    };
+    
+    for (int g = 0; g < 4; g++) {
+        term_grid_put_fixed(grid, GAUGE_ROW + g, VALUE_COL, 6, g == 1 ? 0 : 1, TERM_ATTR_NORMAL, values[g]);
+        for (int i = 0; i < BAR_SEGMENTS; i++) {
+            term_grid_put_cell(grid, GAUGE_ROW + g, BAR_COL + i, i < bars[g] ? &g_bar_full : &g_bar_empty);
+        }
+    }
     
-    printf("\n📊 Performance: 60 FPS target | 🧵 Multi-threaded | ⚡ Real-time\n");
-    printf("Press Ctrl+C to exit\n");
+    term_grid_put_uint(grid, STATUS_ROW, GEAR_COL, 1, TERM_ATTR_NORMAL, (unsigned)data->gear, false);
+    
+    // Warning lights (redrawn only when the flags change)
+    if (data->warnings != g_shown_warnings) {
+        int col = WARNINGS_COL;
+        term_grid_fill(grid, STATUS_ROW, col, BOX_WIDTH - 1 - col, TERM_ATTR_NORMAL, " ");
+        if (data->warnings & 0x01) col = term_grid_put(grid, STATUS_ROW, col, TERM_ATTR_NORMAL, "⛽LOW-FUEL ");
+        if (data->warnings & 0x02) col = term_grid_put(grid, STATUS_ROW, col, TERM_ATTR_NORMAL, "🌡️ HIGH-TEMP ");
+        if (data->warnings & 0x04) col = term_grid_put(grid, STATUS_ROW, col, TERM_ATTR_NORMAL, "⚡HIGH-RPM ");
+        if (data->warnings == 0) term_grid_put(grid, STATUS_ROW, col, TERM_ATTR_NORMAL, "✅ALL-OK");
+        g_shown_warnings = data->warnings;
+    }
+    
+    // Messages printed so far must land before this frame
+    fflush(stdout);
+    term_grid_flush(grid, STDOUT_FILENO);
 }
 
 // GUI thread (console display)
@@ -161,6 +193,30 @@ void signal_handler(int sig) {
     g_ctx.running = 0;
 }
 
+// Create a thread with an explicit real-time policy. Attributes are ignored
+// unless inheritsched is EXPLICIT; without the privilege for real-time
+// scheduling fall back to the default attributes instead of failing.
+int create_rt_thread(pthread_t* tid, int policy, int priority,
+                     void* (*start_routine)(void*), void* arg) {
+    pthread_attr_t attr;
+    struct sched_param param;
+    int result;
+    
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, policy);
+    param.sched_priority = priority;
+    pthread_attr_setschedparam(&attr, &param);
+    
+    result = pthread_create(tid, &attr, start_routine, arg);
+    if (result == EPERM) {
+        printf("⚠️  No permission for real-time priority %d, using default scheduling\n", priority);
+        result = pthread_create(tid, NULL, start_routine, arg);
+    }
+    pthread_attr_destroy(&attr);
+    return result;
+}
+
 int main() {
     pthread_t data_tid, gui_tid;
     
@@ -173,32 +229,25 @@ int main() {
     g_ctx.running = 1;
     pthread_mutex_init(&g_ctx.mutex, NULL);
     
+    if (term_grid_init(&g_grid, CONSOLE_ROWS, CONSOLE_COLS) != 0) {
+        fprintf(stderr, "Failed to allocate the screen grid\n");
+        return 1;
+    }
+    build_dashboard_layout(&g_grid);
+    
     // Set up signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
     
     // Create threads with QNX real-time priorities
-    pthread_attr_t attr;
-    struct sched_param param;
-    
     // Data thread (medium priority)
-    pthread_attr_init(&attr);
-    pthread_attr_setschedpolicy(&attr, SCHED_RR);
-    param.sched_priority = 50;
-    pthread_attr_setschedparam(&attr, &param);
-    
-    if (pthread_create(&data_tid, &attr, data_thread, &g_ctx) != 0) {
+    if (create_rt_thread(&data_tid, SCHED_RR, 50, data_thread, &g_ctx) != 0) {
         perror("Failed to create data thread");
         return 1;
     }
     
     // GUI thread (high priority)
-    pthread_attr_init(&attr);
-    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
-    param.sched_priority = 63;
-    pthread_attr_setschedparam(&attr, &param);
-    
-    if (pthread_create(&gui_tid, &attr, gui_thread, &g_ctx) != 0) {
+    if (create_rt_thread(&gui_tid, SCHED_FIFO, 63, gui_thread, &g_ctx) != 0) {
         perror("Failed to create GUI thread");
         return 1;
     }
@@ -212,6 +261,8 @@ int main() {
     
     // Cleanup
     pthread_mutex_destroy(&g_ctx.mutex);
+    term_grid_print_statistics(&g_grid);
+    term_grid_free(&g_grid);
     
     printf("\n✅ Dashboard simulator stopped cleanly\n");
     printf("📋 QNX Real-time Performance Demonstrated:\n");
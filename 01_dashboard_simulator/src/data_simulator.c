@@ -3,11 +3,10 @@
  */
 
 #include "../include/data_simulator.h"
-
-/* Global simulation state */
-static float g_simulation_time = 0.0f;
-static float g_acceleration = 0.0f;
-static float g_fuel_consumption_rate = 0.05f; /* L/100km base rate */
+#include "../include/replay.h"
+#include "../include/scenario.h"
+#include "../include/rng.h"
+#include "../include/fixed_step.h"
 
 /**
  * Initialize data simulator
@@ -17,12 +16,40 @@ int data_simulator_initialize(data_simulator_t *sim) {
     
     printf("Initializing data simulator...\n");
     
+    data_simulator_reset(sim, 1);
+    
+    printf("Data simulator initialized successfully\n");
+    return 0;
+}
+
+/**
+ * Put an instance into its initial state without logging
+ *
+ * All model state lives in the instance, so any number of simulators can
+ * be reset and updated concurrently; seed makes their data independent
+ * and reproducible.
+ */
+void data_simulator_reset(data_simulator_t *sim, uint64_t seed) {
+    if (!sim) return;
+    
     memset(sim, 0, sizeof(data_simulator_t));
     
     /* Set default configuration */
     sim->mode = SIM_MODE_REALISTIC;
     sim->update_rate_hz = DATA_UPDATE_RATE_HZ;
     sim->realistic_physics = true;
+    sim->vehicle_mass = DEFAULT_VEHICLE_MASS;
+    sim->drag_coefficient = DEFAULT_DRAG_COEFF;
+    sim->rolling_resistance = DEFAULT_ROLLING_RESIST;
+    sim->engine_power = DEFAULT_ENGINE_POWER;
+    sim->scenario_speed = 1.0f;
+    sim->scenario_loop = false;
+    fixed_step_init(&sim->clock, (uint64_t)(1000000000.0f / sim->update_rate_hz),
+                    PHYSICS_MAX_SUBSTEPS);
+    rng_seed(&sim->rng, seed);
+    uint64_t noise_seed = (uint64_t)rng_next(&sim->rng) << 32;
+    noise_seed |= rng_next(&sim->rng);
+    rng_lanes_seed(&sim->noise_rng, noise_seed);
     
     /* Initialize vehicle data with safe defaults */
     vehicle_data_t *data = &sim->current_data;
@@ -41,6 +68,7 @@ int data_simulator_initialize(data_simulator_t *sim) {
     
     /* Set timestamp */
     clock_gettime(CLOCK_MONOTONIC, &data->timestamp);
+    data->acquired_ns = get_timestamp_ns();
     
     /* Copy to previous data */
     sim->previous_data = sim->current_data;
@@ -48,9 +76,6 @@ int data_simulator_initialize(data_simulator_t *sim) {
     /* Reset statistics */
     sim->update_count = 0;
     sim->error_count = 0;
-    
-    printf("Data simulator initialized successfully\n");
-    return 0;
 }
 
 /**
@@ -60,7 +85,7 @@ void data_simulator_update(data_simulator_t *sim, float delta_time) {
     if (!sim) return;
     
     /* Update simulation time */
-    g_simulation_time += delta_time;
+    sim->simulation_time += delta_time;
     
     /* Store previous data */
     sim->previous_data = sim->current_data;
@@ -84,6 +109,11 @@ void data_simulator_update(data_simulator_t *sim, float delta_time) {
             break;
     }
     
+    /* Model output is sampled now; manual data keeps its samples' time */
+    if (sim->mode != SIM_MODE_MANUAL) {
+        sim->current_data.acquired_ns = get_timestamp_ns();
+    }
+    
     /* Validate and clamp data */
     data_clamp_values(&sim->current_data);
     data_set_timestamp(&sim->current_data);
@@ -92,34 +122,71 @@ void data_simulator_update(data_simulator_t *sim, float delta_time) {
     sim->update_count++;
 }
 
+/**
+ * Advance the model to the wall-clock time now_ns in fixed steps
+ *
+ * Runs as many data_simulator_update() steps of 1/update_rate_hz as real
+ * time allows (at most PHYSICS_MAX_SUBSTEPS), so simulated time keeps
+ * pace with a late or jittery caller. previous_data is the state one step
+ * before current_data; both carry state_time_ns for render interpolation.
+ * on_step, if given, sees the state after every step, including catch-up
+ * steps that are never published. Returns the number of steps run.
+ */
+uint32_t data_simulator_advance(data_simulator_t *sim, uint64_t now_ns,
+                                data_step_fn_t on_step, void *context) {
+    if (!sim) return 0;
+    
+    uint32_t steps = fixed_step_advance(&sim->clock, now_ns);
+    if (steps == 0) return 0;
+    
+    float step_s = (float)sim->clock.step_ns / 1000000000.0f;
+    uint64_t state_ns = fixed_step_state_time(&sim->clock) - (uint64_t)(steps - 1) * sim->clock.step_ns;
+    
+    for (uint32_t i = 0; i < steps; i++) {
+        data_simulator_update(sim, step_s);
+        sim->current_data.state_time_ns = state_ns;
+        state_ns += sim->clock.step_ns;
+        if (on_step) on_step(context, &sim->current_data);
+    }
+    
+    sim->previous_data.state_time_ns = sim->current_data.state_time_ns - sim->clock.step_ns;
+    return steps;
+}
+
 /**
  * Generate realistic vehicle data
  */
 void data_generate_realistic(data_simulator_t *sim, float delta_time) {
     vehicle_data_t *data = &sim->current_data;
     
-    /* Simple driving pattern simulation */
-    static float target_speed = 0.0f;
-    static float speed_change_timer = 0.0f;
-    
     /* Change target speed periodically */
-    speed_change_timer += delta_time;
-    if (speed_change_timer > 5.0f) { /* Change every 5 seconds */
-        target_speed = (float)(rand() % 120 + 20); /* 20-140 km/h */
-        speed_change_timer = 0.0f;
+    sim->speed_change_timer += delta_time;
+    if (sim->speed_change_timer > REALISTIC_TARGET_PERIOD) {
+        sim->target_speed = (float)(rng_below(&sim->rng, 120) + 20); /* 20-140 km/h */
+        sim->speed_change_timer = 0.0f;
     }
     
-    /* Smooth acceleration/deceleration */
-    float speed_diff = target_speed - data->speed_kmh;
-    if (fabs(speed_diff) > 1.0f) {
-        float max_accel = speed_diff > 0 ? REALISTIC_ACCELERATION : REALISTIC_DECELERATION;
-        g_acceleration = clamp(speed_diff * 0.5f, REALISTIC_DECELERATION, REALISTIC_ACCELERATION);
+    /* Smooth acceleration/deceleration; full throttle asks for all the grip */
+    float speed_diff = sim->target_speed - data->speed_kmh;
+    if (sim->full_throttle) {
+        data->acceleration = PHYSICS_TRACTION_ACCEL;
+    } else if (fabs(speed_diff) > 1.0f) {
+        data->acceleration = clamp(speed_diff * 0.5f, REALISTIC_DECELERATION, REALISTIC_ACCELERATION);
     } else {
-        g_acceleration = 0.0f;
+        data->acceleration = 0.0f;
+    }
+    
+    /* Engine power, drag and rolling resistance cap what the driver asks for */
+    if (sim->realistic_physics && data->acceleration > 0.0f) {
+        float max_accel = physics_calculate_max_acceleration(data->speed_kmh, sim->vehicle_mass,
+                                                             sim->drag_coefficient,
+                                                             sim->rolling_resistance,
+                                                             sim->engine_power);
+        data->acceleration = clamp(data->acceleration, 0.0f, max_accel > 0.0f ? max_accel : 0.0f);
     }
     
     /* Update speed */
-    data->speed_kmh = physics_calculate_speed(data->speed_kmh, g_acceleration, delta_time);
+    data->speed_kmh = physics_calculate_speed(data->speed_kmh, data->acceleration, delta_time);
     data->speed_kmh = clamp(data->speed_kmh, 0.0f, REALISTIC_MAX_SPEED);
     
     /* Calculate RPM based on speed and gear */
@@ -128,10 +195,16 @@ void data_generate_realistic(data_simulator_t *sim, float delta_time) {
     
     data->rpm = physics_calculate_rpm(data->speed_kmh, data->gear_position, 1.0f);
     
-    /* Update fuel consumption */
-    float fuel_consumed = physics_calculate_fuel_consumption(data->speed_kmh, data->rpm, delta_time);
-    data->fuel_level -= fuel_consumed;
-    data->fuel_level = clamp(data->fuel_level, 0.0f, 100.0f);
+    /* Burn fuel for the power delivered; a step's burn is far below the float
+     * resolution of fuel_level, so it is taken off in FUEL_LEVEL_STEP amounts */
+    float power_kw = physics_calculate_engine_power(data->speed_kmh, data->acceleration,
+                                                    sim->vehicle_mass, sim->drag_coefficient,
+                                                    sim->rolling_resistance);
+    sim->fuel_burn_pct += physics_calculate_fuel_consumption(power_kw, data->rpm, delta_time);
+    if (sim->fuel_burn_pct > FUEL_LEVEL_STEP) {
+        data->fuel_level = clamp(data->fuel_level - sim->fuel_burn_pct, 0.0f, 100.0f);
+        sim->fuel_burn_pct = 0.0f;
+    }
     
     /* Update engine temperature */
     float ambient_temp = DEFAULT_AMBIENT_TEMP;
@@ -147,11 +220,14 @@ void data_generate_realistic(data_simulator_t *sim, float delta_time) {
         data->battery_voltage -= 0.2f; /* Voltage drop when overheating */
     }
     
-    /* Add some noise for realism */
-    data->speed_kmh = data_add_noise(data->speed_kmh, 0.5f);
-    data->rpm = data_add_noise(data->rpm, 50.0f);
-    data->engine_temp = data_add_noise(data->engine_temp, 1.0f);
-    data->oil_pressure = data_add_noise(data->oil_pressure, 2.0f);
+    /* Add some noise for realism, all channels in one batch */
+    static const float noise_amplitude[RNG_LANES] = {0.5f, 50.0f, 1.0f, 2.0f};
+    float noise[RNG_LANES];
+    rng_fill_noise(&sim->noise_rng, noise, noise_amplitude, RNG_LANES);
+    data->speed_kmh += noise[0];
+    data->rpm += noise[1];
+    data->engine_temp += noise[2];
+    data->oil_pressure += noise[3];
 }
 
 /**
@@ -160,8 +236,13 @@ void data_generate_realistic(data_simulator_t *sim, float delta_time) {
 void data_generate_demo(data_simulator_t *sim, float delta_time) {
     vehicle_data_t *data = &sim->current_data;
     
+    if (sim->scenario.loaded) {
+        data_generate_scenario(sim, delta_time);
+        return;
+    }
+    
     /* Predefined demo sequence */
-    float demo_cycle = fmod(g_simulation_time, 30.0f); /* 30 second cycle */
+    float demo_cycle = fmod(sim->simulation_time, 30.0f); /* 30 second cycle */
     
     if (demo_cycle < 10.0f) {
         /* Acceleration phase */
@@ -180,21 +261,142 @@ void data_generate_demo(data_simulator_t *sim, float delta_time) {
     }
     
     /* Update other parameters */
-    data->fuel_level = 50.0f + 25.0f * sin(g_simulation_time * 0.1f);
-    data->engine_temp = 70.0f + 20.0f * sin(g_simulation_time * 0.05f);
+    data->fuel_level = 50.0f + 25.0f * sin(sim->simulation_time * 0.1f);
+    data->engine_temp = 70.0f + 20.0f * sin(sim->simulation_time * 0.05f);
     data->oil_pressure = 40.0f + 20.0f * (data->rpm / 8000.0f);
-    data->battery_voltage = 12.6f + 1.4f * sin(g_simulation_time * 0.2f);
+    data->battery_voltage = 12.6f + 1.4f * sin(sim->simulation_time * 0.2f);
     
     data->gear_position = (int)(data->speed_kmh / 20.0f) + 1;
     data->gear_position = clamp(data->gear_position, 1, 6);
 }
 
 /**
- * Generate replay data (placeholder)
+ * Replace the simulated state with externally supplied data
+ */
+void data_generate_manual(data_simulator_t *sim, const vehicle_data_t *input) {
+    if (!sim || !input) return;
+    
+    sim->current_data = *input;
+    data_clamp_values(&sim->current_data);
+    sim->current_data.data_valid = data_validate_vehicle_data(&sim->current_data);
+}
+
+/**
+ * Apply one timestamped signal sample to vehicle data
+ */
+void data_apply_sample(vehicle_data_t *data, const signal_sample_t *sample) {
+    if (!data || !sample) return;
+    
+    switch ((signal_id_t)sample->signal) {
+        case SIGNAL_SPEED_KMH:          data->speed_kmh = sample->value; break;
+        case SIGNAL_RPM:                data->rpm = sample->value; break;
+        case SIGNAL_ACCELERATION:       data->acceleration = sample->value; break;
+        case SIGNAL_FUEL_LEVEL:         data->fuel_level = sample->value; break;
+        case SIGNAL_ENGINE_TEMP:        data->engine_temp = sample->value; break;
+        case SIGNAL_OIL_PRESSURE:       data->oil_pressure = sample->value; break;
+        case SIGNAL_BATTERY_VOLTAGE:    data->battery_voltage = sample->value; break;
+        case SIGNAL_ALTERNATOR_CURRENT: data->alternator_current = sample->value; break;
+        case SIGNAL_GEAR_POSITION:      data->gear_position = (int)lroundf(sample->value); break;
+        case SIGNAL_IGNITION_ON:        data->ignition_on = sample->value != 0.0f; break;
+        case SIGNAL_ENGINE_RUNNING:     data->engine_running = sample->value != 0.0f; break;
+        case SIGNAL_PARKING_BRAKE:      data->parking_brake = sample->value != 0.0f; break;
+        case SIGNAL_SEATBELT_FASTENED:  data->seatbelt_fastened = sample->value != 0.0f; break;
+        default: break;
+    }
+}
+
+/**
+ * Fold a batch of queued samples into the current state
+ *
+ * Samples are applied oldest first, so the newest value of each signal
+ * wins. In manual mode they are the only data source; in the other modes
+ * they override the model state, which then evolves from the new values.
+ * Returns the number of samples accepted.
+ */
+uint32_t data_simulator_ingest(data_simulator_t *sim, const signal_sample_t *samples,
+                               uint32_t count) {
+    if (!sim || !samples || count == 0) return 0;
+    
+    vehicle_data_t input = sim->current_data;
+    uint32_t accepted = 0;
+    
+    for (uint32_t i = 0; i < count; i++) {
+        if (samples[i].signal >= SIGNAL_COUNT) {
+            sim->error_count++;
+            continue;
+        }
+        data_apply_sample(&input, &samples[i]);
+        if (samples[i].timestamp_ns > input.acquired_ns) {
+            input.acquired_ns = samples[i].timestamp_ns;
+        }
+        accepted++;
+    }
+    
+    data_generate_manual(sim, &input);
+    sim->samples_ingested += accepted;
+    return accepted;
+}
+
+/**
+ * Play the loaded scenario at scenario_speed
+ */
+void data_generate_scenario(data_simulator_t *sim, float delta_time) {
+    scenario_t *scenario = &sim->scenario;
+    float values[SIGNAL_COUNT];
+    
+    sim->scenario_time += delta_time * sim->scenario_speed;
+    if (sim->scenario_time > scenario->duration) {
+        if (sim->scenario_loop && scenario->duration > 0.0f) {
+            sim->scenario_time = fmodf(sim->scenario_time, scenario->duration);
+        } else {
+            sim->scenario_time = scenario->duration;
+        }
+    }
+    
+    scenario_evaluate(scenario, sim->scenario_time, values);
+    
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        if (!scenario_drives_signal(scenario, (signal_id_t)signal)) continue;
+        
+        signal_sample_t sample;
+        sample.timestamp_ns = 0;
+        sample.signal = (uint32_t)signal;
+        sample.value = values[signal];
+        data_apply_sample(&sim->current_data, &sample);
+    }
+}
+
+/**
+ * Play back a recording at scenario_speed
  */
 void data_generate_replay(data_simulator_t *sim, float delta_time) {
-    /* For now, just use realistic mode */
-    data_generate_realistic(sim, delta_time);
+    if (!replay_is_open(&sim->replay)) {
+        /* Nothing to play: keep producing data */
+        data_generate_realistic(sim, delta_time);
+        return;
+    }
+    
+    replay_advance(&sim->replay, delta_time, sim->scenario_speed, sim->scenario_loop,
+                   &sim->current_data);
+    sim->scenario_time = replay_elapsed_seconds(&sim->replay);
+}
+
+/**
+ * Map a recording and switch to replay mode
+ */
+int data_simulator_open_replay(data_simulator_t *sim, const char *path) {
+    if (!sim || !path) return -1;
+    
+    if (replay_is_open(&sim->replay)) {
+        replay_close(&sim->replay);
+    }
+    if (replay_open(&sim->replay, path) != 0) {
+        return -1;
+    }
+    
+    sim->scenario_time = 0.0f;
+    data_simulator_set_mode(sim, SIM_MODE_REPLAY);
+    return 0;
 }
 
 /**
@@ -213,20 +415,38 @@ float physics_calculate_rpm(float speed, int gear, float engine_load) {
     float final_drive = 3.9f;
     float wheel_circumference = 2.0f; /* meters */
     
-    float gear_ratio = gear_ratios[clamp(gear, 1, 6)];
+    float gear_ratio = gear_ratios[(int)clamp((float)gear, 1.0f, 6.0f)];
     float rpm = (speed / 3.6f) * 60.0f / wheel_circumference * final_drive * gear_ratio;
     
     return clamp(rpm, 800.0f, MAX_RPM);
 }
 
-float physics_calculate_fuel_consumption(float speed, float rpm, float delta_time) {
-    /* Simple fuel consumption model */
-    float base_consumption = g_fuel_consumption_rate;
-    float speed_factor = 1.0f + (speed / 100.0f) * 0.5f; /* Higher speed = more fuel */
-    float rpm_factor = 1.0f + (rpm / 8000.0f) * 0.3f; /* Higher RPM = more fuel */
+/**
+ * Power delivered to the wheels, kW (none while coasting or braking)
+ */
+float physics_calculate_engine_power(float speed_kmh, float acceleration, float mass,
+                                     float drag_coeff, float rolling_resist) {
+    float v = speed_kmh / 3.6f;
+    float inertia_force = mass * acceleration;
+    float drag_force = 0.5f * AIR_DENSITY * drag_coeff * DEFAULT_FRONTAL_AREA * v * v;
+    float rolling_force = rolling_resist * mass * GRAVITY;
+    
+    float power_kw = (inertia_force + drag_force + rolling_force) * v / 1000.0f;
+    return power_kw > 0.0f ? power_kw : 0.0f;
+}
+
+/**
+ * Fuel burned over delta_time, percent of the tank
+ *
+ * Friction and pumping losses grow with rpm; the power delivered costs
+ * FUEL_BSFC grams per kWh at the crankshaft.
+ */
+float physics_calculate_fuel_consumption(float power_kw, float rpm, float delta_time) {
+    float idle_rate = FUEL_IDLE_RATE * (rpm / 800.0f);
+    float load_rate = power_kw / DRIVETRAIN_EFFICIENCY * FUEL_BSFC / FUEL_DENSITY;
     
-    float consumption_per_hour = base_consumption * speed_factor * rpm_factor;
-    return (consumption_per_hour * delta_time / 3600.0f) * 0.1f; /* Convert to percentage */
+    float litres = (idle_rate + load_rate) * delta_time / 3600.0f;
+    return litres / FUEL_TANK_CAPACITY * 100.0f;
 }
 
 float physics_calculate_engine_temp(float current_temp, float rpm, float ambient_temp, float delta_time) {
@@ -239,6 +459,25 @@ float physics_calculate_engine_temp(float current_temp, float rpm, float ambient
     return current_temp + temp_change;
 }
 
+/**
+ * Acceleration available at full power after drag and rolling resistance
+ */
+float physics_calculate_max_acceleration(float speed_kmh, float mass, float drag_coeff,
+                                         float rolling_resist, float power_kw) {
+    if (mass <= 0.0f) return REALISTIC_ACCELERATION;
+    
+    /* Below a few m/s traction, not power, is the limit */
+    float v = speed_kmh / 3.6f;
+    float v_power = v > PHYSICS_TRACTION_SPEED ? v : PHYSICS_TRACTION_SPEED;
+    
+    float drive_force = power_kw * 1000.0f / v_power;
+    float drag_force = 0.5f * AIR_DENSITY * drag_coeff * DEFAULT_FRONTAL_AREA * v * v;
+    float rolling_force = rolling_resist * mass * GRAVITY;
+    
+    float max_accel = (drive_force - drag_force - rolling_force) / mass;
+    return max_accel < PHYSICS_TRACTION_ACCEL ? max_accel : PHYSICS_TRACTION_ACCEL;
+}
+
 /**
  * Data validation and utility functions
  */
@@ -260,7 +499,7 @@ void data_clamp_values(vehicle_data_t *data) {
     data->speed_kmh = clamp(data->speed_kmh, 0.0f, MAX_SPEED);
     data->rpm = clamp(data->rpm, 0.0f, MAX_RPM);
     data->fuel_level = clamp(data->fuel_level, 0.0f, MAX_FUEL_LEVEL);
-    data->engine_temp = clamp(data->engine_temp, -40.0f, MAX_TEMP);
+    data->engine_temp = clamp(data->engine_temp, -40.0f, MAX_TEMPERATURE);
     data->oil_pressure = clamp(data->oil_pressure, 0.0f, 100.0f);
     data->battery_voltage = clamp(data->battery_voltage, 8.0f, 16.0f);
     data->gear_position = clamp(data->gear_position, -1, 6);
@@ -270,10 +509,60 @@ void data_set_timestamp(vehicle_data_t *data) {
     if (!data) return;
     
     clock_gettime(CLOCK_MONOTONIC, &data->timestamp);
-    data->data_age_ms = 0; /* Fresh data */
+    
+    /* Age relative to acquisition, not to this processing step */
+    uint64_t now_ns = (uint64_t)data->timestamp.tv_sec * 1000000000ULL +
+                      (uint64_t)data->timestamp.tv_nsec;
+    if (data->acquired_ns == 0 || data->acquired_ns > now_ns) {
+        data->acquired_ns = now_ns;
+    }
+    data->data_age_ms = (uint32_t)((now_ns - data->acquired_ns) / 1000000ULL);
     data->data_valid = true;
 }
 
+/**
+ * Position of time_ns between two states, clamped to 0..1
+ *
+ * Renderers sample slightly in the past (one data step behind) so the
+ * display time falls between two published states and never has to be
+ * extrapolated.
+ */
+float data_interpolation_alpha(const vehicle_data_t *previous, const vehicle_data_t *current,
+                               uint64_t time_ns) {
+    if (!previous || !current) return 1.0f;
+    if (current->state_time_ns <= previous->state_time_ns) return 1.0f;
+    if (time_ns <= previous->state_time_ns) return 0.0f;
+    if (time_ns >= current->state_time_ns) return 1.0f;
+    
+    return (float)(time_ns - previous->state_time_ns) /
+           (float)(current->state_time_ns - previous->state_time_ns);
+}
+
+/**
+ * Blend two states for display
+ *
+ * Continuous signals are interpolated; gear and flags are taken from the
+ * current state. The acquisition and state times are interpolated too, so
+ * a blended sample is dated at the instant it shows rather than at the
+ * newer input it was blended towards.
+ */
+void data_interpolate(const vehicle_data_t *previous, const vehicle_data_t *current,
+                      float alpha, vehicle_data_t *out) {
+    if (!previous || !current || !out) return;
+    
+    *out = *current;
+    out->speed_kmh = lerp(previous->speed_kmh, current->speed_kmh, alpha);
+    out->rpm = lerp(previous->rpm, current->rpm, alpha);
+    out->acceleration = lerp(previous->acceleration, current->acceleration, alpha);
+    out->fuel_level = lerp(previous->fuel_level, current->fuel_level, alpha);
+    out->engine_temp = lerp(previous->engine_temp, current->engine_temp, alpha);
+    out->oil_pressure = lerp(previous->oil_pressure, current->oil_pressure, alpha);
+    out->battery_voltage = lerp(previous->battery_voltage, current->battery_voltage, alpha);
+    out->alternator_current = lerp(previous->alternator_current, current->alternator_current, alpha);
+    out->acquired_ns = lerp_ns(previous->acquired_ns, current->acquired_ns, alpha);
+    out->state_time_ns = lerp_ns(previous->state_time_ns, current->state_time_ns, alpha);
+}
+
 /**
  * Utility functions
  */
@@ -288,9 +577,8 @@ float data_smooth_transition(float current, float target, float rate, float delt
     }
 }
 
-float data_add_noise(float value, float noise_level) {
-    float noise = ((float)rand() / RAND_MAX - 0.5f) * 2.0f * noise_level;
-    return value + noise;
+float data_add_noise(data_simulator_t *sim, float value, float noise_level) {
+    return value + rng_symmetric(&sim->rng) * noise_level;
 }
 
 bool data_should_trigger_warning(const vehicle_data_t *data) {
@@ -319,6 +607,54 @@ simulation_mode_t data_simulator_get_mode(const data_simulator_t *sim) {
     return sim ? sim->mode : SIM_MODE_REALISTIC;
 }
 
+/**
+ * Change the physics step; call before the simulator is first advanced
+ */
+void data_simulator_set_update_rate(data_simulator_t *sim, uint32_t rate_hz) {
+    if (!sim || rate_hz == 0) return;
+    
+    sim->update_rate_hz = (float)rate_hz;
+    fixed_step_init(&sim->clock, 1000000000ULL / rate_hz, PHYSICS_MAX_SUBSTEPS);
+}
+
+/**
+ * Scenario management functions
+ */
+int data_load_scenario(data_simulator_t *sim, const char *filename) {
+    if (!sim || !filename) return -1;
+    
+    scenario_t loaded;
+    if (scenario_load(&loaded, filename) != 0) {
+        sim->error_count++;
+        return -1;
+    }
+    
+    /* Swap in only after a successful compile */
+    scenario_free(&sim->scenario);
+    sim->scenario = loaded;
+    sim->scenario_time = 0.0f;
+    data_simulator_set_mode(sim, SIM_MODE_DEMO);
+    return 0;
+}
+
+void data_reset_scenario(data_simulator_t *sim) {
+    if (!sim) return;
+    
+    sim->scenario_time = 0.0f;
+    scenario_reset(&sim->scenario);
+}
+
+bool data_scenario_complete(const data_simulator_t *sim) {
+    if (!sim) return true;
+    if (sim->scenario.loaded) {
+        return !sim->scenario_loop && sim->scenario_time >= sim->scenario.duration;
+    }
+    if (replay_is_open(&sim->replay)) {
+        return sim->replay.complete;
+    }
+    return false;
+}
+
 /**
  * Statistics functions
  */
@@ -337,12 +673,14 @@ void data_print_statistics(const data_simulator_t *sim) {
     printf("=== Data Simulator Statistics ===\n");
     printf("Mode: %d\n", sim->mode);
     printf("Update Count: %llu\n", (unsigned long long)sim->update_count);
+    printf("Samples Ingested: %llu\n", (unsigned long long)sim->samples_ingested);
     printf("Error Count: %u\n", sim->error_count);
     printf("Average Update Time: %.2f ms\n", sim->average_update_time_ms);
     printf("Current Speed: %.1f km/h\n", sim->current_data.speed_kmh);
     printf("Current RPM: %.0f\n", sim->current_data.rpm);
     printf("Fuel Level: %.1f%%\n", sim->current_data.fuel_level);
     printf("Engine Temp: %.1f°C\n", sim->current_data.engine_temp);
+    fixed_step_print_statistics(&sim->clock, "Physics");
 }
 
 /**
@@ -356,6 +694,12 @@ void data_simulator_cleanup(data_simulator_t *sim) {
     /* Print final statistics */
     data_print_statistics(sim);
     
+    if (replay_is_open(&sim->replay)) {
+        replay_print_statistics(&sim->replay);
+        replay_close(&sim->replay);
+    }
+    scenario_free(&sim->scenario);
+    
     /* Reset state */
     memset(sim, 0, sizeof(data_simulator_t));
     
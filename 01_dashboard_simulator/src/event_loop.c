@@ -0,0 +1,236 @@
+/**
+ * QNX Dashboard Simulator - Event Loop Implementation
+ *
+ * The main thread blocks in poll() until an input fd becomes readable, the
+ * nearest timer expires or event_loop_stop() writes to the wake pipe. Timers
+ * are kept in the loop and turned into the poll() timeout, and the self-pipe
+ * replaces eventfd, so the same code runs on QNX and Linux.
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include "../include/event_loop.h"
+
+static uint64_t clock_now_ns(clockid_t clock_id) {
+    struct timespec ts;
+    clock_gettime(clock_id, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0) return -1;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/**
+ * Initialize event loop
+ */
+int event_loop_initialize(event_loop_t *loop) {
+    if (!loop) return -1;
+
+    memset(loop, 0, sizeof(event_loop_t));
+
+    if (pipe(loop->wake_fds) != 0) {
+        perror("event loop pipe");
+        loop->wake_fds[0] = loop->wake_fds[1] = -1;
+        return -1;
+    }
+
+    set_nonblocking(loop->wake_fds[0]);
+    set_nonblocking(loop->wake_fds[1]);
+    fcntl(loop->wake_fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(loop->wake_fds[1], F_SETFD, FD_CLOEXEC);
+
+    return 0;
+}
+
+/**
+ * Cleanup event loop
+ */
+void event_loop_cleanup(event_loop_t *loop) {
+    if (!loop) return;
+
+    for (int i = 0; i < 2; i++) {
+        if (loop->wake_fds[i] >= 0) {
+            close(loop->wake_fds[i]);
+            loop->wake_fds[i] = -1;
+        }
+    }
+    loop->source_count = 0;
+    loop->timer_count = 0;
+}
+
+/**
+ * Watch a file descriptor for input
+ */
+int event_loop_add_fd(event_loop_t *loop, int fd, event_fd_callback_t callback,
+                      void *user_data) {
+    if (!loop || fd < 0 || !callback) return -1;
+    if (loop->source_count >= EVENT_LOOP_MAX_SOURCES) return -1;
+
+    event_source_t *source = &loop->sources[loop->source_count++];
+    source->fd = fd;
+    source->callback = callback;
+    source->user_data = user_data;
+    return 0;
+}
+
+/**
+ * Register a periodic timer
+ */
+int event_loop_add_timer(event_loop_t *loop, uint32_t period_ms,
+                         event_timer_callback_t callback, void *user_data) {
+    if (!loop || period_ms == 0 || !callback) return -1;
+    if (loop->timer_count >= EVENT_LOOP_MAX_TIMERS) return -1;
+
+    event_timer_t *timer = &loop->timers[loop->timer_count++];
+    timer->period_ns = (uint64_t)period_ms * 1000000ULL;
+    timer->next_expiry_ns = clock_now_ns(CLOCK_MONOTONIC) + timer->period_ns;
+    timer->callback = callback;
+    timer->user_data = user_data;
+    return 0;
+}
+
+/**
+ * Milliseconds until the nearest timer expiry (-1 = no timers)
+ */
+static int event_loop_poll_timeout(const event_loop_t *loop, uint64_t now_ns) {
+    if (loop->timer_count == 0) return -1;
+
+    uint64_t nearest = loop->timers[0].next_expiry_ns;
+    for (int i = 1; i < loop->timer_count; i++) {
+        if (loop->timers[i].next_expiry_ns < nearest) {
+            nearest = loop->timers[i].next_expiry_ns;
+        }
+    }
+
+    if (nearest <= now_ns) return 0;
+
+    /* Round up so we never wake just before the expiry */
+    uint64_t timeout_ms = (nearest - now_ns + 999999ULL) / 1000000ULL;
+    return timeout_ms > 60000 ? 60000 : (int)timeout_ms;
+}
+
+static void event_loop_dispatch_timers(event_loop_t *loop, uint64_t now_ns) {
+    for (int i = 0; i < loop->timer_count; i++) {
+        event_timer_t *timer = &loop->timers[i];
+        if (timer->next_expiry_ns > now_ns) continue;
+
+        /* Coalesce missed expiries into a single callback */
+        uint64_t missed = (now_ns - timer->next_expiry_ns) / timer->period_ns;
+        timer->next_expiry_ns += (missed + 1) * timer->period_ns;
+
+        loop->timer_dispatches++;
+        timer->callback(timer->user_data);
+    }
+}
+
+static void event_loop_remove_source(event_loop_t *loop, int index) {
+    loop->source_count--;
+    for (int i = index; i < loop->source_count; i++) {
+        loop->sources[i] = loop->sources[i + 1];
+    }
+}
+
+/**
+ * Run until event_loop_stop() is called
+ */
+int event_loop_run(event_loop_t *loop) {
+    if (!loop || loop->wake_fds[0] < 0) return -1;
+
+    struct pollfd fds[EVENT_LOOP_MAX_SOURCES + 1];
+    uint64_t start_ns = clock_now_ns(CLOCK_MONOTONIC);
+    uint64_t start_cpu_ns = clock_now_ns(CLOCK_THREAD_CPUTIME_ID);
+
+    while (!loop->stop_requested) {
+        int nfds = 0;
+        fds[nfds].fd = loop->wake_fds[0];
+        fds[nfds].events = POLLIN;
+        fds[nfds].revents = 0;
+        nfds++;
+
+        for (int i = 0; i < loop->source_count; i++) {
+            fds[nfds].fd = loop->sources[i].fd;
+            fds[nfds].events = POLLIN;
+            fds[nfds].revents = 0;
+            nfds++;
+        }
+
+        int timeout = event_loop_poll_timeout(loop, clock_now_ns(CLOCK_MONOTONIC));
+        int ready = poll(fds, (nfds_t)nfds, timeout);
+        loop->wakeups++;
+
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            perror("poll");
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            char drain[64];
+            while (read(loop->wake_fds[0], drain, sizeof(drain)) > 0) {
+                /* Empty the wake pipe */
+            }
+        }
+
+        /* Walk backwards so removals do not disturb pending entries */
+        for (int i = nfds - 1; i >= 1; i--) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL))) continue;
+
+            event_source_t *source = &loop->sources[i - 1];
+            loop->fd_dispatches++;
+            bool keep = !(fds[i].revents & POLLNVAL) &&
+                        source->callback(source->fd, source->user_data);
+            if (!keep) {
+                event_loop_remove_source(loop, i - 1);
+            }
+        }
+
+        event_loop_dispatch_timers(loop, clock_now_ns(CLOCK_MONOTONIC));
+    }
+
+    loop->run_time_ns += clock_now_ns(CLOCK_MONOTONIC) - start_ns;
+    loop->run_cpu_ns += clock_now_ns(CLOCK_THREAD_CPUTIME_ID) - start_cpu_ns;
+    return 0;
+}
+
+/**
+ * Request loop exit (async-signal-safe)
+ */
+void event_loop_stop(event_loop_t *loop) {
+    if (!loop) return;
+
+    loop->stop_requested = 1;
+    if (loop->wake_fds[1] >= 0) {
+        char wake = 1;
+        ssize_t unused = write(loop->wake_fds[1], &wake, 1);
+        (void)unused;
+    }
+}
+
+/**
+ * Statistics functions
+ */
+float event_loop_wakeups_per_second(const event_loop_t *loop) {
+    if (!loop || loop->run_time_ns == 0) return 0.0f;
+    return (float)((double)loop->wakeups * 1000000000.0 / (double)loop->run_time_ns);
+}
+
+float event_loop_cpu_percent(const event_loop_t *loop) {
+    if (!loop || loop->run_time_ns == 0) return 0.0f;
+    return (float)((double)loop->run_cpu_ns * 100.0 / (double)loop->run_time_ns);
+}
+
+void event_loop_print_statistics(const event_loop_t *loop) {
+    if (!loop) return;
+
+    printf("=== Main Event Loop ===\n");
+    printf("Run Time: %.1f s\n", (double)loop->run_time_ns / 1000000000.0);
+    printf("Wakeups: %llu (%.2f/s)\n", (unsigned long long)loop->wakeups,
+           event_loop_wakeups_per_second(loop));
+    printf("Dispatches: %llu fd, %llu timer\n",
+           (unsigned long long)loop->fd_dispatches,
+           (unsigned long long)loop->timer_dispatches);
+    printf("Main Thread CPU: %.3f%%\n", event_loop_cpu_percent(loop));
+}
@@ -0,0 +1,83 @@
+/**
+ * QNX Dashboard Simulator - Fixed Timestep Implementation
+ *
+ * Physics integrated with a constant step is stable and repeatable, but a
+ * thread that assumes its period has elapsed runs slow whenever it is
+ * woken late. The accumulator decouples the two: each call adds the real
+ * time since the previous call and reports how many whole steps to run.
+ * After a long stall only max_substeps are run, so one hiccup cannot turn
+ * into a spiral of ever longer catch-up ticks.
+ */
+
+#include "../include/fixed_step.h"
+
+void fixed_step_init(fixed_step_t *clock, uint64_t step_ns, uint32_t max_substeps) {
+    if (!clock) return;
+    
+    memset(clock, 0, sizeof(fixed_step_t));
+    clock->step_ns = step_ns > 0 ? step_ns : 1;
+    clock->max_substeps = max_substeps > 0 ? max_substeps : 1;
+}
+
+/**
+ * Account for time up to now_ns
+ *
+ * Returns the number of steps the caller must run now. The first call
+ * only starts the clock.
+ */
+uint32_t fixed_step_advance(fixed_step_t *clock, uint64_t now_ns) {
+    if (!clock) return 0;
+    
+    if (clock->last_ns == 0 || now_ns < clock->last_ns) {
+        clock->last_ns = now_ns;
+        return 0;
+    }
+    
+    clock->accumulator_ns += now_ns - clock->last_ns;
+    clock->last_ns = now_ns;
+    
+    uint64_t due = clock->accumulator_ns / clock->step_ns;
+    if (due > clock->max_substeps) {
+        /* Give up on the backlog, keep the sub-step phase */
+        uint64_t dropped = (due - clock->max_substeps) * clock->step_ns;
+        clock->accumulator_ns -= dropped;
+        clock->dropped_ns += dropped;
+        due = clock->max_substeps;
+    }
+    clock->accumulator_ns -= due * clock->step_ns;
+    
+    clock->steps += due;
+    if (due > 1) clock->catch_up_calls++;
+    if (due > clock->max_substeps_seen) clock->max_substeps_seen = (uint32_t)due;
+    
+    return (uint32_t)due;
+}
+
+/**
+ * Fraction of a step accumulated but not yet simulated (0..1)
+ */
+float fixed_step_alpha(const fixed_step_t *clock) {
+    if (!clock || clock->step_ns == 0) return 0.0f;
+    return (float)clock->accumulator_ns / (float)clock->step_ns;
+}
+
+/**
+ * Wall-clock instant the simulated state corresponds to
+ */
+uint64_t fixed_step_state_time(const fixed_step_t *clock) {
+    if (!clock) return 0;
+    return clock->last_ns - clock->accumulator_ns;
+}
+
+void fixed_step_print_statistics(const fixed_step_t *clock, const char *name) {
+    if (!clock) return;
+    
+    printf("%s stepping: %.2f ms steps, %llu run, %llu catch-up calls (max %u substeps), "
+           "%.1f ms dropped\n",
+           name ? name : "Fixed",
+           (double)clock->step_ns / 1000000.0,
+           (unsigned long long)clock->steps,
+           (unsigned long long)clock->catch_up_calls,
+           clock->max_substeps_seen,
+           (double)clock->dropped_ns / 1000000.0);
+}
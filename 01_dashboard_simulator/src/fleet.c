@@ -0,0 +1,386 @@
+/**
+ * QNX Dashboard Simulator - Fleet Simulation Implementation
+ *
+ * Runs the data_generate_realistic() model (without sensor noise or the
+ * power limit, every vehicle with the default mass and road load) for
+ * many vehicles at once. The physics is evaluated a
+ * vector of vehicles at a time: AVX (8 lanes) or SSE2 (4) on x86, NEON (4)
+ * on AArch64, picked at compile time. Operations are issued in the same
+ * order as the scalar physics_calculate_*() functions, so without
+ * -ffast-math both paths produce the same floats. fleet_step_scalar() is
+ * that scalar path and serves as the reference and as the fallback on
+ * other targets.
+ */
+
+#include "../include/fleet.h"
+#include "../include/data_simulator.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define FLEET_SIMD_NAME    "avx"
+#define FLEET_LANES        8
+typedef __m256 vf_t;
+typedef __m256 vm_t;
+#define vf_set1(x)         _mm256_set1_ps(x)
+#define vf_load(p)         _mm256_load_ps(p)
+#define vf_store(p, v)     _mm256_store_ps(p, v)
+#define vf_add(a, b)       _mm256_add_ps(a, b)
+#define vf_sub(a, b)       _mm256_sub_ps(a, b)
+#define vf_mul(a, b)       _mm256_mul_ps(a, b)
+#define vf_div(a, b)       _mm256_div_ps(a, b)
+#define vf_min(a, b)       _mm256_min_ps(a, b)
+#define vf_max(a, b)       _mm256_max_ps(a, b)
+#define vf_abs(a)          _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a)
+#define vf_trunc(a)        _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+#define vf_gt(a, b)        _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define vf_select(m, a, b) _mm256_blendv_ps(b, a, m)
+#define vm_any(m)          (_mm256_movemask_ps(m) != 0)
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define FLEET_SIMD_NAME    "sse2"
+#define FLEET_LANES        4
+typedef __m128 vf_t;
+typedef __m128 vm_t;
+#define vf_set1(x)         _mm_set1_ps(x)
+#define vf_load(p)         _mm_load_ps(p)
+#define vf_store(p, v)     _mm_store_ps(p, v)
+#define vf_add(a, b)       _mm_add_ps(a, b)
+#define vf_sub(a, b)       _mm_sub_ps(a, b)
+#define vf_mul(a, b)       _mm_mul_ps(a, b)
+#define vf_div(a, b)       _mm_div_ps(a, b)
+#define vf_min(a, b)       _mm_min_ps(a, b)
+#define vf_max(a, b)       _mm_max_ps(a, b)
+#define vf_abs(a)          _mm_andnot_ps(_mm_set1_ps(-0.0f), a)
+#define vf_trunc(a)        _mm_cvtepi32_ps(_mm_cvttps_epi32(a))  /* |a| < 2^31 here */
+#define vf_gt(a, b)        _mm_cmpgt_ps(a, b)
+#define vf_select(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define vm_any(m)          (_mm_movemask_ps(m) != 0)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define FLEET_SIMD_NAME    "neon"
+#define FLEET_LANES        4
+typedef float32x4_t vf_t;
+typedef uint32x4_t vm_t;
+#define vf_set1(x)         vdupq_n_f32(x)
+#define vf_load(p)         vld1q_f32(p)
+#define vf_store(p, v)     vst1q_f32(p, v)
+#define vf_add(a, b)       vaddq_f32(a, b)
+#define vf_sub(a, b)       vsubq_f32(a, b)
+#define vf_mul(a, b)       vmulq_f32(a, b)
+#define vf_div(a, b)       vdivq_f32(a, b)
+#define vf_min(a, b)       vminq_f32(a, b)
+#define vf_max(a, b)       vmaxq_f32(a, b)
+#define vf_abs(a)          vabsq_f32(a)
+#define vf_trunc(a)        vrndq_f32(a)
+#define vf_gt(a, b)        vcgtq_f32(a, b)
+#define vf_select(m, a, b) vbslq_f32(m, a, b)
+#define vm_any(m)          (vmaxvq_u32(m) != 0)
+#endif
+
+/* Same ratios as physics_calculate_rpm(), index = gear */
+static const float g_fleet_gear_ratios[] = {0, 3.5f, 2.1f, 1.4f, 1.0f, 0.8f, 0.65f};
+
+/* Engines are always running in the fleet model */
+#define FLEET_BATTERY_VOLTAGE     (12.0f + 2.4f)
+#define FLEET_BATTERY_HOT_VOLTAGE (12.0f + 2.4f - 0.2f)
+
+/**
+ * Pick a new target speed for one vehicle (20-140 km/h)
+ */
+static void fleet_retarget(fleet_t *fleet, uint32_t index) {
+    uint32_t x = fleet->rng_state[index];
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    fleet->rng_state[index] = x;
+    
+    fleet->target_speed[index] = (float)(x % 120 + 20);
+    fleet->target_timer[index] = 0.0f;
+}
+
+/**
+ * Allocate and initialize a fleet
+ *
+ * Vehicles start like data_simulator_initialize() does; target changes
+ * are staggered so retargeting is spread evenly over time.
+ */
+int fleet_init(fleet_t *fleet, uint32_t count, uint32_t seed) {
+    if (!fleet || count == 0 || count > FLEET_MAX_VEHICLES) return -1;
+    
+    memset(fleet, 0, sizeof(fleet_t));
+    
+    uint32_t capacity = (count + FLEET_ARRAY_ALIGN - 1) & ~(uint32_t)(FLEET_ARRAY_ALIGN - 1);
+    size_t array_bytes = (size_t)capacity * sizeof(float);
+    const int array_count = 12;
+    
+    if (posix_memalign(&fleet->storage, CACHE_LINE_SIZE, array_bytes * array_count) != 0) {
+        fleet->storage = NULL;
+        return -1;
+    }
+    
+    uint8_t *base = (uint8_t *)fleet->storage;
+    fleet->speed_kmh       = (float *)(base + array_bytes * 0);
+    fleet->rpm             = (float *)(base + array_bytes * 1);
+    fleet->fuel_level      = (float *)(base + array_bytes * 2);
+    fleet->engine_temp     = (float *)(base + array_bytes * 3);
+    fleet->oil_pressure    = (float *)(base + array_bytes * 4);
+    fleet->battery_voltage = (float *)(base + array_bytes * 5);
+    fleet->acceleration    = (float *)(base + array_bytes * 6);
+    fleet->gear            = (float *)(base + array_bytes * 7);
+    fleet->target_speed    = (float *)(base + array_bytes * 8);
+    fleet->target_timer    = (float *)(base + array_bytes * 9);
+    fleet->rng_state       = (uint32_t *)(base + array_bytes * 10);
+    fleet->fuel_burn       = (float *)(base + array_bytes * 11);
+    
+    fleet->count = count;
+    fleet->capacity = capacity;
+    fleet->ambient_temp = DEFAULT_AMBIENT_TEMP;
+    
+    for (uint32_t i = 0; i < capacity; i++) {
+        fleet->speed_kmh[i] = 0.0f;
+        fleet->rpm[i] = IDLE_RPM;
+        fleet->fuel_level[i] = 75.0f;
+        fleet->fuel_burn[i] = 0.0f;
+        fleet->engine_temp[i] = DEFAULT_AMBIENT_TEMP;
+        fleet->oil_pressure[i] = 45.0f;
+        fleet->battery_voltage[i] = 12.6f;
+        fleet->acceleration[i] = 0.0f;
+        fleet->gear[i] = 0.0f;
+        
+        fleet->rng_state[i] = (seed ^ ((i + 1) * 0x9E3779B9u)) | 1u;
+        fleet_retarget(fleet, i);
+        fleet->target_timer[i] = (float)(i % 50) * (REALISTIC_TARGET_PERIOD / 50.0f);
+    }
+    
+    return 0;
+}
+
+void fleet_free(fleet_t *fleet) {
+    if (!fleet) return;
+    
+    free(fleet->storage);
+    memset(fleet, 0, sizeof(fleet_t));
+}
+
+static void fleet_account(fleet_t *fleet, uint64_t start_ns) {
+    fleet->step_time_ns += get_timestamp_ns() - start_ns;
+    fleet->steps++;
+    fleet->vehicle_steps += fleet->count;
+}
+
+/**
+ * Advance every vehicle by delta_time, one vehicle at a time
+ */
+void fleet_step_scalar(fleet_t *fleet, float delta_time) {
+    if (!fleet || !fleet->storage) return;
+    
+    uint64_t start_ns = get_timestamp_ns();
+    
+    for (uint32_t i = 0; i < fleet->count; i++) {
+        fleet->target_timer[i] += delta_time;
+        if (fleet->target_timer[i] > REALISTIC_TARGET_PERIOD) {
+            fleet_retarget(fleet, i);
+        }
+        
+        float speed_diff = fleet->target_speed[i] - fleet->speed_kmh[i];
+        float acceleration = 0.0f;
+        if (fabs(speed_diff) > 1.0f) {
+            acceleration = clamp(speed_diff * 0.5f, REALISTIC_DECELERATION, REALISTIC_ACCELERATION);
+        }
+        
+        float speed = physics_calculate_speed(fleet->speed_kmh[i], acceleration, delta_time);
+        speed = clamp(speed, 0.0f, REALISTIC_MAX_SPEED);
+        
+        int gear = (int)clamp((float)((int)(speed / 25.0f) + 1), 1.0f, 6.0f);
+        float rpm = physics_calculate_rpm(speed, gear, 1.0f);
+        
+        float power = physics_calculate_engine_power(speed, acceleration, DEFAULT_VEHICLE_MASS,
+                                                     DEFAULT_DRAG_COEFF, DEFAULT_ROLLING_RESIST);
+        float burn = fleet->fuel_burn[i] + physics_calculate_fuel_consumption(power, rpm, delta_time);
+        float fuel = fleet->fuel_level[i];
+        if (burn > FUEL_LEVEL_STEP) {
+            fuel -= burn;
+            burn = 0.0f;
+        }
+        float temp = physics_calculate_engine_temp(fleet->engine_temp[i], rpm,
+                                                   fleet->ambient_temp, delta_time);
+        
+        fleet->acceleration[i] = acceleration;
+        fleet->speed_kmh[i] = speed;
+        fleet->gear[i] = (float)gear;
+        fleet->rpm[i] = rpm;
+        fleet->fuel_level[i] = clamp(fuel, 0.0f, 100.0f);
+        fleet->fuel_burn[i] = burn;
+        fleet->engine_temp[i] = temp;
+        fleet->oil_pressure[i] = 20.0f + (rpm / 8000.0f) * 60.0f;
+        fleet->battery_voltage[i] = temp > 100.0f ? FLEET_BATTERY_HOT_VOLTAGE : FLEET_BATTERY_VOLTAGE;
+    }
+    
+    fleet_account(fleet, start_ns);
+}
+
+#ifdef FLEET_SIMD_NAME
+/**
+ * Advance every vehicle by delta_time, FLEET_LANES vehicles at a time
+ */
+static void fleet_step_vector(fleet_t *fleet, float delta_time) {
+    const vf_t dt = vf_set1(delta_time);
+    const vf_t zero = vf_set1(0.0f);
+    const vf_t one = vf_set1(1.0f);
+    const vf_t half = vf_set1(0.5f);
+    const vf_t period = vf_set1(REALISTIC_TARGET_PERIOD);
+    const vf_t accel_max = vf_set1(REALISTIC_ACCELERATION);
+    const vf_t decel_max = vf_set1(REALISTIC_DECELERATION);
+    const vf_t speed_max = vf_set1(REALISTIC_MAX_SPEED);
+    const vf_t kmh_per_ms = vf_set1(3.6f);
+    const vf_t kmh_per_gear = vf_set1(25.0f);
+    const vf_t gear_max = vf_set1(6.0f);
+    const vf_t rpm_min = vf_set1(800.0f);
+    const vf_t rpm_max = vf_set1(MAX_RPM);
+    const vf_t rpm_scale = vf_set1(8000.0f);
+    const vf_t ambient = vf_set1(fleet->ambient_temp);
+    const vf_t drag_scale = vf_set1(0.5f * AIR_DENSITY * DEFAULT_DRAG_COEFF * DEFAULT_FRONTAL_AREA);
+    const vf_t rolling_force = vf_set1(DEFAULT_ROLLING_RESIST * DEFAULT_VEHICLE_MASS * GRAVITY);
+    
+    for (uint32_t i = 0; i < fleet->capacity; i += FLEET_LANES) {
+        /* Target changes are rare: vector test, scalar update */
+        vf_t timer = vf_add(vf_load(fleet->target_timer + i), dt);
+        vf_store(fleet->target_timer + i, timer);
+        if (vm_any(vf_gt(timer, period))) {
+            for (uint32_t lane = i; lane < i + FLEET_LANES; lane++) {
+                if (fleet->target_timer[lane] > REALISTIC_TARGET_PERIOD) {
+                    fleet_retarget(fleet, lane);
+                }
+            }
+        }
+        
+        /* physics_calculate_speed() */
+        vf_t speed = vf_load(fleet->speed_kmh + i);
+        vf_t speed_diff = vf_sub(vf_load(fleet->target_speed + i), speed);
+        vf_t acceleration = vf_max(vf_min(vf_mul(speed_diff, half), accel_max), decel_max);
+        acceleration = vf_select(vf_gt(vf_abs(speed_diff), one), acceleration, zero);
+        speed = vf_add(speed, vf_mul(vf_mul(acceleration, dt), kmh_per_ms));
+        speed = vf_max(vf_min(speed, speed_max), zero);
+        
+        /* physics_calculate_rpm(): ratio selected by gear threshold */
+        vf_t gear = vf_add(vf_trunc(vf_div(speed, kmh_per_gear)), one);
+        gear = vf_max(vf_min(gear, gear_max), one);
+        vf_t ratio = vf_set1(g_fleet_gear_ratios[1]);
+        for (int g = 2; g <= 6; g++) {
+            ratio = vf_select(vf_gt(gear, vf_set1((float)(g - 1))), vf_set1(g_fleet_gear_ratios[g]), ratio);
+        }
+        vf_t rpm = vf_mul(vf_div(vf_mul(vf_div(speed, kmh_per_ms), vf_set1(60.0f)), vf_set1(2.0f)),
+                          vf_set1(3.9f));
+        rpm = vf_mul(rpm, ratio);
+        rpm = vf_max(vf_min(rpm, rpm_max), rpm_min);
+        vf_t rpm_fraction = vf_div(rpm, rpm_scale);
+        
+        /* physics_calculate_engine_power() */
+        vf_t v = vf_div(speed, kmh_per_ms);
+        vf_t force = vf_add(vf_add(vf_mul(vf_set1(DEFAULT_VEHICLE_MASS), acceleration),
+                                   vf_mul(vf_mul(drag_scale, v), v)),
+                            rolling_force);
+        vf_t power = vf_max(vf_div(vf_mul(force, v), vf_set1(1000.0f)), zero);
+        
+        /* physics_calculate_fuel_consumption(), taken off in FUEL_LEVEL_STEP amounts */
+        vf_t idle_rate = vf_mul(vf_set1(FUEL_IDLE_RATE), vf_div(rpm, vf_set1(800.0f)));
+        vf_t load_rate = vf_div(vf_mul(vf_div(power, vf_set1(DRIVETRAIN_EFFICIENCY)),
+                                       vf_set1(FUEL_BSFC)), vf_set1(FUEL_DENSITY));
+        vf_t litres = vf_div(vf_mul(vf_add(idle_rate, load_rate), dt), vf_set1(3600.0f));
+        vf_t burn = vf_add(vf_load(fleet->fuel_burn + i),
+                           vf_mul(vf_div(litres, vf_set1(FUEL_TANK_CAPACITY)), vf_set1(100.0f)));
+        vm_t take = vf_gt(burn, vf_set1(FUEL_LEVEL_STEP));
+        vf_t fuel = vf_load(fleet->fuel_level + i);
+        fuel = vf_select(take, vf_sub(fuel, burn), fuel);
+        fuel = vf_max(vf_min(fuel, vf_set1(100.0f)), zero);
+        burn = vf_select(take, zero, burn);
+        
+        /* physics_calculate_engine_temp() */
+        vf_t temp = vf_load(fleet->engine_temp + i);
+        vf_t target_temp = vf_add(vf_add(ambient, vf_set1(50.0f)), vf_mul(rpm_fraction, vf_set1(40.0f)));
+        temp = vf_add(temp, vf_mul(vf_mul(vf_sub(target_temp, temp), vf_set1(10.0f)), dt));
+        
+        vf_store(fleet->acceleration + i, acceleration);
+        vf_store(fleet->speed_kmh + i, speed);
+        vf_store(fleet->gear + i, gear);
+        vf_store(fleet->rpm + i, rpm);
+        vf_store(fleet->fuel_level + i, fuel);
+        vf_store(fleet->fuel_burn + i, burn);
+        vf_store(fleet->engine_temp + i, temp);
+        vf_store(fleet->oil_pressure + i, vf_add(vf_set1(20.0f), vf_mul(rpm_fraction, vf_set1(60.0f))));
+        vf_store(fleet->battery_voltage + i,
+                 vf_select(vf_gt(temp, vf_set1(100.0f)), vf_set1(FLEET_BATTERY_HOT_VOLTAGE),
+                           vf_set1(FLEET_BATTERY_VOLTAGE)));
+    }
+}
+#endif
+
+/**
+ * Advance every vehicle by delta_time
+ */
+void fleet_step(fleet_t *fleet, float delta_time) {
+    if (!fleet || !fleet->storage) return;
+    
+#ifdef FLEET_SIMD_NAME
+    uint64_t start_ns = get_timestamp_ns();
+    fleet_step_vector(fleet, delta_time);
+    fleet_account(fleet, start_ns);
+#else
+    fleet_step_scalar(fleet, delta_time);
+#endif
+}
+
+/**
+ * Utility functions
+ */
+void fleet_get_vehicle(const fleet_t *fleet, uint32_t index, vehicle_data_t *out) {
+    if (!fleet || !out || index >= fleet->count) return;
+    
+    memset(out, 0, sizeof(vehicle_data_t));
+    out->speed_kmh = fleet->speed_kmh[index];
+    out->rpm = fleet->rpm[index];
+    out->acceleration = fleet->acceleration[index];
+    out->fuel_level = fleet->fuel_level[index];
+    out->engine_temp = fleet->engine_temp[index];
+    out->oil_pressure = fleet->oil_pressure[index];
+    out->battery_voltage = fleet->battery_voltage[index];
+    out->gear_position = (int)fleet->gear[index];
+    out->ignition_on = true;
+    out->engine_running = true;
+    out->seatbelt_fastened = true;
+    out->data_valid = true;
+}
+
+const char *fleet_simd_name(void) {
+#ifdef FLEET_SIMD_NAME
+    return FLEET_SIMD_NAME;
+#else
+    return "scalar";
+#endif
+}
+
+double fleet_vehicles_per_second(const fleet_t *fleet) {
+    if (!fleet || fleet->step_time_ns == 0) return 0.0;
+    return (double)fleet->vehicle_steps * 1e9 / (double)fleet->step_time_ns;
+}
+
+void fleet_reset_statistics(fleet_t *fleet) {
+    if (!fleet) return;
+    
+    fleet->steps = 0;
+    fleet->vehicle_steps = 0;
+    fleet->step_time_ns = 0;
+}
+
+void fleet_print_statistics(const fleet_t *fleet) {
+    if (!fleet) return;
+    
+    printf("Fleet Statistics:\n");
+    printf("  Vehicles: %u (%s)\n", fleet->count, fleet_simd_name());
+    printf("  Steps: %llu\n", (unsigned long long)fleet->steps);
+    if (fleet->vehicle_steps > 0) {
+        printf("  Throughput: %.1f M vehicle-steps/s (%.2f ns per vehicle-step)\n",
+               fleet_vehicles_per_second(fleet) / 1e6,
+               (double)fleet->step_time_ns / (double)fleet->vehicle_steps);
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * QNX Dashboard Simulator - Frame Scheduler Implementation
+ *
+ * The GUI thread wakes on a fixed release grid, but most activations on a
+ * steady drive find nothing worth presenting. The scheduler stretches the
+ * interval between activations in whole releases: to the idle rate once
+ * the screen has been still, with no gauge moving and no lamp blinking,
+ * for FRAME_IDLE_AFTER activations, and one step at a time towards the
+ * minimum rate while presented frames take more than FRAME_LOAD_HIGH of
+ * their interval. A presented frame or an animation ends idling at once;
+ * the load step is only undone when the faster rate is predicted to stay
+ * below FRAME_LOAD_LOW, so the rate does not oscillate.
+ */
+
+#include "../include/frame_scheduler.h"
+
+#define NSEC_PER_SEC 1000000000ULL
+
+static uint32_t frame_stride(uint32_t rate_hz, uint32_t slower_hz) {
+    if (slower_hz == 0 || slower_hz >= rate_hz) return 1;
+    return (rate_hz + slower_hz - 1) / slower_hz;
+}
+
+void frame_scheduler_init(frame_scheduler_t *scheduler, uint32_t rate_hz, uint32_t min_rate_hz,
+                          uint32_t idle_rate_hz, bool adaptive) {
+    if (!scheduler) return;
+    
+    memset(scheduler, 0, sizeof(frame_scheduler_t));
+    rate_hz = rate_hz > 0 ? rate_hz : 1;
+    scheduler->period_ns = NSEC_PER_SEC / rate_hz;
+    scheduler->max_stride = frame_stride(rate_hz, min_rate_hz);
+    scheduler->idle_stride = frame_stride(rate_hz, idle_rate_hz);
+    scheduler->idle_after = FRAME_IDLE_AFTER;
+    scheduler->adaptive = adaptive;
+    scheduler->load_stride = 1;
+    scheduler->stride = 1;
+}
+
+/**
+ * Account for one activation and choose the next
+ *
+ * presented tells whether the activation put a frame on screen and
+ * animating whether the next one may differ without new data (an
+ * animation below the visual epsilon presents nothing yet); cost_ns is
+ * the time it took. Returns the number of releases to wait, for
+ * periodic_task_wait_releases().
+ */
+uint32_t frame_scheduler_end_frame(frame_scheduler_t *scheduler, bool presented, bool animating,
+                                   uint64_t cost_ns) {
+    if (!scheduler) return 1;
+    
+    scheduler->activations++;
+    if (presented) {
+        scheduler->presented++;
+    }
+    if (presented || animating) {
+        scheduler->still = 0;
+    } else if (scheduler->still < UINT32_MAX) {
+        scheduler->still++;
+    }
+    if (!scheduler->adaptive) {
+        return 1;
+    }
+    
+    /* Only presented frames say what a frame costs */
+    if (presented) {
+        float interval_ns = (float)(scheduler->period_ns * scheduler->load_stride);
+        scheduler->load += ((float)cost_ns / interval_ns - scheduler->load) * FRAME_LOAD_SMOOTHING;
+        
+        uint32_t stride = scheduler->load_stride;
+        if (scheduler->load > FRAME_LOAD_HIGH && stride < scheduler->max_stride) {
+            scheduler->load = scheduler->load * stride / (stride + 1);
+            scheduler->load_stride = stride + 1;
+            scheduler->rate_drops++;
+        } else if (stride > 1 && scheduler->load * stride / (stride - 1) < FRAME_LOAD_LOW) {
+            scheduler->load = scheduler->load * stride / (stride - 1);
+            scheduler->load_stride = stride - 1;
+            scheduler->rate_restores++;
+        }
+    }
+    
+    scheduler->stride = scheduler->load_stride;
+    if (scheduler->still >= scheduler->idle_after && scheduler->idle_stride > scheduler->stride) {
+        scheduler->stride = scheduler->idle_stride;
+        scheduler->idle_activations++;
+    }
+    return scheduler->stride;
+}
+
+/**
+ * Activation rate chosen for the next interval
+ */
+float frame_scheduler_rate_hz(const frame_scheduler_t *scheduler) {
+    if (!scheduler || scheduler->period_ns == 0) return 0.0f;
+    return (float)NSEC_PER_SEC / (float)(scheduler->period_ns * scheduler->stride);
+}
+
+void frame_scheduler_print_statistics(const frame_scheduler_t *scheduler) {
+    if (!scheduler) return;
+    
+    printf("=== Frame Scheduler ===\n");
+    printf("Activations: %llu, %llu presented (%.1f%%), %llu at the idle rate\n",
+           (unsigned long long)scheduler->activations,
+           (unsigned long long)scheduler->presented,
+           scheduler->activations ? 100.0 * scheduler->presented / scheduler->activations : 0.0,
+           (unsigned long long)scheduler->idle_activations);
+    printf("Rate: %.1f Hz now (full %.1f Hz, %s), load %.2f, %u drops, %u restores\n",
+           frame_scheduler_rate_hz(scheduler),
+           (double)NSEC_PER_SEC / (double)scheduler->period_ns,
+           scheduler->adaptive ? "adaptive" : "fixed",
+           scheduler->load, scheduler->rate_drops, scheduler->rate_restores);
+}
@@ -0,0 +1,710 @@
+/**
+ * QNX Dashboard Simulator - Software Framebuffer Implementation
+ *
+ * A plain 32 bpp raster that the GUI manager draws every frame into, so
+ * the dashboard renders (and can be profiled) without Photon. Primitives
+ * clip against the current clip rectangle and work a row at a time: they
+ * find the columns a shape can touch and hand them to the anti-aliased
+ * span kernels in raster.c. Rectangles and text stay pixel-aligned and
+ * opaque colours are plain stores. Present copies the frame, or only the
+ * rectangles that changed, to the chosen output: nowhere (memory), a raw
+ * BGRA frame file, or a Linux fbdev device.
+ */
+
+#include <fcntl.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fb.h>
+#endif
+#include <float.h>
+#include "../include/framebuffer.h"
+#include "../include/raster.h"
+
+#define FRAMEBUFFER_DEG_TO_RAD  0.01745329252f
+
+/* 5x7 glyphs, one byte per row, bit 4 is the leftmost column */
+static const uint8_t FONT_5X7[96][FRAMEBUFFER_GLYPH_HEIGHT] = {
+    ['%' - 32] = { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 },
+    ['+' - 32] = { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 },
+    ['-' - 32] = { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 },
+    ['.' - 32] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C },
+    ['/' - 32] = { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },
+    ['0' - 32] = { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },
+    ['1' - 32] = { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },
+    ['2' - 32] = { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },
+    ['3' - 32] = { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },
+    ['4' - 32] = { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },
+    ['5' - 32] = { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },
+    ['6' - 32] = { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },
+    ['7' - 32] = { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },
+    ['8' - 32] = { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },
+    ['9' - 32] = { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },
+    [':' - 32] = { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 },
+    ['A' - 32] = { 0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11 },
+    ['B' - 32] = { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E },
+    ['C' - 32] = { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E },
+    ['D' - 32] = { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C },
+    ['E' - 32] = { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F },
+    ['F' - 32] = { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 },
+    ['G' - 32] = { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F },
+    ['H' - 32] = { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },
+    ['I' - 32] = { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },
+    ['J' - 32] = { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C },
+    ['K' - 32] = { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },
+    ['L' - 32] = { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F },
+    ['M' - 32] = { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 },
+    ['N' - 32] = { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },
+    ['O' - 32] = { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },
+    ['P' - 32] = { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 },
+    ['Q' - 32] = { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D },
+    ['R' - 32] = { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 },
+    ['S' - 32] = { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E },
+    ['T' - 32] = { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },
+    ['U' - 32] = { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },
+    ['V' - 32] = { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 },
+    ['W' - 32] = { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A },
+    ['X' - 32] = { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 },
+    ['Y' - 32] = { 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04 },
+    ['Z' - 32] = { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F },
+};
+
+static uint64_t framebuffer_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Write a whole buffer, retrying short writes and EINTR
+ *
+ * Returns 0 or the errno that stopped it.
+ */
+static int framebuffer_write_fully(int fd, const uint8_t *data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return 0;
+}
+
+/**
+ * Allocate a cleared framebuffer of width x height pixels
+ */
+int framebuffer_init(framebuffer_t *fb, int width, int height) {
+    if (!fb) return -1;
+
+    memset(fb, 0, sizeof(framebuffer_t));
+    fb->output_fd = -1;
+
+    if (width <= 0 || height <= 0 ||
+        width > FRAMEBUFFER_MAX_DIMENSION || height > FRAMEBUFFER_MAX_DIMENSION) {
+        fprintf(stderr, "Framebuffer: invalid size %dx%d\n", width, height);
+        return -1;
+    }
+
+    int stride = (width + FRAMEBUFFER_ROW_ALIGN - 1) & ~(FRAMEBUFFER_ROW_ALIGN - 1);
+    void *storage = NULL;
+    if (posix_memalign(&storage, CACHE_LINE_SIZE, (size_t)stride * height * sizeof(uint32_t)) != 0) {
+        fprintf(stderr, "Framebuffer: out of memory for %dx%d\n", width, height);
+        return -1;
+    }
+
+    fb->pixels = (uint32_t *)storage;
+    fb->width = width;
+    fb->height = height;
+    fb->stride = stride;
+    memset(fb->pixels, 0, (size_t)stride * height * sizeof(uint32_t));
+    framebuffer_reset_clip(fb);
+
+    return 0;
+}
+
+/**
+ * Close the output and release the pixels
+ */
+void framebuffer_free(framebuffer_t *fb) {
+    if (!fb) return;
+
+    framebuffer_close_output(fb);
+    free(fb->pixels);
+    fb->pixels = NULL;
+    fb->width = 0;
+    fb->height = 0;
+}
+
+#ifdef __linux__
+/**
+ * Map a Linux fbdev device for present
+ */
+static int framebuffer_open_device(framebuffer_t *fb, const char *path) {
+    struct fb_var_screeninfo var;
+    struct fb_fix_screeninfo fix;
+
+    if (ioctl(fb->output_fd, FBIOGET_VSCREENINFO, &var) != 0 ||
+        ioctl(fb->output_fd, FBIOGET_FSCREENINFO, &fix) != 0) {
+        fprintf(stderr, "Framebuffer: %s is not a framebuffer device: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    if (var.bits_per_pixel != 32 && var.bits_per_pixel != 16) {
+        fprintf(stderr, "Framebuffer: %s uses %u bpp, only 32 and 16 are supported\n",
+                path, var.bits_per_pixel);
+        return -1;
+    }
+
+    void *map = mmap(NULL, fix.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fb->output_fd, 0);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "Framebuffer: cannot map %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    fb->device_map = map;
+    fb->device_map_size = fix.smem_len;
+    fb->device_pixels = (uint8_t *)map;
+    fb->device_width = (int)var.xres;
+    fb->device_height = (int)var.yres;
+    fb->device_stride = (int)fix.line_length;
+    fb->device_bpp = (int)var.bits_per_pixel;
+
+    /* Present into the visible page of a panned virtual screen */
+    size_t visible_offset = (size_t)var.yoffset * fix.line_length +
+                            (size_t)var.xoffset * (var.bits_per_pixel / 8);
+    if (visible_offset + (size_t)fb->device_height * fix.line_length <= fix.smem_len) {
+        fb->device_pixels += visible_offset;
+    }
+
+    printf("Framebuffer: %s %dx%d, %d bpp\n", path,
+           fb->device_width, fb->device_height, fb->device_bpp);
+    return 0;
+}
+#endif
+
+/**
+ * Select where frames go on present
+ *
+ * target is "memory" (or NULL), a /dev/fb* device, or a file that raw
+ * BGRA frames are appended to.
+ */
+int framebuffer_open_output(framebuffer_t *fb, const char *target) {
+    if (!fb) return -1;
+
+    framebuffer_close_output(fb);
+    if (!target || !target[0] || strcmp(target, "memory") == 0) {
+        return 0;
+    }
+
+    strncpy(fb->output_path, target, sizeof(fb->output_path) - 1);
+    fb->output_path[sizeof(fb->output_path) - 1] = '\0';
+
+    if (strncmp(target, "/dev/fb", 7) == 0) {
+#ifdef __linux__
+        fb->output_fd = open(target, O_RDWR);
+        if (fb->output_fd < 0) {
+            fprintf(stderr, "Framebuffer: cannot open %s: %s\n", target, strerror(errno));
+            framebuffer_close_output(fb);
+            return -1;
+        }
+        if (framebuffer_open_device(fb, target) != 0) {
+            framebuffer_close_output(fb);
+            return -1;
+        }
+        fb->output = FRAMEBUFFER_OUTPUT_DEVICE;
+        return 0;
+#else
+        fprintf(stderr, "Framebuffer: %s needs Linux fbdev support\n", target);
+        framebuffer_close_output(fb);
+        return -1;
+#endif
+    }
+
+    fb->output_fd = open(target, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fb->output_fd < 0) {
+        fprintf(stderr, "Framebuffer: cannot open %s: %s\n", target, strerror(errno));
+        framebuffer_close_output(fb);
+        return -1;
+    }
+    fb->output = FRAMEBUFFER_OUTPUT_FILE;
+    printf("Framebuffer: writing %dx%d BGRA frames to %s\n", fb->width, fb->height, target);
+    return 0;
+}
+
+/**
+ * Return to memory-only output
+ */
+void framebuffer_close_output(framebuffer_t *fb) {
+    if (!fb) return;
+
+    if (fb->device_map) {
+        munmap(fb->device_map, fb->device_map_size);
+        fb->device_map = NULL;
+        fb->device_map_size = 0;
+        fb->device_pixels = NULL;
+    }
+    if (fb->output_fd >= 0) {
+        close(fb->output_fd);
+        fb->output_fd = -1;
+    }
+    fb->output = FRAMEBUFFER_OUTPUT_MEMORY;
+    fb->output_path[0] = '\0';
+}
+
+/**
+ * Copy one rectangle to the device, converting to RGB565 if needed
+ */
+static void framebuffer_present_device(framebuffer_t *fb, const framebuffer_rect_t *rect) {
+    int x0 = rect->x < 0 ? 0 : rect->x;
+    int y0 = rect->y < 0 ? 0 : rect->y;
+    int x1 = rect->x + rect->width;
+    int y1 = rect->y + rect->height;
+    if (x1 > fb->width) x1 = fb->width;
+    if (x1 > fb->device_width) x1 = fb->device_width;
+    if (y1 > fb->height) y1 = fb->height;
+    if (y1 > fb->device_height) y1 = fb->device_height;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int cols = x1 - x0;
+    for (int y = y0; y < y1; y++) {
+        const uint32_t *src = fb->pixels + (size_t)y * fb->stride + x0;
+        uint8_t *dst = fb->device_pixels + (size_t)y * fb->device_stride;
+
+        if (fb->device_bpp == 32) {
+            memcpy(dst + (size_t)x0 * sizeof(uint32_t), src, (size_t)cols * sizeof(uint32_t));
+        } else {
+            uint16_t *dst16 = (uint16_t *)dst + x0;
+            for (int x = 0; x < cols; x++) {
+                uint32_t p = src[x];
+                dst16[x] = (uint16_t)(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+            }
+        }
+    }
+    fb->bytes_presented += (uint64_t)(y1 - y0) * cols * (fb->device_bpp / 8);
+}
+
+/**
+ * Hand the finished frame to the output
+ *
+ * Returns 0, or -1 when a file write failed (the output is then closed).
+ */
+int framebuffer_present(framebuffer_t *fb) {
+    if (!fb) return -1;
+
+    framebuffer_rect_t all = {0, 0, fb->width, fb->height};
+    return framebuffer_present_rects(fb, &all, 1);
+}
+
+/**
+ * Hand the frame to the output when only rects changed since the last present
+ *
+ * A device only receives the changed rectangles; a frame file always gets
+ * the complete frame.
+ */
+int framebuffer_present_rects(framebuffer_t *fb, const framebuffer_rect_t *rects, int count) {
+    if (!fb || !fb->pixels || (count > 0 && !rects)) return -1;
+
+    uint64_t start = framebuffer_now_ns();
+    int result = 0;
+
+    switch (fb->output) {
+        case FRAMEBUFFER_OUTPUT_DEVICE:
+            for (int i = 0; i < count; i++) {
+                framebuffer_present_device(fb, &rects[i]);
+            }
+            break;
+        case FRAMEBUFFER_OUTPUT_FILE: {
+            size_t row_bytes = (size_t)fb->width * sizeof(uint32_t);
+            int error = 0;
+            if (fb->stride == fb->width) {
+                error = framebuffer_write_fully(fb->output_fd, (const uint8_t *)fb->pixels,
+                                                row_bytes * fb->height);
+            } else {
+                for (int y = 0; y < fb->height && error == 0; y++) {
+                    error = framebuffer_write_fully(fb->output_fd,
+                                                    (const uint8_t *)(fb->pixels + (size_t)y * fb->stride),
+                                                    row_bytes);
+                }
+            }
+            if (error != 0) {
+                fprintf(stderr, "Framebuffer: write to %s failed: %s\n", fb->output_path, strerror(error));
+                framebuffer_close_output(fb);
+                result = -1;
+            } else {
+                fb->bytes_presented += row_bytes * fb->height;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    fb->frames_presented++;
+    fb->present_time_ns += framebuffer_now_ns() - start;
+    return result;
+}
+
+/**
+ * Save the current frame as a binary PPM image
+ */
+int framebuffer_write_ppm(const framebuffer_t *fb, const char *path) {
+    if (!fb || !fb->pixels || !path) return -1;
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "Framebuffer: cannot open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    uint8_t *row = malloc((size_t)fb->width * 3);
+    if (!row) {
+        fclose(file);
+        return -1;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", fb->width, fb->height);
+    for (int y = 0; y < fb->height; y++) {
+        const uint32_t *src = fb->pixels + (size_t)y * fb->stride;
+        for (int x = 0; x < fb->width; x++) {
+            row[x * 3 + 0] = (uint8_t)(src[x] >> 16);
+            row[x * 3 + 1] = (uint8_t)(src[x] >> 8);
+            row[x * 3 + 2] = (uint8_t)src[x];
+        }
+        fwrite(row, 3, (size_t)fb->width, file);
+    }
+
+    free(row);
+    int result = ferror(file) ? -1 : 0;
+    if (fclose(file) != 0) result = -1;
+    return result;
+}
+
+/**
+ * Clipping
+ */
+void framebuffer_set_clip(framebuffer_t *fb, int x, int y, int width, int height) {
+    if (!fb) return;
+
+    fb->clip_x0 = x < 0 ? 0 : x;
+    fb->clip_y0 = y < 0 ? 0 : y;
+    fb->clip_x1 = x + width > fb->width ? fb->width : x + width;
+    fb->clip_y1 = y + height > fb->height ? fb->height : y + height;
+    if (fb->clip_x1 < fb->clip_x0) fb->clip_x1 = fb->clip_x0;
+    if (fb->clip_y1 < fb->clip_y0) fb->clip_y1 = fb->clip_y0;
+}
+
+void framebuffer_reset_clip(framebuffer_t *fb) {
+    if (!fb) return;
+
+    fb->clip_x0 = 0;
+    fb->clip_y0 = 0;
+    fb->clip_x1 = fb->width;
+    fb->clip_y1 = fb->height;
+}
+
+/**
+ * Fill pixels [x0, x1) of row y; the caller has clipped
+ */
+static inline void framebuffer_span(framebuffer_t *fb, int y, int x0, int x1, uint32_t color) {
+    uint32_t *row = fb->pixels + (size_t)y * fb->stride;
+    for (int x = x0; x < x1; x++) {
+        row[x] = color;
+    }
+}
+
+/**
+ * Row range [*y0, *y1) of a shape spanning [top, bottom] after clipping
+ */
+static inline bool framebuffer_clip_rows(const framebuffer_t *fb, float top, float bottom,
+                                         int *y0, int *y1) {
+    *y0 = (int)floorf(top);
+    *y1 = (int)ceilf(bottom);
+    if (*y0 < fb->clip_y0) *y0 = fb->clip_y0;
+    if (*y1 > fb->clip_y1) *y1 = fb->clip_y1;
+    return *y0 < *y1;
+}
+
+/**
+ * Drawing primitives
+ */
+void framebuffer_clear(framebuffer_t *fb, uint32_t color) {
+    if (!fb || !fb->pixels) return;
+
+    /* Replaces, even with a translucent colour */
+    for (int row = fb->clip_y0; row < fb->clip_y1; row++) {
+        framebuffer_span(fb, row, fb->clip_x0, fb->clip_x1, color);
+    }
+}
+
+/**
+ * Fill a rectangle; colours with alpha below 0xFF are blended
+ */
+void framebuffer_fill_rect(framebuffer_t *fb, int x, int y, int width, int height, uint32_t color) {
+    if (!fb || !fb->pixels) return;
+
+    int x0 = x < fb->clip_x0 ? fb->clip_x0 : x;
+    int y0 = y < fb->clip_y0 ? fb->clip_y0 : y;
+    int x1 = x + width > fb->clip_x1 ? fb->clip_x1 : x + width;
+    int y1 = y + height > fb->clip_y1 ? fb->clip_y1 : y + height;
+
+    if ((color >> 24) == 0xFF) {
+        for (int row = y0; row < y1; row++) {
+            framebuffer_span(fb, row, x0, x1, color);
+        }
+    } else {
+        for (int row = y0; row < y1; row++) {
+            raster_fill_span(fb->pixels + (size_t)row * fb->stride, x0, x1, color);
+        }
+    }
+}
+
+/**
+ * Copy src with its top-left corner at (x, y), clipped
+ */
+void framebuffer_blit(framebuffer_t *fb, const framebuffer_t *src, int x, int y) {
+    if (!fb || !fb->pixels || !src || !src->pixels) return;
+
+    int x0 = x < fb->clip_x0 ? fb->clip_x0 : x;
+    int y0 = y < fb->clip_y0 ? fb->clip_y0 : y;
+    int x1 = x + src->width > fb->clip_x1 ? fb->clip_x1 : x + src->width;
+    int y1 = y + src->height > fb->clip_y1 ? fb->clip_y1 : y + src->height;
+    if (x0 >= x1) return;
+
+    for (int row = y0; row < y1; row++) {
+        memcpy(fb->pixels + (size_t)row * fb->stride + x0,
+               src->pixels + (size_t)(row - y) * src->stride + (x0 - x),
+               (size_t)(x1 - x0) * sizeof(uint32_t));
+    }
+}
+
+/**
+ * True when [left, right) misses the clip columns
+ */
+static inline bool framebuffer_outside_columns(const framebuffer_t *fb, float left, float right) {
+    return right <= (float)fb->clip_x0 || left >= (float)fb->clip_x1;
+}
+
+/**
+ * Column range [*x0, *x1) whose pixel centres lie within half of cx
+ */
+static inline void framebuffer_row_extent(const framebuffer_t *fb, float cx, float half, int *x0, int *x1) {
+    *x0 = (int)ceilf(cx - half - 0.5f);
+    *x1 = (int)floorf(cx + half - 0.5f) + 1;
+    if (*x0 < fb->clip_x0) *x0 = fb->clip_x0;
+    if (*x1 > fb->clip_x1) *x1 = fb->clip_x1;
+}
+
+/**
+ * Rasterize a ring, row by row
+ *
+ * Each row visits only the pixels within RASTER_EDGE_MARGIN of the outer
+ * circle and skips those well inside the hole, which the kernel would
+ * leave untouched anyway.
+ */
+static void framebuffer_ring(framebuffer_t *fb, const raster_ring_t *ring) {
+    float reach = ring->outer + RASTER_EDGE_MARGIN;
+    float hole = ring->inner - RASTER_EDGE_MARGIN;
+    if (framebuffer_outside_columns(fb, ring->cx - reach, ring->cx + reach)) return;
+
+    int y0, y1;
+    if (!framebuffer_clip_rows(fb, ring->cy - reach, ring->cy + reach, &y0, &y1)) return;
+
+    for (int y = y0; y < y1; y++) {
+        float py = (float)y + 0.5f;
+        float dy = py - ring->cy;
+        if (dy * dy >= reach * reach) continue;
+
+        int x0, x1;
+        framebuffer_row_extent(fb, ring->cx, sqrtf(reach * reach - dy * dy), &x0, &x1);
+        uint32_t *row = fb->pixels + (size_t)y * fb->stride;
+
+        if (hole > 0.0f && dy * dy < hole * hole) {
+            float half = sqrtf(hole * hole - dy * dy);
+            int hole_x0 = (int)ceilf(ring->cx - half);
+            int hole_x1 = (int)floorf(ring->cx + half) - 1;
+            raster_ring_span(row, x0, hole_x0 < x1 ? hole_x0 : x1, py, ring);
+            raster_ring_span(row, hole_x1 > x0 ? hole_x1 : x0, x1, py, ring);
+        } else {
+            raster_ring_span(row, x0, x1, py, ring);
+        }
+    }
+}
+
+/**
+ * Fill the disc of radius around (cx, cy), anti-aliased
+ */
+void framebuffer_fill_circle(framebuffer_t *fb, float cx, float cy, float radius, uint32_t color) {
+    if (!fb || !fb->pixels || radius <= 0.0f) return;
+
+    raster_ring_t ring;
+    memset(&ring, 0, sizeof(ring));
+    ring.cx = cx;
+    ring.cy = cy;
+    ring.outer = radius;
+    ring.inner = -FLT_MAX;
+    ring.sector = RASTER_SECTOR_NONE;
+    ring.color = color;
+    framebuffer_ring(fb, &ring);
+}
+
+/**
+ * Fill the ring between the radii from start_deg counter-clockwise to end_deg
+ *
+ * Angles are in degrees with 0 pointing right and 90 pointing up. The
+ * sector edges are distances to the two edge lines instead of an atan2()
+ * per pixel, which also anti-aliases the ends.
+ */
+void framebuffer_fill_arc(framebuffer_t *fb, float cx, float cy, float outer_radius,
+                          float inner_radius, float start_deg, float end_deg, uint32_t color) {
+    if (!fb || !fb->pixels || outer_radius <= 0.0f || outer_radius <= inner_radius) return;
+
+    float sweep = fmodf(end_deg - start_deg, 360.0f);
+    if (sweep <= 0.0f) sweep += 360.0f;
+    bool full_circle = (end_deg - start_deg) >= 360.0f;
+
+    float start_rad = start_deg * FRAMEBUFFER_DEG_TO_RAD;
+    float end_rad = (start_deg + sweep) * FRAMEBUFFER_DEG_TO_RAD;
+
+    raster_ring_t ring;
+    ring.cx = cx;
+    ring.cy = cy;
+    ring.outer = outer_radius;
+    ring.inner = inner_radius > 0.0f ? inner_radius : -FLT_MAX;
+    ring.start_x = cosf(start_rad);
+    ring.start_y = sinf(start_rad);
+    ring.end_x = cosf(end_rad);
+    ring.end_y = sinf(end_rad);
+    ring.sector = full_circle ? RASTER_SECTOR_NONE :
+                  sweep > 180.0f ? RASTER_SECTOR_REFLEX : RASTER_SECTOR_CONVEX;
+    ring.color = color;
+    framebuffer_ring(fb, &ring);
+}
+
+/**
+ * Draw a segment with round caps, thickness pixels wide, anti-aliased
+ *
+ * Each row visits only the columns the capsule can reach on that row.
+ */
+void framebuffer_draw_line(framebuffer_t *fb, float x0, float y0, float x1, float y1,
+                           float thickness, uint32_t color) {
+    if (!fb || !fb->pixels || thickness <= 0.0f) return;
+
+    raster_capsule_t capsule;
+    capsule.x0 = x0;
+    capsule.y0 = y0;
+    capsule.dx = x1 - x0;
+    capsule.dy = y1 - y0;
+    float length2 = capsule.dx * capsule.dx + capsule.dy * capsule.dy;
+    capsule.inv_length2 = length2 > 0.0f ? 1.0f / length2 : 0.0f;
+    capsule.half_width = thickness * 0.5f;
+    capsule.color = color;
+
+    float reach = capsule.half_width + RASTER_EDGE_MARGIN;
+    float min_x = (x0 < x1 ? x0 : x1) - reach;
+    float max_x = (x0 > x1 ? x0 : x1) + reach;
+    float min_y = (y0 < y1 ? y0 : y1) - reach;
+    float max_y = (y0 > y1 ? y0 : y1) + reach;
+    if (framebuffer_outside_columns(fb, min_x, max_x)) return;
+
+    int row0, row1;
+    if (!framebuffer_clip_rows(fb, min_y, max_y, &row0, &row1)) return;
+
+    for (int y = row0; y < row1; y++) {
+        float py = (float)y + 0.5f;
+
+        /* Part of the segment within reach of this row */
+        float t0 = 0.0f, t1 = 1.0f;
+        if (capsule.dy != 0.0f) {
+            t0 = (py - reach - y0) / capsule.dy;
+            t1 = (py + reach - y0) / capsule.dy;
+            if (t0 > t1) {
+                float swap = t0;
+                t0 = t1;
+                t1 = swap;
+            }
+            t0 = clamp(t0, 0.0f, 1.0f);
+            t1 = clamp(t1, 0.0f, 1.0f);
+        }
+        float xa = x0 + t0 * capsule.dx;
+        float xb = x0 + t1 * capsule.dx;
+
+        int col0 = (int)floorf((xa < xb ? xa : xb) - reach);
+        int col1 = (int)ceilf((xa > xb ? xa : xb) + reach);
+        if (col0 < fb->clip_x0) col0 = fb->clip_x0;
+        if (col1 > fb->clip_x1) col1 = fb->clip_x1;
+        raster_capsule_span(fb->pixels + (size_t)y * fb->stride, col0, col1, py, &capsule);
+    }
+}
+
+/**
+ * Draw text in the built-in 5x7 font, each font pixel scale x scale
+ *
+ * Lower case is drawn as upper case; characters outside the font leave a
+ * blank cell. Returns the advance in pixels.
+ */
+int framebuffer_draw_text(framebuffer_t *fb, int x, int y, const char *text,
+                          int scale, uint32_t color) {
+    if (!fb || !fb->pixels || !text || scale <= 0) return 0;
+
+    int advance = (int)strlen(text) * FRAMEBUFFER_GLYPH_ADVANCE * scale;
+    if (y >= fb->clip_y1 || y + FRAMEBUFFER_GLYPH_HEIGHT * scale <= fb->clip_y0 ||
+        x >= fb->clip_x1 || x + advance <= fb->clip_x0) {
+        return advance;
+    }
+
+    int pen_x = x;
+    for (const char *c = text; *c; c++) {
+        int ch = (unsigned char)*c;
+        if (ch >= 'a' && ch <= 'z') ch -= 'a' - 'A';
+
+        if (ch >= 32 && ch < 128) {
+            const uint8_t *glyph = FONT_5X7[ch - 32];
+            for (int gy = 0; gy < FRAMEBUFFER_GLYPH_HEIGHT; gy++) {
+                uint8_t bits = glyph[gy];
+                for (int gx = 0; bits && gx < FRAMEBUFFER_GLYPH_WIDTH; gx++) {
+                    if (bits & (0x10 >> gx)) {
+                        framebuffer_fill_rect(fb, pen_x + gx * scale, y + gy * scale,
+                                              scale, scale, color);
+                    }
+                }
+            }
+        }
+        pen_x += FRAMEBUFFER_GLYPH_ADVANCE * scale;
+    }
+
+    return pen_x - x;
+}
+
+/**
+ * Width of text as drawn, without the trailing inter-character gap
+ */
+int framebuffer_text_width(const char *text, int scale) {
+    if (!text || !text[0] || scale <= 0) return 0;
+    int length = (int)strlen(text);
+    return (length * FRAMEBUFFER_GLYPH_ADVANCE - (FRAMEBUFFER_GLYPH_ADVANCE - FRAMEBUFFER_GLYPH_WIDTH)) * scale;
+}
+
+/**
+ * Utility functions
+ */
+const char *framebuffer_output_to_string(framebuffer_output_t output) {
+    switch (output) {
+        case FRAMEBUFFER_OUTPUT_MEMORY: return "memory";
+        case FRAMEBUFFER_OUTPUT_FILE: return "file";
+        case FRAMEBUFFER_OUTPUT_DEVICE: return "device";
+        default: return "unknown";
+    }
+}
+
+void framebuffer_print_statistics(const framebuffer_t *fb) {
+    if (!fb || fb->frames_presented == 0) return;
+
+    printf("Framebuffer %dx%d -> %s%s%s: %llu frames, %.1f us/frame present, %.0f KiB/frame\n",
+           fb->width, fb->height, framebuffer_output_to_string(fb->output),
+           fb->output_path[0] ? " " : "", fb->output_path,
+           (unsigned long long)fb->frames_presented,
+           (double)fb->present_time_ns / fb->frames_presented / 1000.0,
+           (double)fb->bytes_presented / fb->frames_presented / 1024.0);
+}
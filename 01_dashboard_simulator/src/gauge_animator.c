@@ -0,0 +1,305 @@
+/**
+ * QNX Dashboard Simulator - Gauge Animator Implementation
+ *
+ * Every moving dial and bar is a lane in flat float arrays, advanced by
+ * the measured frame interval in one pass per frame. The spring is the
+ * exact solution of a critically damped oscillator over the step
+ * (x = value - target, w = ANIMATION_SPRING_OMEGA * rate):
+ *
+ *   x' = (x + (v + w x) dt) e^(-w dt)
+ *   v' = (v - w (v + w x) dt) e^(-w dt)
+ *
+ * so a gauge moves the same way at any frame rate, never overshoots and
+ * keeps its velocity when the target changes in flight. The easing curves
+ * restart from the current value on every new target and arrive after
+ * exactly the duration. Lanes within their tolerance of the target are
+ * snapped to it and dropped; when none are left everything has settled.
+ */
+
+#include "../include/gauge_animator.h"
+
+static const char *g_animation_curve_names[ANIMATION_CURVE_COUNT] = {
+    "spring", "ease_out", "ease_in_out", "linear"
+};
+
+int gauge_animator_init(gauge_animator_t *animator, animation_curve_t curve, uint32_t duration_ms) {
+    if (!animator) return -1;
+
+    memset(animator, 0, sizeof(gauge_animator_t));
+    gauge_animator_configure(animator, curve, duration_ms);
+    return 0;
+}
+
+void gauge_animator_free(gauge_animator_t *animator) {
+    if (!animator) return;
+
+    free(animator->node);
+    free(animator->value);
+    free(animator->target);
+    free(animator->velocity);
+    free(animator->start);
+    free(animator->progress);
+    free(animator->rate);
+    free(animator->tolerance);
+    free(animator->lane_of);
+
+    animation_curve_t curve = animator->curve;
+    float duration_s = animator->duration_s;
+    memset(animator, 0, sizeof(gauge_animator_t));
+    animator->curve = curve;
+    animator->duration_s = duration_s;
+}
+
+/**
+ * Choose the curve and duration; lanes in flight continue from where
+ * they are
+ */
+void gauge_animator_configure(gauge_animator_t *animator, animation_curve_t curve, uint32_t duration_ms) {
+    if (!animator) return;
+
+    float previous_s = animator->duration_s;
+    animator->curve = curve < ANIMATION_CURVE_COUNT ? curve : ANIMATION_SPRING;
+    animator->duration_s = (float)(duration_ms > 0 ? duration_ms : ANIMATION_DEFAULT_DURATION_MS) / 1000.0f;
+    for (uint32_t i = 0; i < animator->count; i++) {
+        animator->start[i] = animator->value[i];
+        animator->progress[i] = 0.0f;
+        animator->rate[i] *= previous_s / animator->duration_s;
+    }
+}
+
+/**
+ * Drop every lane and size the lane map for a tree of nodes nodes
+ */
+int gauge_animator_reset(gauge_animator_t *animator, int nodes) {
+    if (!animator) return -1;
+
+    animator->count = 0;
+    if (nodes > animator->node_capacity) {
+        int *lane_of = realloc(animator->lane_of, (size_t)nodes * sizeof(int));
+        if (!lane_of) return -1;
+        animator->lane_of = lane_of;
+        animator->node_capacity = nodes;
+    }
+    for (int i = 0; i < animator->node_capacity; i++) {
+        animator->lane_of[i] = -1;
+    }
+    return 0;
+}
+
+static bool gauge_animator_grow(gauge_animator_t *animator) {
+    uint32_t capacity = animator->capacity ? animator->capacity * 2 : ANIMATION_INITIAL_LANES;
+
+    int *node = realloc(animator->node, capacity * sizeof(int));
+    if (!node) return false;
+    animator->node = node;
+
+    float **lanes[] = {
+        &animator->value, &animator->target, &animator->velocity, &animator->start,
+        &animator->progress, &animator->rate, &animator->tolerance
+    };
+    for (size_t i = 0; i < sizeof(lanes) / sizeof(lanes[0]); i++) {
+        float *grown = realloc(*lanes[i], capacity * sizeof(float));
+        if (!grown) return false;
+        *lanes[i] = grown;
+    }
+
+    animator->capacity = capacity;
+    return true;
+}
+
+/**
+ * Send tree node towards target, starting at value if it is not moving
+ *
+ * range is the gauge's span, for the settle tolerance, and speed its
+ * animation_speed. Returns false when no lane is available; the caller
+ * should then jump to the target.
+ */
+bool gauge_animator_retarget(gauge_animator_t *animator, int node, float value, float target,
+                             float range, float speed) {
+    if (!animator || node < 0 || node >= animator->node_capacity) return false;
+
+    int lane = animator->lane_of[node];
+    if (lane >= 0) {
+        if (animator->target[lane] == target) return true;
+    } else {
+        if (value == target) return true;
+        if (animator->count == animator->capacity && !gauge_animator_grow(animator)) return false;
+
+        lane = (int)animator->count++;
+        animator->lane_of[node] = lane;
+        animator->node[lane] = node;
+        animator->value[lane] = value;
+        animator->velocity[lane] = 0.0f;
+        animator->tolerance[lane] = fabsf(range) * ANIMATION_SETTLE_FRACTION;
+    }
+
+    animator->target[lane] = target;
+    animator->start[lane] = animator->value[lane];
+    animator->progress[lane] = 0.0f;
+    animator->rate[lane] = (speed > 0.0f ? speed : 1.0f) / animator->duration_s;
+    return true;
+}
+
+static float animation_ease(animation_curve_t curve, float p) {
+    switch (curve) {
+        case ANIMATION_EASE_OUT: {
+            float q = 1.0f - p;
+            return 1.0f - q * q * q;
+        }
+        case ANIMATION_EASE_IN_OUT: {
+            if (p < 0.5f) return 4.0f * p * p * p;
+            float q = 2.0f - 2.0f * p;
+            return 1.0f - 0.5f * q * q * q;
+        }
+        default:
+            return p;
+    }
+}
+
+/* Within tolerance and, for the spring, nearly at rest */
+static bool gauge_lane_arrived(const gauge_animator_t *animator, uint32_t lane) {
+    if (animator->curve != ANIMATION_SPRING) {
+        return animator->progress[lane] >= 1.0f;
+    }
+    float tolerance = animator->tolerance[lane];
+    return fabsf(animator->value[lane] - animator->target[lane]) <= tolerance &&
+           fabsf(animator->velocity[lane]) <= tolerance * ANIMATION_SPRING_OMEGA * animator->rate[lane];
+}
+
+static void gauge_animator_remove(gauge_animator_t *animator, uint32_t lane) {
+    uint32_t last = --animator->count;
+    animator->lane_of[animator->node[lane]] = -1;
+    if (lane == last) return;
+
+    animator->node[lane] = animator->node[last];
+    animator->value[lane] = animator->value[last];
+    animator->target[lane] = animator->target[last];
+    animator->velocity[lane] = animator->velocity[last];
+    animator->start[lane] = animator->start[last];
+    animator->progress[lane] = animator->progress[last];
+    animator->rate[lane] = animator->rate[last];
+    animator->tolerance[lane] = animator->tolerance[last];
+    animator->lane_of[animator->node[lane]] = (int)lane;
+}
+
+/**
+ * Advance every lane by delta_time seconds
+ *
+ * New values are written to the gauges in tree (may be NULL). Returns
+ * the number of animations still running.
+ */
+uint32_t gauge_animator_step(gauge_animator_t *animator, float delta_time, widget_tree_t *tree) {
+    if (!animator || animator->count == 0) return 0;
+
+    uint32_t count = animator->count;
+    uint32_t arrived = 0;
+    float dt = delta_time > 0.0f ? delta_time : 0.0f;
+
+    if (animator->curve == ANIMATION_SPRING) {
+        float *restrict value = animator->value;
+        float *restrict velocity = animator->velocity;
+        const float *restrict target = animator->target;
+        const float *restrict rate = animator->rate;
+        const float *restrict tolerance = animator->tolerance;
+        /* Gauges at the same speed share their decay; one expf() each */
+        float lane_rate = -1.0f, omega = 0.0f, decay = 1.0f;
+        for (uint32_t i = 0; i < count; i++) {
+            if (rate[i] != lane_rate) {
+                lane_rate = rate[i];
+                omega = ANIMATION_SPRING_OMEGA * lane_rate;
+                decay = expf(-omega * dt);
+            }
+            float x = value[i] - target[i];
+            float drive = (velocity[i] + omega * x) * dt;
+            value[i] = target[i] + (x + drive) * decay;
+            velocity[i] = (velocity[i] - omega * drive) * decay;
+            arrived += (fabsf(value[i] - target[i]) <= tolerance[i]) &
+                       (fabsf(velocity[i]) <= tolerance[i] * ANIMATION_SPRING_OMEGA * rate[i]);
+        }
+    } else {
+        float *restrict value = animator->value;
+        float *restrict progress = animator->progress;
+        const float *restrict start = animator->start;
+        const float *restrict target = animator->target;
+        const float *restrict rate = animator->rate;
+        for (uint32_t i = 0; i < count; i++) {
+            float p = fminf(progress[i] + rate[i] * dt, 1.0f);
+            progress[i] = p;
+            value[i] = start[i] + (target[i] - start[i]) * animation_ease(animator->curve, p);
+            arrived += p >= 1.0f;
+        }
+    }
+
+    animator->steps++;
+    animator->lane_steps += count;
+
+    if (tree) {
+        const int *node = animator->node;
+        const float *value = animator->value;
+        widget_node_t *nodes = tree->nodes;
+        for (uint32_t i = 0; i < count; i++) {
+            nodes[node[i]].data.gauge.current_value = value[i];
+        }
+    }
+
+    /* Snap lanes that have arrived to their targets and drop them */
+    for (uint32_t i = 0; arrived > 0 && i < animator->count;) {
+        if (!gauge_lane_arrived(animator, i)) {
+            i++;
+            continue;
+        }
+        if (tree) {
+            tree->nodes[animator->node[i]].data.gauge.current_value = animator->target[i];
+        }
+        animator->settled++;
+        arrived--;
+        gauge_animator_remove(animator, i);
+    }
+    return animator->count;
+}
+
+/**
+ * Jump every animation to its target
+ */
+void gauge_animator_finish(gauge_animator_t *animator, widget_tree_t *tree) {
+    if (!animator) return;
+
+    for (uint32_t i = 0; i < animator->count; i++) {
+        if (tree) {
+            tree->nodes[animator->node[i]].data.gauge.current_value = animator->target[i];
+        }
+        animator->lane_of[animator->node[i]] = -1;
+    }
+    animator->count = 0;
+}
+
+/**
+ * Whether every gauge has reached its target
+ */
+bool gauge_animator_settled(const gauge_animator_t *animator) {
+    return !animator || animator->count == 0;
+}
+
+animation_curve_t animation_curve_from_string(const char *name, animation_curve_t fallback) {
+    if (!name) return fallback;
+    for (int curve = 0; curve < ANIMATION_CURVE_COUNT; curve++) {
+        if (strcmp(name, g_animation_curve_names[curve]) == 0) return (animation_curve_t)curve;
+    }
+    return fallback;
+}
+
+const char *animation_curve_to_string(animation_curve_t curve) {
+    return curve < ANIMATION_CURVE_COUNT ? g_animation_curve_names[curve] : "unknown";
+}
+
+void gauge_animator_print_statistics(const gauge_animator_t *animator) {
+    if (!animator) return;
+
+    printf("=== Gauge Animator ===\n");
+    printf("Curve: %s, %.0f ms\n", animation_curve_to_string(animator->curve),
+           animator->duration_s * 1000.0f);
+    printf("Steps: %llu, %.2f gauges moving per step, %llu animations settled\n",
+           (unsigned long long)animator->steps,
+           animator->steps ? (double)animator->lane_steps / animator->steps : 0.0,
+           (unsigned long long)animator->settled);
+}
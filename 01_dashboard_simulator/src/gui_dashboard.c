@@ -3,10 +3,13 @@
 #include <unistd.h>
 #include <sys/time.h>
 #include <pthread.h>
+#include <errno.h>
 #include <math.h>
 #include <string.h>
 #include <termios.h>
 #include <fcntl.h>
+#include <poll.h>
+#include "../include/term_grid.h"
 
 // Simple GUI Dashboard Simulator for QNX
 // Uses ANSI escape codes for colorful GUI-like display
@@ -32,6 +35,13 @@ typedef struct {
 // Global context
 static dashboard_context_t g_ctx = {0};
 
+// Input loop state: self-pipe wakes poll() on shutdown, terminal set up once
+static int g_wake_pipe[2] = {-1, -1};
+static struct termios g_saved_termios;
+static int g_termios_saved = 0;
+static int g_stdin_open = 1;
+static unsigned long g_input_wakeups = 0;
+
 // ANSI Color codes for GUI
 #define RESET       "\033[0m"
 #define BLACK       "\033[30m"
@@ -81,114 +91,206 @@ void simulate_vehicle_data(vehicle_data_t* data) {
     gettimeofday(&data->timestamp, NULL);
 }
 
-// Create a circular gauge using ASCII
-void draw_circular_gauge(float value, float max_val, const char* color, const char* label) {
-    int segments = 20;
-    int filled = (int)((value / max_val) * segments);
-    
-    printf("%s%s%s: %6.1f ", color, BOLD, label, value);
-    printf("[");
-    for (int i = 0; i < segments; i++) {
-        if (i < filled) {
-            if (i < segments * 0.6) printf("%s●%s", GREEN, color);
-            else if (i < segments * 0.8) printf("%s●%s", YELLOW, color);
-            else printf("%s●%s", RED, color);
-        } else {
-            printf("○");
-        }
+// Dashboard layout (fits an 80x24 terminal)
+#define GUI_ROWS        24
+#define GUI_COLS        78
+
+// Gauge rows: "LABEL       : 123.4 [●●●...○○]"
+#define GAUGE_ROW       6
+#define GAUGE_LABEL_COL 2
+#define GAUGE_VALUE_COL 16
+#define GAUGE_BAR_COL   24
+#define GAUGE_SEGMENTS  20
+
+// Status and performance slots
+#define STATUS_ROW      13
+#define GEAR_COL        8
+#define FPS_COL         19
+#define TIME_COL        36
+#define WARNING_ROW     17
+#define PERF_ROW        21
+#define PERF_FPS_COL    16
+
+typedef struct {
+    const char* label;
+    float max_value;
+    int color;
+} gauge_layout_t;
+
+static const gauge_layout_t g_gauges[4] = {
+    { "SPEED (km/h)", 200.0f, TERM_CYAN },
+    { "RPM         ", 8000.0f, TERM_MAGENTA },
+    { "FUEL (%)    ", 100.0f, TERM_BLUE },
+    { "TEMP (°C)   ", 120.0f, TERM_RED }
+};
+
+// Cell grid: the static layout is drawn once, frames patch the slots and
+// the diff sends only the cells that changed
+static term_grid_t g_grid;
+static term_cell_t g_segment_lit[GAUGE_SEGMENTS];
+static term_cell_t g_segment_dark[4];
+static int g_shown_warnings = -1;
+static time_t g_shown_second = -1;
+
+// Box outline with a title in the top edge
+void draw_box(term_grid_t* grid, int top, int height, const char* title, uint16_t attr) {
+    int bottom = top + height - 1;
+    
+    int col = term_grid_put(grid, top, 0, attr, "┌─ ");
+    col = term_grid_put(grid, top, col, attr, title);
+    col = term_grid_put(grid, top, col, attr, " ");
+    term_grid_fill(grid, top, col, GUI_COLS - 1 - col, attr, "─");
+    term_grid_put(grid, top, GUI_COLS - 1, attr, "┐");
+    
+    for (int row = top + 1; row < bottom; row++) {
+        term_grid_put(grid, row, 0, TERM_ATTR_NORMAL, "│");
+        term_grid_put(grid, row, GUI_COLS - 1, TERM_ATTR_NORMAL, "│");
     }
-    printf("]%s\n", RESET);
+    
+    term_grid_put(grid, bottom, 0, TERM_ATTR_NORMAL, "└");
+    term_grid_fill(grid, bottom, 1, GUI_COLS - 2, TERM_ATTR_NORMAL, "─");
+    term_grid_put(grid, bottom, GUI_COLS - 1, TERM_ATTR_NORMAL, "┘");
 }
 
 // Draw warning indicator
-void draw_warning(int active, const char* symbol, const char* text, const char* color) {
+int draw_warning(term_grid_t* grid, int row, int col, int active, const char* symbol,
+                 const char* text, int color) {
+    col = term_grid_put(grid, row, col, TERM_ATTR_NORMAL, "  ");
     if (active) {
-        printf("  %s%s%s %s %s", BG_RED, WHITE, BOLD, symbol, text);
-        printf("%s", RESET);
+        uint16_t attr = TERM_ATTR(TERM_WHITE, TERM_RED, TERM_BOLD);
+        col = term_grid_put(grid, row, col, attr, " ");
+        col = term_grid_put(grid, row, col, attr, symbol);
+        col = term_grid_put(grid, row, col, attr, " ");
+        col = term_grid_put(grid, row, col, attr, text);
     } else {
-        printf("  %s○ %s%s", color, text, RESET);
+        uint16_t attr = TERM_ATTR(color, TERM_DEFAULT, 0);
+        col = term_grid_put(grid, row, col, attr, "○ ");
+        col = term_grid_put(grid, row, col, attr, text);
     }
+    return col;
 }
 
-// Display GUI dashboard
-void display_gui_dashboard(const vehicle_data_t* data, double fps) {
-    // Clear screen and position cursor
-    printf("\033[2J\033[H");
-    
-    // Title bar with colors
-    printf("%s%s%s", BG_BLUE, WHITE, BOLD);
-    printf("╔════════════════════════════════════════════════════════════════════════════╗\n");
-    printf("║                    🚗 QNX AUTOMOTIVE DASHBOARD v1.0 🚗                    ║\n");
-    printf("║                        Real-time GUI Simulation                           ║\n");
-    printf("╚════════════════════════════════════════════════════════════════════════════╝");
-    printf("%s\n\n", RESET);
-    
-    // Main dashboard display
-    printf("%s%s", CYAN, BOLD);
-    printf("┌─ PRIMARY INSTRUMENTS ──────────────────────────────────────────────────────┐\n");
-    printf("%s", RESET);
-    
-    // Speed gauge (large and prominent)
-    printf("│ ");
-    draw_circular_gauge(data->speed, 200.0, CYAN, "SPEED (km/h)");
+// Warning panel rows (redrawn only when the flags change)
+void draw_warnings(term_grid_t* grid, int warnings) {
+    for (int row = WARNING_ROW; row < WARNING_ROW + 2; row++) {
+        term_grid_fill(grid, row, 1, GUI_COLS - 2, TERM_ATTR_NORMAL, " ");
+    }
     
-    // RPM gauge  
-    printf("│ ");
-    draw_circular_gauge(data->rpm, 8000.0, MAGENTA, "RPM        ");
+    int col = draw_warning(grid, WARNING_ROW, 1, warnings & 0x01, "⛽", "LOW FUEL    ", TERM_YELLOW);
+    draw_warning(grid, WARNING_ROW, col, warnings & 0x02, "🌡️", "HIGH TEMP   ", TERM_RED);
+    col = draw_warning(grid, WARNING_ROW + 1, 1, warnings & 0x04, "⚡", "HIGH RPM    ", TERM_MAGENTA);
+    col = draw_warning(grid, WARNING_ROW + 1, col, warnings & 0x08, "🚨", "SPEED LIMIT ", TERM_RED);
     
-    // Fuel gauge
-    printf("│ ");
-    draw_circular_gauge(data->fuel_level, 100.0, BLUE, "FUEL (%)   ");
+    if (warnings == 0) {
+        term_grid_put(grid, WARNING_ROW + 1, col + 2, TERM_ATTR(TERM_GREEN, TERM_DEFAULT, TERM_BOLD),
+                      "✅ ALL SYSTEMS NORMAL");
+    }
+}
+
+// Static layout: everything except the value slots
+void build_dashboard_layout(term_grid_t* grid) {
+    uint16_t title = TERM_ATTR(TERM_WHITE, TERM_BLUE, TERM_BOLD);
+    uint16_t white = TERM_ATTR(TERM_WHITE, TERM_DEFAULT, TERM_BOLD);
+    uint16_t green = TERM_ATTR(TERM_GREEN, TERM_DEFAULT, TERM_BOLD);
     
-    // Temperature gauge
-    printf("│ ");
-    draw_circular_gauge(data->temperature, 120.0, RED, "TEMP (°C)  ");
+    term_grid_clear(grid, TERM_ATTR_NORMAL);
     
-    printf("└────────────────────────────────────────────────────────────────────────────┘\n\n");
+    // Title bar with colors
+    term_grid_put(grid, 0, 0, title, "╔");
+    term_grid_fill(grid, 0, 1, GUI_COLS - 2, title, "═");
+    term_grid_put(grid, 0, GUI_COLS - 1, title, "╗");
+    term_grid_fill(grid, 1, 0, GUI_COLS, title, " ");
+    term_grid_fill(grid, 2, 0, GUI_COLS, title, " ");
+    term_grid_put(grid, 1, 0, title, "║");
+    term_grid_put(grid, 1, 20, title, "🚗 QNX AUTOMOTIVE DASHBOARD v1.0 🚗");
+    term_grid_put(grid, 1, GUI_COLS - 1, title, "║");
+    term_grid_put(grid, 2, 0, title, "║");
+    term_grid_put(grid, 2, 25, title, "Real-time GUI Simulation");
+    term_grid_put(grid, 2, GUI_COLS - 1, title, "║");
+    term_grid_put(grid, 3, 0, title, "╚");
+    term_grid_fill(grid, 3, 1, GUI_COLS - 2, title, "═");
+    term_grid_put(grid, 3, GUI_COLS - 1, title, "╝");
+    
+    // Gauge labels and brackets; segments come in three colour zones
+    draw_box(grid, 5, 6, "PRIMARY INSTRUMENTS", TERM_ATTR(TERM_CYAN, TERM_DEFAULT, TERM_BOLD));
+    for (int g = 0; g < 4; g++) {
+        uint16_t attr = TERM_ATTR(g_gauges[g].color, TERM_DEFAULT, TERM_BOLD);
+        int col = term_grid_put(grid, GAUGE_ROW + g, GAUGE_LABEL_COL, attr, g_gauges[g].label);
+        term_grid_put(grid, GAUGE_ROW + g, col, attr, ": ");
+        term_grid_put(grid, GAUGE_ROW + g, GAUGE_BAR_COL - 2, attr, " [");
+        term_grid_put(grid, GAUGE_ROW + g, GAUGE_BAR_COL + GAUGE_SEGMENTS, attr, "]");
+        term_cell_make(&g_segment_dark[g], "○", attr);
+    }
+    for (int i = 0; i < GAUGE_SEGMENTS; i++) {
+        int zone = i < GAUGE_SEGMENTS * 0.6 ? TERM_GREEN : i < GAUGE_SEGMENTS * 0.8 ? TERM_YELLOW : TERM_RED;
+        term_cell_make(&g_segment_lit[i], "●", TERM_ATTR(zone, TERM_DEFAULT, TERM_BOLD));
+    }
     
     // Secondary information
-    printf("%s%s", GREEN, BOLD);
-    printf("┌─ VEHICLE STATUS ───────────────────────────────────────────────────────────┐\n");
-    printf("%s", RESET);
-    
-    printf("│ %sGEAR:%s %s%d%s     ", YELLOW, RESET, BOLD, data->gear, RESET);
-    printf("%sFPS:%s %s%.1f%s     ", CYAN, RESET, BOLD, fps, RESET);
-    
-    struct tm* timeinfo;
-    time_t t = data->timestamp.tv_sec;
-    timeinfo = localtime(&t);
-    printf("%sTIME:%s %s%02d:%02d:%02d%s\n", GREEN, RESET, BOLD, 
-           timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec, RESET);
-    
-    printf("└────────────────────────────────────────────────────────────────────────────┘\n\n");
+    draw_box(grid, 12, 3, "VEHICLE STATUS", green);
+    term_grid_put(grid, STATUS_ROW, 2, TERM_ATTR(TERM_YELLOW, TERM_DEFAULT, 0), "GEAR:");
+    term_grid_put(grid, STATUS_ROW, FPS_COL - 5, TERM_ATTR(TERM_CYAN, TERM_DEFAULT, 0), "FPS:");
+    term_grid_put(grid, STATUS_ROW, TIME_COL - 6, TERM_ATTR(TERM_GREEN, TERM_DEFAULT, 0), "TIME:");
+    term_grid_put(grid, STATUS_ROW, TIME_COL + 2, TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, TERM_BOLD), ":");
+    term_grid_put(grid, STATUS_ROW, TIME_COL + 5, TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, TERM_BOLD), ":");
     
     // Warning lights panel
-    printf("%s%s", RED, BOLD);
-    printf("┌─ WARNING SYSTEM ───────────────────────────────────────────────────────────┐\n");
-    printf("%s", RESET);
-    printf("│");
+    draw_box(grid, 16, 4, "WARNING SYSTEM", TERM_ATTR(TERM_RED, TERM_DEFAULT, TERM_BOLD));
+    g_shown_warnings = -1;
+    g_shown_second = -1;
     
-    draw_warning(data->warnings & 0x01, "⛽", "LOW FUEL    ", YELLOW);
-    draw_warning(data->warnings & 0x02, "🌡️", "HIGH TEMP   ", RED);
-    printf("\n│");
-    draw_warning(data->warnings & 0x04, "⚡", "HIGH RPM    ", MAGENTA);
-    draw_warning(data->warnings & 0x08, "🚨", "SPEED LIMIT ", RED);
+    // Performance information
+    int col = term_grid_put(grid, PERF_ROW, 0, white, "📊 PERFORMANCE: ");
+    col = term_grid_put(grid, PERF_ROW, PERF_FPS_COL + 4, green, " FPS");
+    col = term_grid_put(grid, PERF_ROW, col, white, " | 🧵 THREADS: ");
+    col = term_grid_put(grid, PERF_ROW, col, green, "Active");
+    col = term_grid_put(grid, PERF_ROW, col, white, " | 🎯 TARGET: ");
+    term_grid_put(grid, PERF_ROW, col, TERM_ATTR(TERM_YELLOW, TERM_DEFAULT, TERM_BOLD), "60 FPS");
+    
+    term_grid_put(grid, 23, 0, white, "[ESC] Exit | [SPACE] Pause | [R] Reset | QNX Dashboard Simulator");
+}
+
+// Display GUI dashboard: patch the value slots into the prebuilt layout
+void display_gui_dashboard(const vehicle_data_t* data, double fps) {
+    term_grid_t* grid = &g_grid;
+    uint16_t bold = TERM_ATTR(TERM_DEFAULT, TERM_DEFAULT, TERM_BOLD);
+    const float values[4] = { data->speed, data->rpm, data->fuel_level, data->temperature };
     
-    if (data->warnings == 0) {
-        printf("  %s%s✅ ALL SYSTEMS NORMAL%s", GREEN, BOLD, RESET);
+    for (int g = 0; g < 4; g++) {
+        int row = GAUGE_ROW + g;
+        int filled = (int)((values[g] / g_gauges[g].max_value) * GAUGE_SEGMENTS);
+        
+        term_grid_put_fixed(grid, row, GAUGE_VALUE_COL, 6, 1,
+                            TERM_ATTR(g_gauges[g].color, TERM_DEFAULT, TERM_BOLD), values[g]);
+        for (int i = 0; i < GAUGE_SEGMENTS; i++) {
+            term_grid_put_cell(grid, row, GAUGE_BAR_COL + i,
+                               i < filled ? &g_segment_lit[i] : &g_segment_dark[g]);
+        }
     }
     
-    printf("\n└────────────────────────────────────────────────────────────────────────────┘\n\n");
+    term_grid_put_uint(grid, STATUS_ROW, GEAR_COL, 1, bold, (unsigned)data->gear, false);
+    term_grid_put_fixed(grid, STATUS_ROW, FPS_COL, 5, 1, bold, (float)fps);
+    term_grid_put_fixed(grid, PERF_ROW, PERF_FPS_COL, 4, 1,
+                        TERM_ATTR(TERM_GREEN, TERM_DEFAULT, TERM_BOLD), (float)fps);
+    
+    if (data->timestamp.tv_sec != g_shown_second) {
+        struct tm timeinfo;
+        time_t t = data->timestamp.tv_sec;
+        localtime_r(&t, &timeinfo);
+        term_grid_put_uint(grid, STATUS_ROW, TIME_COL, 2, bold, (unsigned)timeinfo.tm_hour, true);
+        term_grid_put_uint(grid, STATUS_ROW, TIME_COL + 3, 2, bold, (unsigned)timeinfo.tm_min, true);
+        term_grid_put_uint(grid, STATUS_ROW, TIME_COL + 6, 2, bold, (unsigned)timeinfo.tm_sec, true);
+        g_shown_second = data->timestamp.tv_sec;
+    }
     
-    // Performance information
-    printf("%s%s", WHITE, BOLD);
-    printf("📊 PERFORMANCE: %s%.1f FPS%s | ", GREEN, fps, WHITE);
-    printf("🧵 THREADS: %sActive%s | ", GREEN, WHITE);
-    printf("⚡ REAL-TIME: %sQNX Neutrino%s | ", CYAN, WHITE);
-    printf("🎯 TARGET: %s60 FPS%s\n", YELLOW, RESET);
-    
-    printf("\n%s%s[ESC] Exit | [SPACE] Pause | [R] Reset | QNX Dashboard Simulator%s\n", 
-           WHITE, BOLD, RESET);
+    if (data->warnings != g_shown_warnings) {
+        draw_warnings(grid, data->warnings);
+        g_shown_warnings = data->warnings;
+    }
+    
+    // Messages printed so far must land before this frame
+    fflush(stdout);
+    term_grid_flush(grid, STDOUT_FILENO);
 }
 
 // Data simulation thread
@@ -249,32 +351,85 @@ void* gui_thread(void* arg) {
 void signal_handler(int sig) {
     printf("\n🛑 Received signal %d, shutting down GUI dashboard...\n", sig);
     g_ctx.running = 0;
+    if (g_wake_pipe[1] >= 0) {
+        char wake = 1;
+        ssize_t unused = write(g_wake_pipe[1], &wake, 1);
+        (void)unused;
+    }
 }
 
-// Check for keyboard input (non-blocking)
-int kbhit() {
-    struct termios oldt, newt;
-    int ch;
-    int oldf;
+// Switch the terminal to unbuffered, no-echo input for the whole session
+void terminal_enter_raw_mode(void) {
+    struct termios raw;
 
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
+    if (tcgetattr(STDIN_FILENO, &g_saved_termios) != 0) return;
+    raw = g_saved_termios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+    g_termios_saved = 1;
+}
 
-    ch = getchar();
+void terminal_restore_mode(void) {
+    if (g_termios_saved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &g_saved_termios);
+        g_termios_saved = 0;
+    }
+}
 
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
+// Sleep until a key arrives or shutdown is signalled (returns key or -1)
+int wait_for_key(void) {
+    struct pollfd fds[2];
+    int nfds = 0;
 
-    if(ch != EOF) {
-        ungetc(ch, stdin);
-        return 1;
+    fds[nfds].fd = g_wake_pipe[0];
+    fds[nfds].events = POLLIN;
+    nfds++;
+    if (g_stdin_open) {
+        fds[nfds].fd = STDIN_FILENO;
+        fds[nfds].events = POLLIN;
+        nfds++;
     }
 
-    return 0;
+    int ready = poll(fds, nfds, -1);
+    g_input_wakeups++;
+    if (ready <= 0 || (fds[0].revents & POLLIN)) {
+        return -1;
+    }
+
+    if (nfds > 1 && fds[1].revents) {
+        unsigned char ch;
+        if (read(STDIN_FILENO, &ch, 1) == 1) {
+            return ch;
+        }
+        g_stdin_open = 0; // EOF: keep waiting for the shutdown signal only
+    }
+    return -1;
+}
+
+// Create a thread with an explicit real-time policy. Attributes are ignored
+// unless inheritsched is EXPLICIT; without the privilege for real-time
+// scheduling fall back to the default attributes instead of failing.
+int create_rt_thread(pthread_t* tid, int policy, int priority,
+                     void* (*start_routine)(void*), void* arg) {
+    pthread_attr_t attr;
+    struct sched_param param;
+    int result;
+    
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, policy);
+    param.sched_priority = priority;
+    pthread_attr_setschedparam(&attr, &param);
+    
+    result = pthread_create(tid, &attr, start_routine, arg);
+    if (result == EPERM) {
+        printf("⚠️  No permission for real-time priority %d, using default scheduling\n", priority);
+        result = pthread_create(tid, NULL, start_routine, arg);
+    }
+    pthread_attr_destroy(&attr);
+    return result;
 }
 
 int main() {
@@ -297,34 +452,33 @@ int main() {
     g_ctx.fps = 0.0;
     pthread_mutex_init(&g_ctx.mutex, NULL);
     
+    if (term_grid_init(&g_grid, GUI_ROWS, GUI_COLS) != 0) {
+        fprintf(stderr, "Failed to allocate the screen grid\n");
+        return 1;
+    }
+    build_dashboard_layout(&g_grid);
+    
+    // Wake pipe must exist before the signal handler can use it
+    if (pipe(g_wake_pipe) != 0) {
+        perror("Failed to create wake pipe");
+        return 1;
+    }
+    
     // Set up signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
     
     // Create threads with QNX real-time priorities
-    pthread_attr_t attr;
-    struct sched_param param;
-    
     printf("🧵 Creating data simulation thread...\n");
     // Data thread (medium priority)
-    pthread_attr_init(&attr);
-    pthread_attr_setschedpolicy(&attr, SCHED_RR);
-    param.sched_priority = 50;
-    pthread_attr_setschedparam(&attr, &param);
-    
-    if (pthread_create(&data_tid, &attr, data_thread, &g_ctx) != 0) {
+    if (create_rt_thread(&data_tid, SCHED_RR, 50, data_thread, &g_ctx) != 0) {
         perror("Failed to create data thread");
         return 1;
     }
     
     printf("🎨 Creating GUI rendering thread...\n");
     // GUI thread (high priority)
-    pthread_attr_init(&attr);
-    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
-    param.sched_priority = 63;
-    pthread_attr_setschedparam(&attr, &param);
-    
-    if (pthread_create(&gui_tid, &attr, gui_thread, &g_ctx) != 0) {
+    if (create_rt_thread(&gui_tid, SCHED_FIFO, 63, gui_thread, &g_ctx) != 0) {
         perror("Failed to create GUI thread");
         return 1;
     }
@@ -333,31 +487,50 @@ int main() {
     printf("🎬 Starting GUI dashboard simulation...\n\n");
     sleep(2);
     
-    // Main thread handles input (simple)
+    // Main thread handles input, sleeping in poll() until a key or signal
+    struct timespec loop_start, loop_end, cpu_start, cpu_end;
+    clock_gettime(CLOCK_MONOTONIC, &loop_start);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+    terminal_enter_raw_mode();
+    
+    int paused = 0;
     while (g_ctx.running) {
-        if (kbhit()) {
-            int ch = getchar();
-            if (ch == 27) { // ESC key
-                printf("\n🛑 ESC pressed, shutting down...\n");
-                g_ctx.running = 0;
-                break;
-            } else if (ch == ' ') { // Space key
-                printf("\n⏸️  Paused - press any key to continue...\n");
-                getchar();
-            } else if (ch == 'r' || ch == 'R') { // Reset
-                printf("\n🔄 Resetting dashboard...\n");
-                g_ctx.frame_count = 0;
-            }
+        int ch = wait_for_key();
+        if (ch < 0) continue;
+        
+        if (paused) { // Any key continues
+            paused = 0;
+        } else if (ch == 27) { // ESC key
+            printf("\n🛑 ESC pressed, shutting down...\n");
+            g_ctx.running = 0;
+            break;
+        } else if (ch == ' ') { // Space key
+            printf("\n⏸️  Paused - press any key to continue...\n");
+            paused = 1;
+        } else if (ch == 'r' || ch == 'R') { // Reset
+            printf("\n🔄 Resetting dashboard...\n");
+            g_ctx.frame_count = 0;
         }
-        usleep(50000); // 50ms
     }
     
+    terminal_restore_mode();
+    clock_gettime(CLOCK_MONOTONIC, &loop_end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+    double loop_seconds = (loop_end.tv_sec - loop_start.tv_sec) +
+                          (loop_end.tv_nsec - loop_start.tv_nsec) / 1000000000.0;
+    double cpu_seconds = (cpu_end.tv_sec - cpu_start.tv_sec) +
+                         (cpu_end.tv_nsec - cpu_start.tv_nsec) / 1000000000.0;
+    
     // Wait for threads to complete
     pthread_join(data_tid, NULL);
     pthread_join(gui_tid, NULL);
     
     // Cleanup
     pthread_mutex_destroy(&g_ctx.mutex);
+    term_grid_print_statistics(&g_grid);
+    term_grid_free(&g_grid);
+    close(g_wake_pipe[0]);
+    close(g_wake_pipe[1]);
     
     printf("\n%s%s", GREEN, BOLD);
     printf("✅ GUI Dashboard Simulator Stopped Successfully\n");
@@ -368,6 +541,9 @@ int main() {
     printf("   • Colorful GUI with ANSI graphics ✓\n");
     printf("   • Automotive data simulation ✓\n");
     printf("   • Performance monitoring (%.1f FPS) ✓\n", g_ctx.fps);
+    printf("   • Event-driven input (%.2f wakeups/s, %.3f%% CPU) ✓\n",
+           loop_seconds > 0 ? g_input_wakeups / loop_seconds : 0.0,
+           loop_seconds > 0 ? cpu_seconds * 100.0 / loop_seconds : 0.0);
     printf("   • Signal handling and clean shutdown ✓\n");
     printf("%s\n", RESET);
     
@@ -1,21 +1,81 @@
 /**
  * QNX Dashboard Simulator - GUI Manager Implementation
+ *
+ * Every frame is rasterized into a software framebuffer and presented to
+ * memory, a file or /dev/fb0, so rendering runs (and can be profiled) on
+ * any POSIX system. Photon is only used for the window when the build
+ * defines USE_PHOTON: presenting a frame damages the matching areas of the
+ * PtRaw canvas, and its draw function copies them from the framebuffer.
+ *
+ * Widgets live in a retained tree (see widget_tree.c), built in from the
+ * classic four-gauge layout or loaded from a layout file. An update visits
+ * only the widgets bound to signals that changed, plus those still
+ * animating or blinking, compares them with what is on screen and records
+ * the changed areas as dirty rectangles; render then repaints the scene
+ * clipped to those rectangles only, skipping subtrees outside the clip,
+ * and presents only them. A steady needle costs nothing, however many
+ * widgets the layout has.
+ *
+ * Moving dials and bars are advanced together by the gauge animator (see
+ * gauge_animator.c) by the measured frame interval; once it has settled
+ * and no lamp blinks, an update finds nothing to do.
+ *
+ * Dial faces are static, so each is rendered once per theme into its own
+ * surface.
+ *
+ * Large damage (a full frame, a theme change) is cut into screen tiles that
+ * the render pool draws in parallel; the pass returns only when every tile
+ * is done, so present always sees a complete frame.
  */
 
 #include "../include/gui_manager.h"
+#include "../include/framebuffer.h"
+#include "../include/gauge_animator.h"
+#include "../include/render_pool.h"
+#include "../include/widget_tree.h"
 
-/* Color definitions */
-static const PgColor_t COLORS[] = {
-    0x000000, /* Black */
-    0xFFFFFF, /* White */
-    0x0080FF, /* Blue */
-    0xFF4000, /* Red */
-    0x00C000, /* Green */
-    0xFFFF00, /* Yellow */
-    0xFF0000, /* Critical Red */
-    0x808080  /* Gray */
+/* Gauge geometry, as fractions of the gauge radius */
+#define GAUGE_START_ANGLE_DEG     225.0f  /* Minimum value, lower left */
+#define GAUGE_SWEEP_DEG           270.0f  /* Clockwise to lower right */
+#define GAUGE_BEZEL_WIDTH         0.03f
+#define GAUGE_ZONE_OUTER          0.92f
+#define GAUGE_ZONE_INNER          0.84f
+#define GAUGE_TICK_OUTER          0.82f
+#define GAUGE_TICK_INNER          0.70f
+#define GAUGE_NEEDLE_LENGTH       0.78f
+#define GAUGE_HUB_RADIUS          0.08f
+#define GAUGE_MAJOR_TICKS         10
+#define GAUGE_DEG_TO_RAD          0.01745329252f
+#define GUI_READOUT_SCALE         3       /* Font scale of the digital readouts */
+#define GUI_SINE_TABLE_SIZE       1024    /* Entries per turn, a power of two */
+
+/**
+ * Theme palette; one 0xRRGGBB colour per theme in gui_theme_t order
+ */
+typedef struct {
+    const char *element;
+    PgColor_t colors[THEME_COUNT];
+} gui_theme_color_t;
+
+static const gui_theme_color_t THEME_COLORS[] = {
+    /*                 DAY       NIGHT     AUTOMOTIVE HIGH_CONTRAST */
+    { "background", { 0xE8E8E8, 0x000000, 0x101418, 0x000000 } },
+    { "face",       { 0xFFFFFF, 0x101010, 0x1C2228, 0x000000 } },
+    { "bezel",      { 0x808080, 0x303030, 0x3A4450, 0xFFFFFF } },
+    { "tick",       { 0x202020, 0x909090, 0xD0D0D0, 0xFFFFFF } },
+    { "text",       { 0x000000, 0xB0B0B0, 0xFFFFFF, 0xFFFFFF } },
+    { "display",    { 0x000000, 0x80C0FF, 0x00E0FF, 0xFFFFFF } },
+    { "needle",     { 0xFF4000, 0xFF4000, 0xFF4000, 0xFFFF00 } },
+    { "hub",        { 0x404040, 0x202020, 0x808080, 0xFFFFFF } },
+    { "normal",     { 0x00C000, 0x008000, 0x0080FF, 0x00FF00 } },
+    { "warning",    { 0xFFC000, 0xC09000, 0xFFFF00, 0xFFFF00 } },
+    { "critical",   { 0xFF0000, 0xC00000, 0xFF0000, 0xFF0000 } },
+    { "light_off",  { 0xC0C0C0, 0x202020, 0x303840, 0x404040 } },
+    { "light_text", { 0x000000, 0x000000, 0x000000, 0x000000 } },
 };
 
+#define THEME_COLOR_COUNT  (sizeof(THEME_COLORS) / sizeof(THEME_COLORS[0]))
+
 /**
  * Initialize GUI manager
  */
@@ -25,27 +85,55 @@ int gui_manager_initialize(gui_manager_t *gui) {
     printf("Initializing GUI manager...\n");
     
     memset(gui, 0, sizeof(gui_manager_t));
-    
+
+#ifdef USE_PHOTON
     /* Initialize Photon */
     if (PtInit(NULL) == -1) {
         fprintf(stderr, "Error: Failed to initialize Photon\n");
         return -1;
     }
+#endif
     
     gui->current_theme = THEME_AUTOMOTIVE;
     gui->fullscreen = false;
+    gui->brightness = 1.0f;
     gui->needs_redraw = true;
+    gui->input_fd = -1;
+    gui->animations_enabled = true;
+    gui->visual_epsilon_px = GUI_VISUAL_EPSILON_PX;
+    widget_tree_init(&gui->widgets);
+    gauge_animator_init(&gui->animator, ANIMATION_SPRING, ANIMATION_DEFAULT_DURATION_MS);
+    
+    /* Frames stay in memory until an output is selected */
+    if (framebuffer_init(&gui->framebuffer, WINDOW_WIDTH, WINDOW_HEIGHT) != 0) {
+        fprintf(stderr, "Error: Failed to allocate framebuffer\n");
+        return -1;
+    }
+    
+    /* Rendering stays on the calling thread until workers are requested */
+    render_pool_init(&gui->render_pool, 1, NULL);
     
     if (gui_manager_create_window(gui) != 0) {
         fprintf(stderr, "Error: Failed to create main window\n");
+        framebuffer_free(&gui->framebuffer);
         return -1;
     }
     
-    if (gui_manager_create_widgets(gui) != 0) {
+    if (gui_manager_create_widgets(gui) != 0 ||
+        gauge_animator_reset(&gui->animator, gui->widgets.count) != 0) {
         fprintf(stderr, "Error: Failed to create widgets\n");
+        gauge_animator_free(&gui->animator);
+        widget_tree_free(&gui->widgets);
+        framebuffer_free(&gui->framebuffer);
         return -1;
     }
     
+    gui_apply_theme_colors(gui);
+    
+    /* First frame paints everything and records what is on screen */
+    gui->full_redraw = true;
+    gui_manager_collect_damage(gui);
+    
     gui->initialized = true;
     printf("GUI manager initialized successfully\n");
     
@@ -56,11 +144,14 @@ int gui_manager_initialize(gui_manager_t *gui) {
  * Create main window
  */
 int gui_manager_create_window(gui_manager_t *gui) {
+    gui->window_size = (PhDim_t){WINDOW_WIDTH, WINDOW_HEIGHT};
+
+#ifdef USE_PHOTON
     PtArg_t args[5];
     int n = 0;
     
     PtSetArg(&args[n++], Pt_ARG_WINDOW_TITLE, WINDOW_TITLE, 0);
-    PtSetArg(&args[n++], Pt_ARG_DIM, &(PhDim_t){WINDOW_WIDTH, WINDOW_HEIGHT}, 0);
+    PtSetArg(&args[n++], Pt_ARG_DIM, &gui->window_size, 0);
     
     gui->main_window = PtCreateWidget(PtWindow, Pt_NO_PARENT, n, args);
     if (!gui->main_window) {
@@ -68,10 +159,12 @@ int gui_manager_create_window(gui_manager_t *gui) {
         return -1;
     }
     
-    /* Create canvas */
+    /* Create canvas; its draw function blits the software framebuffer */
     n = 0;
     PhDim_t canvas_size = {WINDOW_WIDTH, WINDOW_HEIGHT};
     PtSetArg(&args[n++], Pt_ARG_DIM, &canvas_size, 0);
+    PtSetArg(&args[n++], Pt_ARG_RAW_DRAW_F, gui_canvas_draw, 0);
+    PtSetArg(&args[n++], Pt_ARG_USER_DATA, &gui, sizeof(gui));
     
     gui->canvas = PtCreateWidget(PtRaw, gui->main_window, n, args);
     if (!gui->canvas) {
@@ -79,45 +172,178 @@ int gui_manager_create_window(gui_manager_t *gui) {
         return -1;
     }
     
-    PtAddCallback(gui->main_window, Pt_CB_WINDOW_OPENING, 
+    PtAddCallback(gui->main_window, Pt_CB_WINDOW_CLOSING,
                   gui_window_close_callback, gui);
     
     PtRealizeWidget(gui->main_window);
+#endif
     
     return 0;
 }
 
 /**
- * Create dashboard widgets
+ * Release the dial face caches
+ */
+static void gui_free_faces(gui_manager_t *gui) {
+    for (int i = 0; i < gui->widgets.count; i++) {
+        if (gui->widgets.nodes[i].kind == WIDGET_DIAL) {
+            framebuffer_free(&gui->widgets.nodes[i].data.gauge.face);
+        }
+    }
+    gui->faces_valid = false;
+}
+
+/**
+ * Add a dial bound to signal to the widget tree
+ */
+static int gui_add_dial(widget_tree_t *tree, signal_id_t signal, const char *label,
+                        float min_val, float max_val, float warning, float critical,
+                        framebuffer_rect_t box) {
+    int index = widget_tree_add(tree, -1, WIDGET_DIAL, box);
+    if (index < 0) return -1;
+    
+    widget_node_t *node = &tree->nodes[index];
+    gui_create_gauge_widget(&node->data.gauge, label, min_val, max_val,
+                           (PhPoint_t){box.x, box.y}, (PhDim_t){box.width, box.height});
+    node->data.gauge.warning_threshold = warning;
+    node->data.gauge.critical_threshold = critical;
+    node->signal = signal;
+    return index;
+}
+
+/**
+ * Add a warning light, lit when signal is above (or below) threshold
+ */
+static int gui_add_light(widget_tree_t *tree, int signal, const char *label, warning_type_t type,
+                         float threshold, bool below, framebuffer_rect_t box) {
+    int index = widget_tree_add(tree, -1, WIDGET_LIGHT, box);
+    if (index < 0) return -1;
+    
+    widget_node_t *node = &tree->nodes[index];
+    gui_create_warning_light(&node->data.light, label,
+                            (PhPoint_t){box.x, box.y}, (PhDim_t){box.width, box.height});
+    node->data.light.type = type;
+    node->data.light.level = WARNING_MEDIUM;
+    node->signal = signal;
+    node->threshold = threshold;
+    node->below = below;
+    return index;
+}
+
+/**
+ * Create dashboard widgets: the built-in classic layout
+ *
+ * Four dials and four warning lights for a WINDOW_WIDTH x WINDOW_HEIGHT
+ * screen; gui_manager_load_layout() replaces them with a layout file.
  */
 int gui_manager_create_widgets(gui_manager_t *gui) {
     printf("Creating dashboard widgets...\n");
     
-    /* Initialize gauges */
-    gui_create_gauge_widget(&gui->gauges[0], "SPEED", 0.0f, MAX_SPEED,
-                           (PhPoint_t){100, 100}, (PhDim_t){200, 200});
+    widget_tree_t *tree = &gui->widgets;
+    widget_tree_free(tree);
+    snprintf(tree->name, sizeof(tree->name), "classic");
+    tree->design_width = WINDOW_WIDTH;
+    tree->design_height = WINDOW_HEIGHT;
     
-    gui_create_gauge_widget(&gui->gauges[1], "RPM", 0.0f, MAX_RPM,
-                           (PhPoint_t){350, 100}, (PhDim_t){200, 200});
+    /* Low fuel is the bad end: critical below warning */
+    if (gui_add_dial(tree, SIGNAL_SPEED_KMH, "SPEED", 0.0f, MAX_SPEED,
+                     SAFETY_MAX_SPEED * 0.8f, SAFETY_MAX_SPEED, (framebuffer_rect_t){100, 100, 200, 200}) < 0 ||
+        gui_add_dial(tree, SIGNAL_RPM, "RPM", 0.0f, MAX_RPM,
+                     SAFETY_MAX_RPM - 1000.0f, SAFETY_MAX_RPM, (framebuffer_rect_t){350, 100, 200, 200}) < 0 ||
+        gui_add_dial(tree, SIGNAL_FUEL_LEVEL, "FUEL", 0.0f, MAX_FUEL_LEVEL,
+                     LOW_FUEL_WARNING * 2.0f, LOW_FUEL_WARNING, (framebuffer_rect_t){100, 350, 150, 150}) < 0 ||
+        gui_add_dial(tree, SIGNAL_ENGINE_TEMP, "TEMP", MIN_TEMPERATURE, MAX_TEMPERATURE,
+                     OVERHEAT_WARNING, OVERHEAT_WARNING + 10.0f, (framebuffer_rect_t){300, 350, 150, 150}) < 0) {
+        return -1;
+    }
     
-    gui_create_gauge_widget(&gui->gauges[2], "FUEL", 0.0f, MAX_FUEL_LEVEL,
-                           (PhPoint_t){100, 350}, (PhDim_t){150, 150});
+    /* Lamps in a 2 x 2 grid; nothing reports ABS faults yet */
+    if (gui_add_light(tree, SIGNAL_ENGINE_TEMP, "ENGINE", WARNING_ENGINE_TEMP, OVERHEAT_WARNING, false,
+                      (framebuffer_rect_t){600, 100, 100, 40}) < 0 ||
+        gui_add_light(tree, SIGNAL_OIL_PRESSURE, "OIL", WARNING_OIL_PRESSURE, 10.0f, true,
+                      (framebuffer_rect_t){720, 100, 100, 40}) < 0 ||
+        gui_add_light(tree, SIGNAL_BATTERY_VOLTAGE, "BATTERY", WARNING_BATTERY, 11.5f, true,
+                      (framebuffer_rect_t){600, 160, 100, 40}) < 0 ||
+        gui_add_light(tree, -1, "ABS", WARNING_ABS, 0.0f, false,
+                      (framebuffer_rect_t){720, 160, 100, 40}) < 0) {
+        return -1;
+    }
     
-    gui_create_gauge_widget(&gui->gauges[3], "TEMP", 0.0f, MAX_TEMP,
-                           (PhPoint_t){300, 350}, (PhDim_t){150, 150});
+    widget_tree_finalize(tree);
+    printf("Dashboard widgets created successfully\n");
+    return 0;
+}
+
+/**
+ * Replace the widgets with a layout file, scaled to the current screen
+ *
+ * The current layout stays when the file cannot be loaded.
+ */
+int gui_manager_load_layout(gui_manager_t *gui, const char *filename) {
+    if (!gui || !filename) return -1;
     
-    /* Initialize warning lights */
-    const char *labels[] = {"ENGINE", "OIL", "BATTERY", "ABS"};
-    for (int i = 0; i < 4; i++) {
-        PhPoint_t pos = {600 + (i % 2) * 100, 100 + (i / 2) * 60};
-        gui_create_warning_light(&gui->warnings[i], labels[i],
-                                pos, (PhDim_t){80, 40});
+    widget_tree_t tree;
+    widget_tree_init(&tree);
+    if (widget_tree_load(&tree, filename) != 0) {
+        return -1;
+    }
+    if (gauge_animator_reset(&gui->animator, tree.count) != 0) {
+        fprintf(stderr, "Error: Failed to allocate animations for %s\n", filename);
+        widget_tree_free(&tree);
+        return -1;
     }
     
-    printf("Dashboard widgets created successfully\n");
+    widget_tree_fit(&tree, gui->framebuffer.width, gui->framebuffer.height);
+    
+    gui_free_faces(gui);
+    widget_tree_free(&gui->widgets);
+    gui->widgets = tree;
+    gui_apply_theme_colors(gui);
+    
+    /* Rebuild faces and record the new scene */
+    gui->faces_valid = false;
+    gui_manager_collect_damage(gui);
     return 0;
 }
 
+/**
+ * Let gauges ease towards new values, or jump straight to them
+ */
+void gui_manager_set_animations(gui_manager_t *gui, bool enabled) {
+    if (!gui) return;
+    gui->animations_enabled = enabled;
+    if (!enabled) {
+        gauge_animator_finish(&gui->animator, &gui->widgets);
+    }
+}
+
+/**
+ * Curve and duration of gauge animations; each gauge's animation_speed
+ * divides the duration
+ */
+void gui_manager_set_animation_curve(gui_manager_t *gui, animation_curve_t curve, uint32_t duration_ms) {
+    if (!gui) return;
+    gauge_animator_configure(&gui->animator, curve, duration_ms);
+}
+
+/**
+ * Whether a gauge is still moving or a lamp blinking, so the next frame
+ * may differ from this one even if no signal changes
+ */
+bool gui_manager_animating(const gui_manager_t *gui) {
+    return gui && gui->widgets.active_count > 0;
+}
+
+/**
+ * Needle or bar travel, in pixels, below which a gauge is not redrawn
+ *
+ * 0 redraws every change that moves a pixel.
+ */
+void gui_manager_set_visual_epsilon(gui_manager_t *gui, float epsilon_px) {
+    if (!gui) return;
+    gui->visual_epsilon_px = epsilon_px > 0.0f ? epsilon_px : 0.0f;
+}
+
 /**
  * Create gauge widget
  */
@@ -129,10 +355,11 @@ int gui_create_gauge_widget(gauge_widget_t *gauge, const char *label,
     strncpy(gauge->label, label, sizeof(gauge->label) - 1);
     gauge->min_value = min_val;
     gauge->max_value = max_val;
-    gauge->current_value = 0.0f;
-    gauge->target_value = 0.0f;
+    gauge->current_value = min_val;
+    gauge->target_value = min_val;
     gauge->position = pos;
     gauge->size = size;
+    gauge->animation_speed = 1.0f;
     gauge->visible = true;
     gauge->enabled = true;
     
@@ -151,6 +378,8 @@ int gui_create_warning_light(warning_light_t *warning, const char *label,
     warning->blinking = false;
     warning->position = pos;
     warning->size = size;
+    warning->blink_interval_ms = 500;
+    warning->blink_state = true;
     
     return 0;
 }
@@ -161,23 +390,43 @@ int gui_create_warning_light(warning_light_t *warning, const char *label,
 void gui_manager_update(gui_manager_t *gui, const vehicle_data_t *data) {
     if (!gui || !data || !gui->initialized) return;
     
-    gui_update_gauge_value(&gui->gauges[0], data->speed_kmh);
-    gui_update_gauge_value(&gui->gauges[1], data->rpm);
-    gui_update_gauge_value(&gui->gauges[2], data->fuel_level);
-    gui_update_gauge_value(&gui->gauges[3], data->engine_temp);
+    /* New targets and lamp states for widgets bound to changed signals */
+    widget_tree_t *tree = &gui->widgets;
+    widget_tree_update(tree, data);
     
-    /* Update warnings */
-    gui_set_warning_state(&gui->warnings[0], data->engine_temp > 95.0f, false);
-    gui_set_warning_state(&gui->warnings[1], data->oil_pressure < 10.0f, false);
-    gui_set_warning_state(&gui->warnings[2], data->battery_voltage < 11.5f, false);
+    /* Animate gauges by the real frame interval (capped after a stall) */
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    float delta_time = 1.0f / GUI_UPDATE_RATE_HZ;
+    if (gui->last_update.tv_sec != 0 || gui->last_update.tv_nsec != 0) {
+        delta_time = clamp(timespec_diff_ms(&gui->last_update, &now) / 1000.0f,
+                           0.0f, GUI_MAX_ANIMATION_STEP_S);
+    }
+    gui->last_update = now;
     
-    /* Animate gauges */
-    float delta_time = 1.0f / 60.0f;
-    for (int i = 0; i < GAUGE_COUNT; i++) {
-        gui_animate_gauge(&gui->gauges[i], delta_time);
+    /* Only widgets that changed, or are still moving or blinking */
+    uint32_t now_ms = (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+    for (int i = 0; i < tree->active_count; i++) {
+        int index = tree->active[i];
+        widget_node_t *node = &tree->nodes[index];
+        if (node->kind == WIDGET_LIGHT) {
+            gui_update_warning_blink(&node->data.light, now_ms);
+        } else if (node->kind == WIDGET_DIAL || node->kind == WIDGET_BAR) {
+            gauge_widget_t *gauge = &node->data.gauge;
+            if (!gui->animations_enabled ||
+                !gauge_animator_retarget(&gui->animator, index, gauge->current_value, gauge->target_value,
+                                         gauge->max_value - gauge->min_value, gauge->animation_speed)) {
+                gauge->current_value = gauge->target_value;
+            }
+        } else if (node->kind == WIDGET_READOUT) {
+            node->data.gauge.current_value = node->data.gauge.target_value;
+        }
     }
     
-    gui->needs_redraw = true;
+    /* Every moving gauge in one pass */
+    gauge_animator_step(&gui->animator, delta_time, tree);
+    
+    gui_manager_collect_damage(gui);
 }
 
 /**
@@ -189,68 +438,1069 @@ void gui_update_gauge_value(gauge_widget_t *gauge, float value) {
 }
 
 /**
- * Animate gauge
+ * Set warning state
  */
-void gui_animate_gauge(gauge_widget_t *gauge, float delta_time) {
-    if (!gauge) return;
+void gui_set_warning_state(warning_light_t *warning, bool active, bool blinking) {
+    if (!warning) return;
+    warning->active = active;
+    warning->blinking = blinking;
+}
+
+/**
+ * Advance a blinking light's phase; steady lights stay lit
+ */
+void gui_update_warning_blink(warning_light_t *warning, uint32_t current_time) {
+    if (!warning) return;
     
-    float diff = gauge->target_value - gauge->current_value;
-    if (fabs(diff) > 0.1f) {
-        gauge->current_value += diff * 5.0f * delta_time;
-    } else {
-        gauge->current_value = gauge->target_value;
+    if (!warning->blinking) {
+        warning->blink_state = true;
+        return;
+    }
+    if (current_time - warning->last_blink_time >= warning->blink_interval_ms) {
+        warning->blink_state = !warning->blink_state;
+        warning->last_blink_time = current_time;
     }
 }
 
 /**
- * Set warning state
+ * Smallest rectangle covering a and b
  */
-void gui_set_warning_state(warning_light_t *warning, bool active, bool blinking) {
-    if (!warning) return;
-    warning->active = active;
-    warning->blinking = blinking;
+static framebuffer_rect_t gui_rect_union(framebuffer_rect_t a, framebuffer_rect_t b) {
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+    int y1 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+    return (framebuffer_rect_t){x0, y0, x1 - x0, y1 - y0};
+}
+
+/**
+ * Merging pays when the rectangles overlap or the union wastes little
+ */
+static bool gui_rect_should_merge(framebuffer_rect_t a, framebuffer_rect_t b) {
+    framebuffer_rect_t u = gui_rect_union(a, b);
+    return (long)u.width * u.height <= (long)a.width * a.height + (long)b.width * b.height;
+}
+
+static bool gui_rect_equal(framebuffer_rect_t a, framebuffer_rect_t b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
 }
 
+/**
+ * Add a damaged area, merging it with the rectangles it overlaps
+ */
+void gui_manager_add_damage(gui_manager_t *gui, framebuffer_rect_t rect) {
+    if (!gui) return;
+    
+    /* Clip to the screen */
+    int x1 = rect.x + rect.width;
+    int y1 = rect.y + rect.height;
+    if (rect.x < 0) rect.x = 0;
+    if (rect.y < 0) rect.y = 0;
+    if (x1 > gui->framebuffer.width) x1 = gui->framebuffer.width;
+    if (y1 > gui->framebuffer.height) y1 = gui->framebuffer.height;
+    rect.width = x1 - rect.x;
+    rect.height = y1 - rect.y;
+    if (rect.width <= 0 || rect.height <= 0) return;
+    
+    /* A merge can create new overlaps, so rescan after each one */
+    for (int i = 0; i < gui->dirty_count; i++) {
+        if (gui_rect_should_merge(gui->dirty[i], rect)) {
+            rect = gui_rect_union(gui->dirty[i], rect);
+            gui->dirty[i] = gui->dirty[--gui->dirty_count];
+            i = -1;
+        }
+    }
+    if (gui->dirty_count == GUI_MAX_DIRTY_RECTS) {
+        rect = gui_rect_union(gui->dirty[--gui->dirty_count], rect);
+    }
+    gui->dirty[gui->dirty_count++] = rect;
+    gui->needs_redraw = true;
+}
+
+/**
+ * Repaint everything on the next render
+ */
+void gui_manager_invalidate(gui_manager_t *gui) {
+    if (!gui) return;
+    gui->full_redraw = true;
+    gui->needs_redraw = true;
+}
+
+/**
+ * Dial radius in pixels
+ */
+static float gui_gauge_radius(const gauge_widget_t *gauge) {
+    return (float)(gauge->size.w < gauge->size.h ? gauge->size.w : gauge->size.h) * 0.5f;
+}
+
+/**
+ * Screen bounds of the needle and hub at value
+ *
+ * The hub is fixed, so equal bounds mean an identical needle.
+ */
+static framebuffer_rect_t gui_gauge_needle_rect(const gauge_widget_t *gauge, float value) {
+    float radius = gui_gauge_radius(gauge);
+    PhPoint_t center = {gauge->position.x + gauge->size.w / 2,
+                        gauge->position.y + gauge->size.h / 2};
+    PhPoint_t tip = gui_calculate_needle_position(value, gauge->min_value, gauge->max_value,
+                                                  center, (int)(radius * GAUGE_NEEDLE_LENGTH));
+    
+    /* Widest of hub and needle half-thickness, plus a pixel for rounding */
+    int margin = (int)ceilf(radius * GAUGE_HUB_RADIUS) + 3;
+    int x0 = (center.x < tip.x ? center.x : tip.x) - margin;
+    int y0 = (center.y < tip.y ? center.y : tip.y) - margin;
+    int x1 = (center.x > tip.x ? center.x : tip.x) + margin;
+    int y1 = (center.y > tip.y ? center.y : tip.y) + margin;
+    return (framebuffer_rect_t){x0, y0, x1 - x0, y1 - y0};
+}
+
+/**
+ * Where the digital readout of a gauge sits (centred, top edge)
+ */
+static PhPoint_t gui_gauge_readout_position(const gauge_widget_t *gauge) {
+    int radius = (gauge->size.w < gauge->size.h ? gauge->size.w : gauge->size.h) / 2;
+    return (PhPoint_t){gauge->position.x + gauge->size.w / 2,
+                       gauge->position.y + gauge->size.h / 2 + radius / 2};
+}
+
+static framebuffer_rect_t gui_gauge_readout_rect(const gauge_widget_t *gauge, const char *text) {
+    PhPoint_t pos = gui_gauge_readout_position(gauge);
+    int width = framebuffer_text_width(text, GUI_READOUT_SCALE);
+    return (framebuffer_rect_t){pos.x - width / 2, pos.y, width,
+                                FRAMEBUFFER_GLYPH_HEIGHT * GUI_READOUT_SCALE};
+}
+
+/**
+ * Zone of a value: 0 normal, 1 warning, 2 critical (as on the dial face)
+ */
+static int gui_value_zone(const gauge_widget_t *gauge, float value) {
+    float warning = gauge->warning_threshold;
+    float critical = gauge->critical_threshold;
+    
+    if (warning == 0.0f && critical == 0.0f) return 0;
+    if (critical >= warning) {
+        return value >= critical ? 2 : value >= warning ? 1 : 0;
+    }
+    return value <= critical ? 2 : value <= warning ? 1 : 0;
+}
+
+/**
+ * Filled part of a level bar at value
+ */
+static framebuffer_rect_t gui_bar_fill_rect(const gauge_widget_t *gauge, float value) {
+    float range = gauge->max_value - gauge->min_value;
+    float fraction = range > 0.0f ? clamp((value - gauge->min_value) / range, 0.0f, 1.0f) : 0.0f;
+    int track = gauge->size.w - 4;
+    return (framebuffer_rect_t){gauge->position.x + 2, gauge->position.y + 2,
+                                (int)lroundf(fraction * (track > 0 ? track : 0)), gauge->size.h - 4};
+}
+
+/**
+ * Text a readout shows for value
+ */
+static void gui_format_readout(const widget_node_t *node, float value, char *text, size_t size) {
+    if (node->format == WIDGET_FORMAT_GEAR) {
+        int gear = (int)lroundf(value);
+        if (gear < 0) {
+            snprintf(text, size, "R");
+        } else if (gear == 0) {
+            snprintf(text, size, "N");
+        } else {
+            snprintf(text, size, "%d", gear);
+        }
+        return;
+    }
+    snprintf(text, size, "%.*f%s", node->decimals, value, node->unit);
+}
+
+/**
+ * How far the needle tip or bar end moves between two values, in pixels
+ */
+static float gui_value_travel_px(const widget_node_t *node, float from, float to) {
+    const gauge_widget_t *gauge = &node->data.gauge;
+    float range = gauge->max_value - gauge->min_value;
+    if (range <= 0.0f) return 0.0f;
+    
+    float length = node->kind == WIDGET_DIAL ?
+        GAUGE_SWEEP_DEG * GAUGE_DEG_TO_RAD * gui_gauge_radius(gauge) * GAUGE_NEEDLE_LENGTH :
+        (float)(gauge->size.w - 4);
+    return fabsf(to - from) / range * length;
+}
+
+/**
+ * Compare one widget with what is on screen
+ *
+ * Records the new state as drawn and, when damage is set, marks the areas
+ * that differ. Needles are compared by their pixel bounds and text by its
+ * characters, so motion below one pixel or one displayed digit costs
+ * nothing. While a widget is still moving, a needle or bar that has
+ * travelled less than visual_epsilon_px since it was drawn is held where
+ * it is; the final sync of a settling widget (settled) ignores the
+ * epsilon so the resting value is always shown. Digits are never held:
+ * any change of the displayed text is redrawn.
+ */
+static void gui_sync_widget(gui_manager_t *gui, int index, bool damage, bool settled) {
+    widget_tree_t *tree = &gui->widgets;
+    widget_node_t *node = &tree->nodes[index];
+    
+    tree->nodes_refreshed++;
+    bool hold = damage && !settled &&
+                (node->kind == WIDGET_DIAL || node->kind == WIDGET_BAR) &&
+                gui_value_travel_px(node, node->data.gauge.drawn_value,
+                                    node->data.gauge.current_value) < gui->visual_epsilon_px;
+    
+    switch (node->kind) {
+        case WIDGET_DIAL: {
+            gauge_widget_t *gauge = &node->data.gauge;
+            if (!gauge->visible) break;
+            
+            char text[sizeof(gauge->drawn_text)];
+            snprintf(text, sizeof(text), "%.0f", gauge->current_value);
+            if (damage && strcmp(text, gauge->drawn_text) != 0) {
+                widget_tree_mark_dirty(tree, index, gui_gauge_readout_rect(gauge, gauge->drawn_text));
+                widget_tree_mark_dirty(tree, index, gui_gauge_readout_rect(gauge, text));
+            }
+            memcpy(gauge->drawn_text, text, sizeof(text));
+            if (hold) break;
+            
+            framebuffer_rect_t needle = gui_gauge_needle_rect(gauge, gauge->current_value);
+            if (damage && !gui_rect_equal(needle, gauge->drawn_needle)) {
+                widget_tree_mark_dirty(tree, index, gauge->drawn_needle);
+                widget_tree_mark_dirty(tree, index, needle);
+            }
+            gauge->drawn_value = gauge->current_value;
+            gauge->drawn_needle = needle;
+            break;
+        }
+        case WIDGET_BAR: {
+            gauge_widget_t *gauge = &node->data.gauge;
+            if (!gauge->visible || hold) break;
+            
+            framebuffer_rect_t fill = gui_bar_fill_rect(gauge, gauge->current_value);
+            if (damage && gui_value_zone(gauge, gauge->current_value) !=
+                          gui_value_zone(gauge, gauge->drawn_value)) {
+                widget_tree_mark_dirty(tree, index, node->box);
+            } else if (damage && fill.width != gauge->drawn_needle.width) {
+                /* Only the columns between the old and new ends */
+                int x0 = fill.x + (fill.width < gauge->drawn_needle.width ? fill.width : gauge->drawn_needle.width);
+                int x1 = fill.x + (fill.width > gauge->drawn_needle.width ? fill.width : gauge->drawn_needle.width);
+                widget_tree_mark_dirty(tree, index, (framebuffer_rect_t){x0, fill.y, x1 - x0, fill.height});
+            }
+            gauge->drawn_value = gauge->current_value;
+            gauge->drawn_needle = fill;
+            break;
+        }
+        case WIDGET_READOUT: {
+            gauge_widget_t *gauge = &node->data.gauge;
+            if (!gauge->visible) break;
+            
+            char text[sizeof(gauge->drawn_text)];
+            gui_format_readout(node, gauge->current_value, text, sizeof(text));
+            if (damage && strcmp(text, gauge->drawn_text) != 0) {
+                widget_tree_mark_dirty(tree, index, node->box);
+            }
+            gauge->drawn_value = gauge->current_value;
+            memcpy(gauge->drawn_text, text, sizeof(text));
+            break;
+        }
+        case WIDGET_LIGHT: {
+            warning_light_t *warning = &node->data.light;
+            bool lit = warning->active && warning->blink_state;
+            if (damage && lit != warning->drawn_lit) {
+                widget_tree_mark_dirty(tree, index, node->box);
+            }
+            warning->drawn_lit = lit;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * Whether a widget still needs a damage pass next frame
+ */
+static bool gui_widget_busy(const gui_manager_t *gui, int index) {
+    const widget_node_t *node = &gui->widgets.nodes[index];
+    if (node->kind == WIDGET_LIGHT) {
+        return node->data.light.active && node->data.light.blinking;
+    }
+    return node->kind != WIDGET_GROUP &&
+           ((index < gui->animator.node_capacity && gui->animator.lane_of[index] >= 0) ||
+            node->data.gauge.current_value != node->data.gauge.target_value);
+}
+
+static void gui_emit_damage(void *context, framebuffer_rect_t rect) {
+    gui_manager_add_damage((gui_manager_t *)context, rect);
+}
+
+/**
+ * Compare changed widgets with what is on screen and record the differences
+ *
+ * Only the active list is examined; widgets that have settled leave it.
+ * Their damage is merged into the dirty rectangles.
+ */
+void gui_manager_collect_damage(gui_manager_t *gui) {
+    if (!gui) return;
+    
+    widget_tree_t *tree = &gui->widgets;
+    if (!gui->faces_valid) {
+        gui->full_redraw = true;
+    }
+    
+    if (gui->full_redraw) {
+        /* Everything is repainted; only record what will be on screen */
+        for (int i = 0; i < tree->count; i++) {
+            gui_sync_widget(gui, i, false, true);
+        }
+    }
+    
+    int kept = 0;
+    for (int i = 0; i < tree->active_count; i++) {
+        int index = tree->active[i];
+        bool busy = gui_widget_busy(gui, index);
+        if (!gui->full_redraw) {
+            gui_sync_widget(gui, index, true, !busy);
+        }
+        if (busy) {
+            tree->active[kept++] = index;
+        } else {
+            tree->nodes[index].active = false;
+        }
+    }
+    tree->active_count = kept;
+    
+    widget_tree_collect_damage(tree, gui->full_redraw ? NULL : gui_emit_damage, gui);
+    
+    if (gui->full_redraw) {
+        gui->needs_redraw = true;
+    }
+}
+
+/**
+ * Colour behind a widget: its nearest panel, or the screen background
+ */
+static uint32_t gui_backdrop_color(const gui_manager_t *gui, int index) {
+    const widget_tree_t *tree = &gui->widgets;
+    for (int p = tree->nodes[index].parent; p >= 0; p = tree->nodes[p].parent) {
+        if (tree->nodes[p].panel) {
+            return FRAMEBUFFER_OPAQUE(gui_get_theme_color(gui->current_theme, "face"));
+        }
+    }
+    return FRAMEBUFFER_OPAQUE(gui_get_theme_color(gui->current_theme, "background"));
+}
+
+/**
+ * Render each dial's static face into its cache for the current theme
+ */
+static int gui_build_gauge_faces(gui_manager_t *gui) {
+    for (int i = 0; i < gui->widgets.count; i++) {
+        if (gui->widgets.nodes[i].kind != WIDGET_DIAL) continue;
+        gauge_widget_t *gauge = &gui->widgets.nodes[i].data.gauge;
+        if (gauge->size.w <= 0 || gauge->size.h <= 0) continue;
+        
+        if (gauge->face.width != gauge->size.w || gauge->face.height != gauge->size.h) {
+            framebuffer_free(&gauge->face);
+            if (framebuffer_init(&gauge->face, gauge->size.w, gauge->size.h) != 0) {
+                return -1;
+            }
+        }
+        
+        /* Same gauge drawn at the surface origin */
+        gauge_widget_t local = *gauge;
+        local.position = (PhPoint_t){0, 0};
+        framebuffer_clear(&gauge->face, gui_backdrop_color(gui, i));
+        gui_draw_gauge_background(&gauge->face, &local, gui->current_theme);
+    }
+    
+    gui->faces_valid = true;
+    return 0;
+}
+
+/**
+ * Largest font scale (up to max_scale) at which text fits width x height
+ */
+static int gui_fit_text_scale(const char *text, int width, int height, int max_scale) {
+    int scale = max_scale;
+    while (scale > 1 && (framebuffer_text_width(text, scale) > width ||
+                         FRAMEBUFFER_GLYPH_HEIGHT * scale > height)) {
+        scale--;
+    }
+    return scale;
+}
+
+/**
+ * Group panel: face colour with a bezel outline and the title top left
+ */
+static void gui_draw_panel(framebuffer_t *fb, const widget_node_t *node, gui_theme_t theme) {
+    const framebuffer_rect_t *box = &node->box;
+    
+    framebuffer_fill_rect(fb, box->x, box->y, box->width, box->height,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "bezel")));
+    framebuffer_fill_rect(fb, box->x + 1, box->y + 1, box->width - 2, box->height - 2,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "face")));
+    if (node->data.gauge.label[0]) {
+        framebuffer_draw_text(fb, box->x + 4, box->y + 4, node->data.gauge.label, 1,
+                              FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "tick")));
+    }
+}
+
+/**
+ * Level bar as last drawn: track, fill in the value's zone colour, label
+ */
+static void gui_draw_bar(framebuffer_t *fb, const gauge_widget_t *gauge, gui_theme_t theme) {
+    static const char *const ZONES[] = {"normal", "warning", "critical"};
+    const framebuffer_rect_t *fill = &gauge->drawn_needle;
+    
+    framebuffer_fill_rect(fb, gauge->position.x, gauge->position.y, gauge->size.w, gauge->size.h,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "bezel")));
+    framebuffer_fill_rect(fb, gauge->position.x + 2, gauge->position.y + 2, gauge->size.w - 4,
+                          gauge->size.h - 4, FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "face")));
+    framebuffer_fill_rect(fb, fill->x, fill->y, fill->width, fill->height,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme,
+                              ZONES[gui_value_zone(gauge, gauge->drawn_value)])));
+    
+    if (gauge->label[0]) {
+        int scale = gui_fit_text_scale(gauge->label, gauge->size.w - 8, gauge->size.h - 4, 2);
+        framebuffer_draw_text(fb, gauge->position.x + 4,
+                              gauge->position.y + (gauge->size.h - FRAMEBUFFER_GLYPH_HEIGHT * scale) / 2,
+                              gauge->label, scale, FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "text")));
+    }
+}
+
+/**
+ * Readout as last drawn: label on top, value centred below
+ */
+static void gui_draw_readout(framebuffer_t *fb, const gauge_widget_t *gauge, gui_theme_t theme) {
+    int top = gauge->position.y + 2;
+    
+    framebuffer_fill_rect(fb, gauge->position.x, gauge->position.y, gauge->size.w, gauge->size.h,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "face")));
+    if (gauge->label[0]) {
+        framebuffer_draw_text(fb, gauge->position.x + 3, top, gauge->label, 1,
+                              FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "tick")));
+        top += FRAMEBUFFER_GLYPH_HEIGHT + 2;
+    }
+    
+    int height = gauge->position.y + gauge->size.h - 2 - top;
+    int scale = gui_fit_text_scale(gauge->drawn_text, gauge->size.w - 4, height, 4);
+    int width = framebuffer_text_width(gauge->drawn_text, scale);
+    framebuffer_draw_text(fb, gauge->position.x + (gauge->size.w - width) / 2,
+                          top + (height - FRAMEBUFFER_GLYPH_HEIGHT * scale) / 2, gauge->drawn_text,
+                          scale, FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "display")));
+}
+
+/**
+ * Paint the scene as recorded by the last damage pass, within fb's clip
+ *
+ * Subtrees outside the clip are skipped whole. Only reads gui, so tiles
+ * of one frame may be painted concurrently.
+ */
+static void gui_draw_scene(const gui_manager_t *gui, framebuffer_t *fb) {
+    const widget_tree_t *tree = &gui->widgets;
+    gui_theme_t theme = gui->current_theme;
+    framebuffer_rect_t clip = {fb->clip_x0, fb->clip_y0, fb->clip_x1 - fb->clip_x0,
+                               fb->clip_y1 - fb->clip_y0};
+    
+    framebuffer_clear(fb, FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "background")));
+    
+    PgColor_t display = gui_get_theme_color(theme, "display");
+    int i = 0;
+    while (i < tree->count) {
+        const widget_node_t *node = &tree->nodes[i];
+        if (!widget_rect_intersects(node->bounds, clip)) {
+            i = node->subtree_end;
+            continue;
+        }
+        i++;
+        if (!widget_rect_intersects(node->box, clip)) continue;
+        
+        const gauge_widget_t *gauge = &node->data.gauge;
+        switch (node->kind) {
+            case WIDGET_GROUP:
+                if (node->panel) gui_draw_panel(fb, node, theme);
+                break;
+            case WIDGET_DIAL:
+                if (!gauge->visible) break;
+                framebuffer_blit(fb, &gauge->face, gauge->position.x, gauge->position.y);
+                gui_draw_gauge_needle(fb, gauge, gauge->drawn_value, theme);
+                gui_draw_digital_display(fb, gauge->drawn_text, gui_gauge_readout_position(gauge), display);
+                break;
+            case WIDGET_BAR:
+                if (gauge->visible) gui_draw_bar(fb, gauge, theme);
+                break;
+            case WIDGET_READOUT:
+                if (gauge->visible) gui_draw_readout(fb, gauge, theme);
+                break;
+            case WIDGET_LIGHT:
+                gui_draw_warning_light(fb, &node->data.light, node->data.light.drawn_lit, theme);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void gui_draw_tile(void *context, framebuffer_t *view) {
+    gui_draw_scene((const gui_manager_t *)context, view);
+}
+
+/**
+ * Cut the damage into screen grid tiles for the render pool
+ *
+ * A tile is clipped to the bounds of the dirty rectangles it touches;
+ * tiles never overlap, so workers never paint the same pixel. Returns the
+ * tile count, or 0 when the tile list cannot be allocated.
+ */
+static int gui_build_tiles(gui_manager_t *gui) {
+    const framebuffer_t *fb = &gui->framebuffer;
+    int columns = (fb->width + RENDER_TILE_WIDTH - 1) / RENDER_TILE_WIDTH;
+    int rows = (fb->height + RENDER_TILE_HEIGHT - 1) / RENDER_TILE_HEIGHT;
+    
+    if (columns * rows > gui->tile_capacity) {
+        framebuffer_rect_t *tiles = realloc(gui->tiles, (size_t)columns * rows * sizeof(framebuffer_rect_t));
+        if (!tiles) return 0;
+        gui->tiles = tiles;
+        gui->tile_capacity = columns * rows;
+    }
+    
+    int count = 0;
+    for (int ty = 0; ty < fb->height; ty += RENDER_TILE_HEIGHT) {
+        for (int tx = 0; tx < fb->width; tx += RENDER_TILE_WIDTH) {
+            int tx1 = tx + RENDER_TILE_WIDTH < fb->width ? tx + RENDER_TILE_WIDTH : fb->width;
+            int ty1 = ty + RENDER_TILE_HEIGHT < fb->height ? ty + RENDER_TILE_HEIGHT : fb->height;
+            int x0 = tx1, y0 = ty1, x1 = tx, y1 = ty;
+            
+            for (int i = 0; i < gui->dirty_count; i++) {
+                const framebuffer_rect_t *rect = &gui->dirty[i];
+                int rx0 = rect->x > tx ? rect->x : tx;
+                int ry0 = rect->y > ty ? rect->y : ty;
+                int rx1 = rect->x + rect->width < tx1 ? rect->x + rect->width : tx1;
+                int ry1 = rect->y + rect->height < ty1 ? rect->y + rect->height : ty1;
+                if (rx0 >= rx1 || ry0 >= ry1) continue;
+                
+                if (rx0 < x0) x0 = rx0;
+                if (ry0 < y0) y0 = ry0;
+                if (rx1 > x1) x1 = rx1;
+                if (ry1 > y1) y1 = ry1;
+            }
+            if (x0 < x1 && y0 < y1) {
+                gui->tiles[count++] = (framebuffer_rect_t){x0, y0, x1 - x0, y1 - y0};
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Select where rendered frames go: "memory", a file or a /dev/fb device
+ */
+int gui_manager_set_output(gui_manager_t *gui, const char *target) {
+    if (!gui) return -1;
+    return framebuffer_open_output(&gui->framebuffer, target);
+}
+
+#ifdef USE_PHOTON
+/**
+ * Damage the canvas where the last frame changed and have it redrawn now
+ */
+static void gui_damage_canvas(gui_manager_t *gui) {
+    if (!gui->canvas) return;
+    
+    int lock = PtEnter(0);
+    PhRect_t canvas;
+    PtCalcCanvas(gui->canvas, &canvas);
+    for (int i = 0; i < gui->dirty_count; i++) {
+        const framebuffer_rect_t *dirty = &gui->dirty[i];
+        PhRect_t extent = {
+            {canvas.ul.x + dirty->x, canvas.ul.y + dirty->y},
+            {canvas.ul.x + dirty->x + dirty->width - 1, canvas.ul.y + dirty->y + dirty->height - 1}
+        };
+        PtDamageExtent(gui->canvas, &extent);
+    }
+    PtFlush();
+    if (lock >= 0) PtLeave(lock);
+}
+#endif
+
 /**
  * Render GUI
+ *
+ * Returns whether a frame was presented; without damage nothing is drawn.
  */
-void gui_manager_render(gui_manager_t *gui) {
-    if (!gui || !gui->initialized || !gui->needs_redraw) return;
+bool gui_manager_render(gui_manager_t *gui) {
+    if (!gui || !gui->initialized || !gui->needs_redraw) return false;
     
-    /* Simple console output for now - in real implementation would draw to Photon */
-    static int render_count = 0;
-    if (render_count++ % 60 == 0) { /* Print every second at 60 FPS */
-        printf("GUI Render - Speed: %.1f, RPM: %.1f, Fuel: %.1f%%, Temp: %.1f°C\n",
-               gui->gauges[0].current_value,
-               gui->gauges[1].current_value,
-               gui->gauges[2].current_value,
-               gui->gauges[3].current_value);
+    framebuffer_t *fb = &gui->framebuffer;
+    
+    if (!gui->faces_valid) {
+        if (gui_build_gauge_faces(gui) != 0) {
+            fprintf(stderr, "Error: Failed to cache gauge faces\n");
+            return false;
+        }
+        gui->full_redraw = true;
+    }
+    if (gui->full_redraw) {
+        gui->dirty[0] = (framebuffer_rect_t){0, 0, fb->width, fb->height};
+        gui->dirty_count = 1;
     }
     
+    uint64_t damage = 0;
+    for (int i = 0; i < gui->dirty_count; i++) {
+        damage += (uint64_t)gui->dirty[i].width * gui->dirty[i].height;
+    }
+    
+    int tiles = 0;
+    if (render_pool_threads(&gui->render_pool) > 1 && damage >= RENDER_POOL_MIN_PIXELS) {
+        tiles = gui_build_tiles(gui);
+    }
+    
+    if (tiles > 0) {
+        /* Returns once every tile is painted */
+        render_pool_run(&gui->render_pool, fb, gui->tiles, (uint32_t)tiles, gui_draw_tile, gui);
+        for (int i = 0; i < tiles; i++) {
+            gui->pixels_redrawn += (uint64_t)gui->tiles[i].width * gui->tiles[i].height;
+        }
+    } else {
+        for (int i = 0; i < gui->dirty_count; i++) {
+            const framebuffer_rect_t *rect = &gui->dirty[i];
+            framebuffer_set_clip(fb, rect->x, rect->y, rect->width, rect->height);
+            gui_draw_scene(gui, fb);
+        }
+        framebuffer_reset_clip(fb);
+        gui->pixels_redrawn += damage;
+    }
+    
+    framebuffer_present_rects(fb, gui->dirty, gui->dirty_count);
+#ifdef USE_PHOTON
+    gui_damage_canvas(gui);
+#endif
+    
+    gui->dirty_count = 0;
+    gui->full_redraw = false;
     gui->needs_redraw = false;
     gui->frame_count++;
+    return true;
 }
 
 /**
- * Handle events
+ * Render with threads threads in total, the calling one included
+ *
+ * config describes the thread that calls gui_manager_render(); workers
+ * take its policy and priority. threads <= 1 renders on that thread alone.
  */
-void gui_manager_handle_events(gui_manager_t *gui) {
+int gui_manager_set_render_threads(gui_manager_t *gui, int threads, const rt_thread_config_t *config) {
+    if (!gui) return -1;
+    
+    render_pool_destroy(&gui->render_pool);
+    if (render_pool_init(&gui->render_pool, threads > 1 ? (uint32_t)threads : 1, config) != 0) {
+        render_pool_init(&gui->render_pool, 1, NULL);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Change the screen size, scaling the layout with it
+ *
+ * Positions follow each axis; sizes use the smaller factor so dials stay
+ * round. Faces are rebuilt and the next frame is painted in full.
+ */
+int gui_manager_resize(gui_manager_t *gui, int width, int height) {
+    if (!gui || width <= 0 || height <= 0) return -1;
+    if (width == gui->framebuffer.width && height == gui->framebuffer.height) return 0;
+    
+    framebuffer_t resized;
+    if (framebuffer_init(&resized, width, height) != 0) {
+        fprintf(stderr, "Error: Cannot resize the framebuffer to %dx%d\n", width, height);
+        return -1;
+    }
+    
+    /* Keep the selected output */
+    char output[sizeof(gui->framebuffer.output_path)];
+    snprintf(output, sizeof(output), "%s", gui->framebuffer.output_path);
+    
+    widget_tree_fit(&gui->widgets, width, height);
+    
+    framebuffer_free(&gui->framebuffer);
+    gui->framebuffer = resized;
+    gui->window_size = (PhDim_t){width, height};
+    if (output[0] && framebuffer_open_output(&gui->framebuffer, output) != 0) {
+        printf("Warning: Frames will only be rendered to memory\n");
+    }
+    
+    gui->faces_valid = false;
+    gui_manager_invalidate(gui);
+    return 0;
+}
+
+/**
+ * Watch the keyboard for the exit keys
+ *
+ * Only a terminal this process has in the foreground is read, so a
+ * dashboard started in the background is not stopped by SIGTTIN. The
+ * terminal is switched to unbuffered, no-echo input (restored at
+ * cleanup) so ESC and q act without Enter.
+ */
+int gui_manager_open_input(gui_manager_t *gui) {
+    if (!gui || !gui->initialized) return -1;
+    
+    if (!isatty(STDIN_FILENO) || tcgetpgrp(STDIN_FILENO) != getpgrp()) {
+        gui->input_fd = -1;
+        return 0;
+    }
+    
+    if (tcgetattr(STDIN_FILENO, &gui->saved_termios) == 0) {
+        struct termios raw = gui->saved_termios;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        if (tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0) {
+            gui->termios_saved = true;
+        }
+    }
+    gui->input_fd = STDIN_FILENO;
+    return 0;
+}
+
+/**
+ * Put the terminal back the way gui_manager_open_input() found it
+ */
+static void gui_restore_input(gui_manager_t *gui) {
+    if (!gui->termios_saved) return;
+    
+    /* Moved to the background since: restoring must not stop us with SIGTTOU */
+    sigset_t block, previous;
+    sigemptyset(&block);
+    sigaddset(&block, SIGTTOU);
+    pthread_sigmask(SIG_BLOCK, &block, &previous);
+    tcsetattr(STDIN_FILENO, TCSANOW, &gui->saved_termios);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+    gui->termios_saved = false;
+}
+
+/**
+ * Dispatch pending window events (called periodically by the main loop)
+ *
+ * Photon delivers its events by message rather than on a descriptor, so
+ * they are peeked for without blocking; gui_window_close_callback() runs
+ * from here.
+ */
+void gui_manager_process_window_events(gui_manager_t *gui) {
     if (!gui || !gui->initialized) return;
+
+#ifdef USE_PHOTON
+    static union {
+        PhEvent_t event;
+        char buffer[sizeof(PhEvent_t) + 1024];
+    } pending;
+    
+    /* The GUI thread also enters the library to damage the canvas */
+    int lock = PtEnter(0);
+    while (PhEventPeek(&pending, sizeof(pending)) == Ph_EVENT_MSG) {
+        PtEventHandler(&pending.event);
+    }
+    if (lock >= 0) PtLeave(lock);
+#endif
+}
+
+/**
+ * Handle keyboard input (called by the main event loop when it is readable)
+ */
+void gui_manager_handle_events(gui_manager_t *gui) {
+    if (!gui || !gui->initialized || gui->input_fd < 0) return;
+    
+    char keys[32];
+    ssize_t count = read(gui->input_fd, keys, sizeof(keys));
+    if (count <= 0) {
+        if (count == 0 || (errno != EINTR && errno != EAGAIN)) {
+            /* Input closed - stop watching it */
+            gui_restore_input(gui);
+            gui->input_fd = -1;
+        }
+        return;
+    }
+    
+    for (ssize_t i = 0; i < count; i++) {
+        if (keys[i] == 27 || keys[i] == 'q' || keys[i] == 'Q') {
+            printf("Exit key pressed - shutting down\n");
+            dashboard_shutdown();
+        }
+    }
+}
+
+/**
+ * Get the descriptor the main event loop should wait on
+ */
+int gui_manager_get_event_fd(const gui_manager_t *gui) {
+    return (gui && gui->initialized) ? gui->input_fd : -1;
+}
+
+/**
+ * Switch theme; widget colours follow on the next frame
+ */
+int gui_manager_set_theme(gui_manager_t *gui, gui_theme_t theme) {
+    if (!gui || (unsigned)theme >= THEME_COUNT) return -1;
     
-    /* Process Photon events */
-    PtProcessEvent();
+    gui->current_theme = theme;
+    gui_apply_theme_colors(gui);
+    gui->faces_valid = false;
+    gui_manager_invalidate(gui);
+    return 0;
 }
 
+#ifdef USE_PHOTON
 /**
  * Window close callback
  */
-int gui_window_close_callback(PtWidget_t *widget, ApInfo_t *apinfo, 
+int gui_window_close_callback(PtWidget_t *widget, ApInfo_t *apinfo,
                              PtCallbackInfo_t *cbinfo) {
     printf("Window close requested - shutting down\n");
     dashboard_shutdown();
     return Pt_CONTINUE;
 }
 
+/**
+ * Canvas draw function: copy the damaged areas from the framebuffer
+ *
+ * Runs on whichever thread flushes the damage: the GUI thread right after
+ * a frame is presented, or the main thread when the window is exposed.
+ */
+void gui_canvas_draw(PtWidget_t *widget, PhTile_t *damage) {
+    gui_manager_t **user_data = NULL;
+    PtGetResource(widget, Pt_ARG_USER_DATA, &user_data, 0);
+    
+    PtSuperClassDraw(PtBasic, widget, damage);
+    if (!user_data || !*user_data) return;
+    
+    const framebuffer_t *fb = &(*user_data)->framebuffer;
+    PhRect_t canvas;
+    PtCalcCanvas(widget, &canvas);
+    PtClipAdd(widget, &canvas);
+    
+    /* The first tile bounds the damage; any that follow are the areas themselves */
+    for (PhTile_t *tile = damage->next ? damage->next : damage; tile; tile = tile->next) {
+        int x0 = tile->rect.ul.x - canvas.ul.x;
+        int y0 = tile->rect.ul.y - canvas.ul.y;
+        int x1 = tile->rect.lr.x - canvas.ul.x + 1;
+        int y1 = tile->rect.lr.y - canvas.ul.y + 1;
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > fb->width) x1 = fb->width;
+        if (y1 > fb->height) y1 = fb->height;
+        if (x0 >= x1 || y0 >= y1) continue;
+        
+        PhPoint_t pos = {canvas.ul.x + x0, canvas.ul.y + y0};
+        PhDim_t size = {x1 - x0, y1 - y0};
+        PgDrawImage(fb->pixels + (size_t)y0 * fb->stride + x0, Pg_IMAGE_DIRECT_8888, &pos, &size,
+                    fb->stride * (int)sizeof(uint32_t), 0);
+    }
+    
+    PtClipRemove();
+}
+#endif
+
+/**
+ * Drawing functions
+ */
+
+/**
+ * Dial angle in degrees (0 right, 90 up) of a gauge value
+ */
+static float gui_gauge_angle(float value, float min_val, float max_val) {
+    float range = max_val - min_val;
+    float fraction = range > 0.0f ? clamp((value - min_val) / range, 0.0f, 1.0f) : 0.0f;
+    return GAUGE_START_ANGLE_DEG - fraction * GAUGE_SWEEP_DEG;
+}
+
+/**
+ * Colour band for values [low, high] of the dial
+ */
+static void gui_draw_gauge_zone(framebuffer_t *fb, const gauge_widget_t *gauge,
+                                float cx, float cy, float radius,
+                                float low, float high, PgColor_t color) {
+    if (high <= low) return;
+    
+    /* Higher values sit clockwise, so the arc runs counter-clockwise from high */
+    framebuffer_fill_arc(fb, cx, cy, radius * GAUGE_ZONE_OUTER, radius * GAUGE_ZONE_INNER,
+                         gui_gauge_angle(high, gauge->min_value, gauge->max_value),
+                         gui_gauge_angle(low, gauge->min_value, gauge->max_value),
+                         FRAMEBUFFER_OPAQUE(color));
+}
+
+/**
+ * Static part of a gauge: bezel, face, coloured zones, ticks and label
+ */
+void gui_draw_gauge_background(framebuffer_t *fb, const gauge_widget_t *gauge, gui_theme_t theme) {
+    if (!fb || !gauge) return;
+    
+    float radius = gui_gauge_radius(gauge);
+    float cx = gauge->position.x + gauge->size.w * 0.5f;
+    float cy = gauge->position.y + gauge->size.h * 0.5f;
+    
+    framebuffer_fill_circle(fb, cx, cy, radius, FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "bezel")));
+    framebuffer_fill_circle(fb, cx, cy, radius * (1.0f - GAUGE_BEZEL_WIDTH),
+                            FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "face")));
+    
+    /* Zones in value order */
+    float min_val = gauge->min_value;
+    float max_val = gauge->max_value;
+    float warning = clamp(gauge->warning_threshold, min_val, max_val);
+    float critical = clamp(gauge->critical_threshold, min_val, max_val);
+    if (gauge->warning_threshold == 0.0f && gauge->critical_threshold == 0.0f) {
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, min_val, max_val, gauge->color_normal);
+    } else if (critical >= warning) {
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, min_val, warning, gauge->color_normal);
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, warning, critical, gauge->color_warning);
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, critical, max_val, gauge->color_critical);
+    } else {
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, min_val, critical, gauge->color_critical);
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, critical, warning, gauge->color_warning);
+        gui_draw_gauge_zone(fb, gauge, cx, cy, radius, warning, max_val, gauge->color_normal);
+    }
+    
+    /* Major ticks */
+    uint32_t tick_color = FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "tick"));
+    PhPoint_t center = {(int)cx, (int)cy};
+    for (int i = 0; i <= GAUGE_MAJOR_TICKS; i++) {
+        float value = min_val + (max_val - min_val) * i / GAUGE_MAJOR_TICKS;
+        PhPoint_t outer = gui_calculate_needle_position(value, min_val, max_val, center,
+                                                        (int)(radius * GAUGE_TICK_OUTER));
+        PhPoint_t inner = gui_calculate_needle_position(value, min_val, max_val, center,
+                                                        (int)(radius * GAUGE_TICK_INNER));
+        framebuffer_draw_line(fb, inner.x, inner.y, outer.x, outer.y, 2.0f, tick_color);
+    }
+    
+    /* Label below the hub */
+    int scale = radius >= 60.0f ? 2 : 1;
+    int width = framebuffer_text_width(gauge->label, scale);
+    framebuffer_draw_text(fb, (int)cx - width / 2, (int)(cy - radius * 0.45f), gauge->label, scale,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "text")));
+}
+
+/**
+ * Needle and hub for value
+ */
+void gui_draw_gauge_needle(framebuffer_t *fb, const gauge_widget_t *gauge, float value,
+                           gui_theme_t theme) {
+    if (!fb || !gauge) return;
+    
+    float radius = gui_gauge_radius(gauge);
+    PhPoint_t center = {gauge->position.x + gauge->size.w / 2,
+                        gauge->position.y + gauge->size.h / 2};
+    PhPoint_t tip = gui_calculate_needle_position(value, gauge->min_value, gauge->max_value,
+                                                  center, (int)(radius * GAUGE_NEEDLE_LENGTH));
+    
+    float thickness = radius >= 80.0f ? 4.0f : 3.0f;
+    framebuffer_draw_line(fb, center.x, center.y, tip.x, tip.y, thickness,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "needle")));
+    framebuffer_fill_circle(fb, center.x, center.y, radius * GAUGE_HUB_RADIUS,
+                            FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "hub")));
+}
+
+/**
+ * Numeric readout centred horizontally on pos, top edge at pos.y
+ */
+void gui_draw_digital_display(framebuffer_t *fb, const char *text, PhPoint_t pos, PgColor_t color) {
+    if (!fb || !text) return;
+    
+    int width = framebuffer_text_width(text, GUI_READOUT_SCALE);
+    framebuffer_draw_text(fb, pos.x - width / 2, pos.y, text, GUI_READOUT_SCALE,
+                          FRAMEBUFFER_OPAQUE(color));
+}
+
+/**
+ * Warning lamp: lit while active (and in the on phase when blinking)
+ */
+void gui_draw_warning_light(framebuffer_t *fb, const warning_light_t *warning, bool lit,
+                            gui_theme_t theme) {
+    if (!fb || !warning) return;
+    
+    PgColor_t fill = lit ? warning->color_on : warning->color_off;
+    PgColor_t text = gui_get_theme_color(theme, lit ? "light_text" : "tick");
+    
+    framebuffer_fill_rect(fb, warning->position.x, warning->position.y,
+                          warning->size.w, warning->size.h,
+                          FRAMEBUFFER_OPAQUE(gui_get_theme_color(theme, "bezel")));
+    framebuffer_fill_rect(fb, warning->position.x + 2, warning->position.y + 2,
+                          warning->size.w - 4, warning->size.h - 4, FRAMEBUFFER_OPAQUE(fill));
+    
+    int scale = gui_fit_text_scale(warning->label, warning->size.w - 6, warning->size.h - 4, 2);
+    int width = framebuffer_text_width(warning->label, scale);
+    framebuffer_draw_text(fb, warning->position.x + (warning->size.w - width) / 2,
+                          warning->position.y + (warning->size.h - scale * FRAMEBUFFER_GLYPH_HEIGHT) / 2,
+                          warning->label, scale, FRAMEBUFFER_OPAQUE(text));
+}
+
+/**
+ * Theme management
+ */
+PgColor_t gui_get_theme_color(gui_theme_t theme, const char *element) {
+    if ((unsigned)theme >= THEME_COUNT || !element) return 0x000000;
+    
+    for (size_t i = 0; i < THEME_COLOR_COUNT; i++) {
+        if (strcmp(THEME_COLORS[i].element, element) == 0) {
+            return THEME_COLORS[i].colors[theme];
+        }
+    }
+    return 0x000000;
+}
+
+void gui_apply_theme_colors(gui_manager_t *gui) {
+    if (!gui) return;
+    
+    gui_theme_t theme = gui->current_theme;
+    for (int i = 0; i < gui->widgets.count; i++) {
+        widget_node_t *node = &gui->widgets.nodes[i];
+        if (node->kind == WIDGET_LIGHT) {
+            warning_light_t *warning = &node->data.light;
+            warning->color_off = gui_get_theme_color(theme, "light_off");
+            warning->color_on = gui_get_theme_color(theme, warning->level >= WARNING_CRITICAL ? "critical" :
+                                                           warning->level == WARNING_LOW ? "normal" : "warning");
+        } else if (node->kind != WIDGET_GROUP) {
+            node->data.gauge.color_normal = gui_get_theme_color(theme, "normal");
+            node->data.gauge.color_warning = gui_get_theme_color(theme, "warning");
+            node->data.gauge.color_critical = gui_get_theme_color(theme, "critical");
+        }
+    }
+}
+
+/**
+ * Sine of an angle in degrees from a table, interpolated linearly
+ *
+ * Needle and tick positions are rounded to whole pixels, and the table's
+ * error (under 5e-6) cannot move one. Built on first use, normally by
+ * gui_manager_initialize() before any render thread exists.
+ */
+static float gui_sine_deg(float degrees) {
+    static float table[GUI_SINE_TABLE_SIZE + 1];
+    static bool built = false;
+    
+    if (!__atomic_load_n(&built, __ATOMIC_ACQUIRE)) {
+        for (int i = 0; i <= GUI_SINE_TABLE_SIZE; i++) {
+            table[i] = sinf((float)i * (360.0f / GUI_SINE_TABLE_SIZE) * GAUGE_DEG_TO_RAD);
+        }
+        __atomic_store_n(&built, true, __ATOMIC_RELEASE);
+    }
+    
+    float position = degrees * (GUI_SINE_TABLE_SIZE / 360.0f);
+    float base = floorf(position);
+    int index = (int)base & (GUI_SINE_TABLE_SIZE - 1);
+    return lerp(table[index], table[index + 1], position - base);
+}
+
+/**
+ * Utility functions
+ */
+PhPoint_t gui_calculate_needle_position(float value, float min_val, float max_val,
+                                       PhPoint_t center, int radius) {
+    float angle = gui_gauge_angle(value, min_val, max_val);
+    PhPoint_t tip;
+    tip.x = center.x + (int)lroundf(gui_sine_deg(angle + 90.0f) * radius);
+    tip.y = center.y - (int)lroundf(gui_sine_deg(angle) * radius);   /* Screen y grows down */
+    return tip;
+}
+
 /**
  * Cleanup GUI manager
  */
@@ -258,14 +1508,38 @@ void gui_manager_cleanup(gui_manager_t *gui) {
     if (!gui) return;
     
     printf("Cleaning up GUI manager...\n");
+    gui_restore_input(gui);
+    gui->input_fd = -1;
+    
+    if (gui->frame_count > 0) {
+        printf("GUI render: %u frames, %.0f pixels/frame redrawn (%.1f%% of the screen)\n",
+               gui->frame_count, (double)gui->pixels_redrawn / gui->frame_count,
+               100.0 * gui->pixels_redrawn / gui->frame_count /
+               ((double)gui->framebuffer.width * gui->framebuffer.height));
+    }
+    render_pool_print_statistics(&gui->render_pool);
+    render_pool_destroy(&gui->render_pool);
+    free(gui->tiles);
+    gui->tiles = NULL;
+    gui->tile_capacity = 0;
     
+    framebuffer_print_statistics(&gui->framebuffer);
+    framebuffer_free(&gui->framebuffer);
+    widget_tree_print_statistics(&gui->widgets);
+    gauge_animator_print_statistics(&gui->animator);
+    gauge_animator_free(&gui->animator);
+    gui_free_faces(gui);
+    widget_tree_free(&gui->widgets);
+
+#ifdef USE_PHOTON
     if (gui->main_window) {
         PtDestroyWidget(gui->main_window);
         gui->main_window = NULL;
     }
     
     PtExit();
+#endif
     gui->initialized = false;
     
     printf("GUI manager cleanup complete\n");
-} 
\ No newline at end of file
+}
@@ -0,0 +1,170 @@
+/**
+ * QNX Dashboard Simulator - JSON Reader Implementation
+ *
+ * Strings are returned as pointers into the input with their escapes kept
+ * verbatim, which is all the dashboard formats need: keys, ids and labels
+ * are plain ASCII. true and false read as the numbers 1 and 0.
+ */
+
+#include "../include/json_reader.h"
+
+void json_reader_init(json_reader_t *reader, const char *json, size_t length) {
+    memset(reader, 0, sizeof(json_reader_t));
+    reader->start = json;
+    reader->cursor = json;
+    reader->end = json + length;
+}
+
+/**
+ * Record message with the current line number; only the first error is
+ * kept. Always returns false so callers can return it directly.
+ */
+bool json_reader_fail(json_reader_t *reader, const char *message) {
+    if (reader->error[0] == '\0') {
+        int line = 1;
+        for (const char *p = reader->start; p < reader->cursor && p < reader->end; p++) {
+            if (*p == '\n') line++;
+        }
+        snprintf(reader->error, sizeof(reader->error), "line %d: %s", line, message);
+    }
+    return false;
+}
+
+static void json_reader_skip_space(json_reader_t *reader) {
+    while (reader->cursor < reader->end &&
+           (*reader->cursor == ' ' || *reader->cursor == '\t' ||
+            *reader->cursor == '\n' || *reader->cursor == '\r')) {
+        reader->cursor++;
+    }
+}
+
+/* Only white space may follow the document */
+bool json_reader_finish(json_reader_t *reader) {
+    json_reader_skip_space(reader);
+    return reader->cursor == reader->end || json_reader_fail(reader, "trailing characters");
+}
+
+bool json_reader_expect(json_reader_t *reader, char expected) {
+    json_reader_skip_space(reader);
+    if (reader->cursor >= reader->end || *reader->cursor != expected) {
+        char message[32];
+        snprintf(message, sizeof(message), "expected '%c'", expected);
+        return json_reader_fail(reader, message);
+    }
+    reader->cursor++;
+    return true;
+}
+
+bool json_reader_peek(json_reader_t *reader, char c) {
+    json_reader_skip_space(reader);
+    return reader->cursor < reader->end && *reader->cursor == c;
+}
+
+/* Consume c if it is next */
+bool json_reader_accept(json_reader_t *reader, char c) {
+    if (!json_reader_peek(reader, c)) return false;
+    reader->cursor++;
+    return true;
+}
+
+/* String contents (escapes kept verbatim); *out points into the input */
+bool json_reader_string(json_reader_t *reader, const char **out, size_t *length) {
+    if (!json_reader_expect(reader, '"')) return false;
+
+    const char *begin = reader->cursor;
+    while (reader->cursor < reader->end && *reader->cursor != '"') {
+        if (*reader->cursor == '\\') reader->cursor++;
+        reader->cursor++;
+    }
+    if (reader->cursor >= reader->end) return json_reader_fail(reader, "unterminated string");
+
+    *out = begin;
+    *length = (size_t)(reader->cursor - begin);
+    reader->cursor++;
+    return true;
+}
+
+/* String into a fixed buffer, truncated to fit */
+bool json_reader_string_copy(json_reader_t *reader, char *out, size_t size) {
+    const char *text;
+    size_t length;
+    if (!json_reader_string(reader, &text, &length)) return false;
+
+    if (length >= size) length = size - 1;
+    memcpy(out, text, length);
+    out[length] = '\0';
+    return true;
+}
+
+bool json_reader_number(json_reader_t *reader, float *out) {
+    json_reader_skip_space(reader);
+    if (reader->end - reader->cursor >= 4 && strncmp(reader->cursor, "true", 4) == 0) {
+        reader->cursor += 4;
+        *out = 1.0f;
+        return true;
+    }
+    if (reader->end - reader->cursor >= 5 && strncmp(reader->cursor, "false", 5) == 0) {
+        reader->cursor += 5;
+        *out = 0.0f;
+        return true;
+    }
+
+    char *number_end;
+    double value = strtod(reader->cursor, &number_end);
+    if (number_end == reader->cursor) return json_reader_fail(reader, "expected a number");
+
+    reader->cursor = number_end;
+    *out = (float)value;
+    return true;
+}
+
+bool json_reader_bool(json_reader_t *reader, bool *out) {
+    float value;
+    if (!json_reader_number(reader, &value)) return false;
+    *out = value != 0.0f;
+    return true;
+}
+
+/* Skip any JSON value (used for keys the caller's format does not define) */
+bool json_reader_skip_value(json_reader_t *reader, int depth) {
+    if (depth > JSON_READER_MAX_DEPTH) return json_reader_fail(reader, "nesting too deep");
+
+    json_reader_skip_space(reader);
+    if (reader->cursor >= reader->end) return json_reader_fail(reader, "unexpected end of file");
+
+    char c = *reader->cursor;
+    if (c == '"') {
+        const char *text;
+        size_t length;
+        return json_reader_string(reader, &text, &length);
+    }
+    if (c == '{' || c == '[') {
+        char close = c == '{' ? '}' : ']';
+        reader->cursor++;
+        if (json_reader_accept(reader, close)) return true;
+        do {
+            if (c == '{') {
+                const char *key;
+                size_t length;
+                if (!json_reader_string(reader, &key, &length) ||
+                    !json_reader_expect(reader, ':')) {
+                    return false;
+                }
+            }
+            if (!json_reader_skip_value(reader, depth + 1)) return false;
+        } while (json_reader_accept(reader, ','));
+        return json_reader_expect(reader, close);
+    }
+    if (reader->end - reader->cursor >= 4 && strncmp(reader->cursor, "null", 4) == 0) {
+        reader->cursor += 4;
+        return true;
+    }
+
+    float ignored;
+    return json_reader_number(reader, &ignored);
+}
+
+/* Compare a key returned by json_reader_string() with a C string */
+bool json_key_is(const char *key, size_t length, const char *name) {
+    return strlen(name) == length && strncmp(key, name, length) == 0;
+}
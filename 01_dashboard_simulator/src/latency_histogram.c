@@ -0,0 +1,156 @@
+/**
+ * QNX Dashboard Simulator - Latency Histogram Implementation
+ *
+ * HDR-style log-linear buckets: values below 2^SUB_BUCKET_BITS ns get one
+ * bucket each, larger values keep their top SUB_BUCKET_BITS significant
+ * bits. Recording is a bucket lookup plus relaxed stores, so the owning
+ * thread never locks and readers see at worst a sample in flight.
+ */
+
+#include "../include/latency_histogram.h"
+
+#define LATENCY_LINEAR_LIMIT  (1ULL << LATENCY_SUB_BUCKET_BITS)
+#define LATENCY_MAX_VALUE     ((1ULL << (LATENCY_MAX_EXPONENT + 1)) - 1)
+
+static uint32_t highest_bit(uint64_t value) {
+    return 63u - (uint32_t)__builtin_clzll(value);
+}
+
+/**
+ * Map a value to its bucket index
+ */
+uint32_t latency_bucket_index(uint64_t value_ns) {
+    if (value_ns < LATENCY_LINEAR_LIMIT) {
+        return (uint32_t)value_ns;
+    }
+    if (value_ns > LATENCY_MAX_VALUE) {
+        value_ns = LATENCY_MAX_VALUE;
+    }
+
+    uint32_t shift = highest_bit(value_ns) - LATENCY_SUB_BUCKET_BITS + 1;
+    uint32_t sub_bucket = (uint32_t)(value_ns >> shift);  /* [HALF, 2*HALF) */
+    return shift * LATENCY_SUB_BUCKET_HALF + sub_bucket;
+}
+
+/**
+ * Largest value that maps to a bucket
+ */
+uint64_t latency_bucket_upper_bound(uint32_t index) {
+    if (index < LATENCY_LINEAR_LIMIT) {
+        return index;
+    }
+
+    uint32_t shift = index / LATENCY_SUB_BUCKET_HALF - 1;
+    uint64_t sub_bucket = index - shift * LATENCY_SUB_BUCKET_HALF;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+/**
+ * Reset histogram (owner thread, or before the owner starts)
+ */
+void latency_histogram_reset(latency_histogram_t *hist) {
+    if (!hist) return;
+    memset(hist, 0, sizeof(latency_histogram_t));
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/**
+ * Record one sample (owner thread only)
+ */
+void latency_histogram_record(latency_histogram_t *hist, uint64_t value_ns) {
+    if (!hist) return;
+
+    uint32_t index = latency_bucket_index(value_ns);
+
+    /* Single writer: plain increment published with relaxed stores */
+    __atomic_store_n(&hist->counts[index], hist->counts[index] + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&hist->last_ns, value_ns, __ATOMIC_RELAXED);
+    if (value_ns > hist->max_ns) {
+        __atomic_store_n(&hist->max_ns, value_ns, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&hist->sample_count, hist->sample_count + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Query functions
+ */
+uint64_t latency_histogram_count(const latency_histogram_t *hist) {
+    return hist ? __atomic_load_n(&hist->sample_count, __ATOMIC_ACQUIRE) : 0;
+}
+
+uint64_t latency_histogram_max(const latency_histogram_t *hist) {
+    return hist ? __atomic_load_n(&hist->max_ns, __ATOMIC_RELAXED) : 0;
+}
+
+uint64_t latency_histogram_percentile(const latency_histogram_t *hist, double percentile) {
+    if (!hist) return 0;
+
+    /* Sum bucket counts directly so the total matches what we walk */
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+        total += __atomic_load_n(&hist->counts[i], __ATOMIC_RELAXED);
+    }
+    if (total == 0) return 0;
+
+    if (percentile < 0.0) percentile = 0.0;
+    if (percentile > 100.0) percentile = 100.0;
+
+    uint64_t rank = (uint64_t)ceil(percentile / 100.0 * (double)total);
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+        seen += __atomic_load_n(&hist->counts[i], __ATOMIC_RELAXED);
+        if (seen >= rank) {
+            uint64_t bound = latency_bucket_upper_bound(i);
+            uint64_t max_ns = latency_histogram_max(hist);
+            return (max_ns && bound > max_ns) ? max_ns : bound;
+        }
+    }
+
+    return latency_histogram_max(hist);
+}
+
+/**
+ * Compute p50/p99/p99.9/max in milliseconds
+ */
+void latency_histogram_summarize(const latency_histogram_t *hist, latency_summary_t *summary) {
+    if (!hist || !summary) return;
+
+    summary->samples = latency_histogram_count(hist);
+    summary->p50_ms = (float)latency_histogram_percentile(hist, 50.0) / 1000000.0f;
+    summary->p99_ms = (float)latency_histogram_percentile(hist, 99.0) / 1000000.0f;
+    summary->p999_ms = (float)latency_histogram_percentile(hist, 99.9) / 1000000.0f;
+    summary->max_ms = (float)latency_histogram_max(hist) / 1000000.0f;
+}
+
+/**
+ * Utility functions
+ */
+const char *latency_stage_to_string(latency_stage_t stage) {
+    switch (stage) {
+        case LATENCY_STAGE_PHYSICS: return "physics";
+        case LATENCY_STAGE_SNAPSHOT: return "snapshot";
+        case LATENCY_STAGE_GUI_UPDATE: return "gui_update";
+        case LATENCY_STAGE_GUI_RENDER: return "gui_render";
+        case LATENCY_STAGE_FRAME: return "frame";
+        case LATENCY_STAGE_AGE_PUBLISH: return "age_publish";
+        case LATENCY_STAGE_AGE_UPDATE: return "age_update";
+        case LATENCY_STAGE_AGE_DISPLAY: return "age_display";
+        default: return "unknown";
+    }
+}
+
+void latency_print_summary(const latency_summary_t summary[LATENCY_STAGE_COUNT]) {
+    if (!summary) return;
+
+    printf("=== Stage Latency (ms) ===\n");
+    printf("%-11s %10s %9s %9s %9s %9s\n", "Stage", "Samples", "p50", "p99", "p99.9", "max");
+    for (int i = 0; i < LATENCY_STAGE_COUNT; i++) {
+        printf("%-11s %10llu %9.3f %9.3f %9.3f %9.3f\n",
+               latency_stage_to_string((latency_stage_t)i),
+               (unsigned long long)summary[i].samples,
+               summary[i].p50_ms, summary[i].p99_ms,
+               summary[i].p999_ms, summary[i].max_ms);
+    }
+}
@@ -9,6 +9,17 @@
 #include "../include/dashboard.h"
 #include "../include/gui_manager.h"
 #include "../include/data_simulator.h"
+#include "../include/vehicle_snapshot.h"
+#include "../include/signal_ring.h"
+#include "../include/recorder.h"
+#include "../include/periodic_task.h"
+#include "../include/frame_scheduler.h"
+#include "../include/gauge_animator.h"
+#include "../include/latency_histogram.h"
+#include "../include/resource_monitor.h"
+#include "../include/event_loop.h"
+#include "../include/rt_thread.h"
+#include "../include/sweep.h"
 #include "../include/config.h"
 
 /* Global Variables */
@@ -18,7 +29,15 @@ volatile sig_atomic_t g_shutdown_requested = 0;
 /* Forward Declarations */
 static void print_startup_banner(void);
 static int process_command_line_args(int argc, char *argv[]);
-static void setup_thread_priorities(void);
+static int run_parameter_sweep(dashboard_context_t *ctx);
+static void setup_thread_priorities(rt_thread_config_t configs[APP_THREAD_COUNT]);
+static void setup_periodic_tasks(dashboard_context_t *ctx);
+static bool handle_gui_input(int fd, void *user_data);
+static void handle_config_timer(void *user_data);
+static void record_data_step(void *context, const vehicle_data_t *data);
+#ifdef USE_PHOTON
+static void handle_window_events(void *user_data);
+#endif
 
 /**
  * Main application entry point
@@ -42,6 +61,11 @@ int main(int argc, char *argv[]) {
         return result;
     }
     
+    /* Headless parameter sweep instead of the dashboard */
+    if (g_dashboard_context.sweep.runs > 0) {
+        return run_parameter_sweep(&g_dashboard_context);
+    }
+    
     /* Run the main application loop */
     result = dashboard_run();
     
@@ -63,6 +87,28 @@ int dashboard_initialize(int argc, char *argv[]) {
     /* Set initial state */
     dashboard_set_state(STATE_INITIALIZING);
     
+    if (process_command_line_args(argc, argv) != 0) {
+        return 1;
+    }
+    
+    /* A sweep needs no GUI, threads or devices */
+    if (ctx->sweep.runs > 0) {
+        return 0;
+    }
+    
+    /* Settings file; without one the compiled-in values below apply */
+    const char *config_file = ctx->config_file[0] ? ctx->config_file : DEFAULT_CONFIG_FILE;
+    config_result_t config_result = config_load(&g_dashboard_config, config_file);
+    if (config_result == CONFIG_SUCCESS) {
+        config_print_summary(&g_dashboard_config);
+    } else if (ctx->config_file[0] || config_result != CONFIG_ERROR_FILE_NOT_FOUND) {
+        fprintf(stderr, "Error: Cannot load configuration %s: %s\n", config_file,
+                config_result_to_string(config_result));
+        return -1;
+    } else {
+        printf("No configuration file at %s, using built-in settings\n", config_file);
+    }
+    
     /* Initialize threading primitives */
     if (pthread_mutex_init(&ctx->data_mutex, NULL) != 0) {
         fprintf(stderr, "Error: Failed to initialize data mutex\n");
@@ -74,6 +120,42 @@ int dashboard_initialize(int argc, char *argv[]) {
         fprintf(stderr, "Error: Failed to initialize GUI manager\n");
         return -1;
     }
+    if (g_dashboard_config.loaded) {
+        gui_manager_set_visual_epsilon(&ctx->gui, g_dashboard_config.performance.visual_epsilon_px);
+        gui_manager_set_animation_curve(&ctx->gui,
+            animation_curve_from_string(g_dashboard_config.theme.animation_curve, ANIMATION_SPRING),
+            (uint32_t)g_dashboard_config.theme.animation_duration_ms);
+        gui_manager_set_animations(&ctx->gui, g_dashboard_config.theme.enable_animations);
+    }
+    const char *layout_file = ctx->layout_file[0] ? ctx->layout_file :
+        (g_dashboard_config.loaded && g_dashboard_config.display.layout_file[0] ?
+         g_dashboard_config.display.layout_file : NULL);
+    if (layout_file) {
+        char resource_path[MAX_CONFIG_VALUE_LENGTH + 16];
+        if (layout_file[0] != '/' && access(layout_file, R_OK) != 0) {
+            int length = snprintf(resource_path, sizeof(resource_path), "resources/%s", layout_file);
+            if (length < 0 || (size_t)length >= sizeof(resource_path)) {
+                fprintf(stderr, "Error: Layout path too long: %s\n", layout_file);
+                layout_file = NULL;
+            } else {
+                layout_file = resource_path;
+            }
+        }
+        if (!layout_file || gui_manager_load_layout(&ctx->gui, layout_file) != 0) {
+            printf("Warning: Layout unavailable, using the built-in layout\n");
+        }
+    }
+    int width = ctx->resolution_width ? ctx->resolution_width :
+        (g_dashboard_config.loaded ? g_dashboard_config.display.window_width : WINDOW_WIDTH);
+    int height = ctx->resolution_height ? ctx->resolution_height :
+        (g_dashboard_config.loaded ? g_dashboard_config.display.window_height : WINDOW_HEIGHT);
+    if (gui_manager_resize(&ctx->gui, width, height) != 0) {
+        printf("Warning: Rendering at %dx%d\n", ctx->gui.framebuffer.width, ctx->gui.framebuffer.height);
+    }
+    if (ctx->framebuffer_output[0] &&
+        gui_manager_set_output(&ctx->gui, ctx->framebuffer_output) != 0) {
+        printf("Warning: Frames will only be rendered to memory\n");
+    }
     
     /* Initialize data simulator */
     if (data_simulator_initialize(&ctx->simulator) != 0) {
@@ -81,6 +163,91 @@ int dashboard_initialize(int argc, char *argv[]) {
         return -1;
     }
     
+    /* Physics step, playback settings and an optional recording to replay */
+    if (g_dashboard_config.loaded) {
+        data_simulator_set_update_rate(&ctx->simulator,
+                                       (uint32_t)g_dashboard_config.performance.data_update_rate_hz);
+        ctx->simulator.scenario_speed = g_dashboard_config.simulation.simulation_speed;
+        ctx->simulator.scenario_loop = g_dashboard_config.simulation.loop_scenarios;
+    }
+    const char *replay_file = ctx->replay_file[0] ? ctx->replay_file :
+        (g_dashboard_config.loaded &&
+         strcmp(g_dashboard_config.simulation.simulation_mode, "replay") == 0 ?
+         g_dashboard_config.simulation.replay_file : NULL);
+    if (replay_file && data_simulator_open_replay(&ctx->simulator, replay_file) != 0) {
+        printf("Warning: Replay unavailable, using simulated data\n");
+    }
+    
+    /* Scenarios are compiled here, never on the data thread */
+    if (!replay_file && g_dashboard_config.loaded && g_dashboard_config.simulation.enable_scenarios) {
+        const char *scenario_file = g_dashboard_config.simulation.scenario_file;
+        char resource_path[MAX_CONFIG_VALUE_LENGTH + 16];
+        if (scenario_file[0] != '/' && access(scenario_file, R_OK) != 0) {
+            /* Relative paths in the config are relative to the resources directory */
+            int length = snprintf(resource_path, sizeof(resource_path), "resources/%s", scenario_file);
+            if (length < 0 || (size_t)length >= sizeof(resource_path)) {
+                fprintf(stderr, "Error: Scenario path too long: %s\n", scenario_file);
+                scenario_file = NULL;
+            } else {
+                scenario_file = resource_path;
+            }
+        }
+        if (!scenario_file || data_load_scenario(&ctx->simulator, scenario_file) != 0) {
+            printf("Warning: Scenario unavailable, using simulated data\n");
+        }
+    }
+    
+    /* Publish initial vehicle state before any reader starts */
+    vehicle_snapshot_init(&ctx->vehicle_snapshot, &ctx->simulator.current_data);
+    
+    /* External producers queue samples here; the data thread drains them */
+    signal_ring_init(&ctx->ingest_ring,
+        signal_ring_policy_from_string(g_dashboard_config.loaded ?
+                                       g_dashboard_config.simulation.ingest_overflow_policy : NULL,
+                                       SIGNAL_RING_DROP_OLDEST));
+    
+    /* Optional binary log of every published sample */
+    const char *record_file = ctx->record_file[0] ? ctx->record_file :
+        (g_dashboard_config.loaded && g_dashboard_config.simulation.enable_recording ?
+         g_dashboard_config.simulation.record_file : NULL);
+    if (record_file && recorder_open(&ctx->recorder, record_file,
+                                    (uint32_t)ctx->simulator.update_rate_hz) != 0) {
+        printf("Warning: Recording disabled\n");
+    }
+    
+    /* Main thread sleeps in the event loop until input, a timer or shutdown */
+    if (event_loop_initialize(&ctx->event_loop) != 0) {
+        fprintf(stderr, "Error: Failed to initialize event loop\n");
+        return -1;
+    }
+    
+    /* Configure periodic release schedules */
+    setup_periodic_tasks(ctx);
+    
+    /* Resource limits from configuration */
+    resource_monitor_initialize(&ctx->resource_monitor,
+        g_dashboard_config.loaded ? (uint32_t)g_dashboard_config.performance.max_memory_usage_mb
+                                  : MAX_MEMORY_USAGE_MB,
+        g_dashboard_config.loaded ? g_dashboard_config.performance.max_cpu_usage_percent
+                                  : DEFAULT_MAX_CPU_PERCENT);
+    
+    /* Sensor-to-display latency budget checked every frame */
+    ctx->performance.latency_budget_ms = g_dashboard_config.loaded ?
+        g_dashboard_config.performance.max_data_latency_ms : MAX_DATA_LATENCY_MS;
+    
+    /* Lock memory before threads start so their stacks are never paged */
+    bool lock_memory = g_dashboard_config.loaded ? g_dashboard_config.performance.lock_memory : true;
+    if (lock_memory) {
+        ctx->memory_lock_error = rt_lock_memory();
+        if (ctx->memory_lock_error != 0) {
+            printf("Warning: mlockall failed (%s), continuing without locked memory\n",
+                   strerror(ctx->memory_lock_error));
+        }
+    }
+    
+    /* Threads check 'running' from their first iteration */
+    ctx->running = true;
+    
     /* Create application threads */
     if (create_application_threads() != 0) {
         fprintf(stderr, "Error: Failed to create application threads\n");
@@ -99,18 +266,23 @@ int dashboard_initialize(int argc, char *argv[]) {
 int dashboard_run(void) {
     dashboard_context_t *ctx = &g_dashboard_context;
     
-    ctx->running = true;
     printf("Starting dashboard main loop...\n");
     
     /* Main event loop */
-    while (ctx->running && !g_shutdown_requested) {
-        gui_manager_handle_events(&ctx->gui);
-        
-        if (dashboard_get_state() == STATE_SHUTTING_DOWN) {
-            break;
-        }
-        
-        usleep(1000); /* 1ms */
+    gui_manager_open_input(&ctx->gui);
+    int input_fd = gui_manager_get_event_fd(&ctx->gui);
+    if (input_fd >= 0) {
+        event_loop_add_fd(&ctx->event_loop, input_fd, handle_gui_input, ctx);
+    }
+#ifdef USE_PHOTON
+    event_loop_add_timer(&ctx->event_loop, GUI_WINDOW_EVENT_POLL_MS, handle_window_events, ctx);
+#endif
+    if (g_dashboard_config.loaded) {
+        event_loop_add_timer(&ctx->event_loop, 1000, handle_config_timer, &g_dashboard_config);
+    }
+    
+    if (!g_shutdown_requested && dashboard_get_state() != STATE_SHUTTING_DOWN) {
+        event_loop_run(&ctx->event_loop);
     }
     
     printf("Main loop terminated. Initiating shutdown...\n");
@@ -121,6 +293,25 @@ int dashboard_run(void) {
     /* Wait for threads to complete */
     join_application_threads();
     
+    /* Data thread has stopped submitting; flush the recording */
+    recorder_close(&ctx->recorder);
+    
+    if (ctx->debug_mode) {
+        event_loop_print_statistics(&ctx->event_loop);
+        signal_ring_print_statistics(&ctx->ingest_ring);
+        recorder_print_statistics(&ctx->recorder);
+        periodic_task_print_statistics(&ctx->gui_task);
+        frame_scheduler_print_statistics(&ctx->gui_scheduler);
+        periodic_task_print_statistics(&ctx->data_task);
+        periodic_task_print_statistics(&ctx->monitor_task);
+        latency_print_summary(ctx->performance.stage_summary);
+        printf("Sensor-to-display budget %.1f ms: %llu of %llu frames over\n",
+               ctx->performance.latency_budget_ms,
+               (unsigned long long)ctx->performance.latency_budget_breaches,
+               (unsigned long long)ctx->performance.frames_rendered);
+        resource_monitor_print(&ctx->performance.resources);
+    }
+    
     return 0;
 }
 
@@ -129,23 +320,77 @@ int dashboard_run(void) {
  */
 void *gui_thread_main(void *arg) {
     dashboard_context_t *ctx = (dashboard_context_t *)arg;
-    struct timespec sleep_time = {0, GUI_UPDATE_INTERVAL_MS * 1000000};
+    performance_metrics_t *perf = &ctx->performance;
+    
+    /* Last two published states, for interpolation at render time */
+    vehicle_data_t previous_state, latest_state;
+    uint32_t seen_version = vehicle_snapshot_version(&ctx->vehicle_snapshot);
+    vehicle_snapshot_read(&ctx->vehicle_snapshot, &latest_state);
+    previous_state = latest_state;
+    uint64_t display_delay_ns = ctx->simulator.clock.step_ns;
     
     printf("GUI thread started\n");
+    periodic_task_start(&ctx->gui_task);
     
     while (ctx->running && !g_shutdown_requested) {
-        /* Lock data for reading */
-        pthread_mutex_lock(&ctx->data_mutex);
-        vehicle_data_t current_data = ctx->simulator.current_data;
-        pthread_mutex_unlock(&ctx->data_mutex);
+        uint64_t frame_start = get_timestamp_ns();
+        
+        /* Copy latest published data (never blocks on the data thread) */
+        uint32_t version = vehicle_snapshot_version(&ctx->vehicle_snapshot);
+        if (version != seen_version) {
+            previous_state = latest_state;
+            vehicle_snapshot_read(&ctx->vehicle_snapshot, &latest_state);
+            seen_version = version;
+        }
+        
+        /* Display one data step in the past so motion is interpolated, not stepped */
+        vehicle_data_t current_data;
+        float alpha = data_interpolation_alpha(&previous_state, &latest_state,
+                                               frame_start - display_delay_ns);
+        data_interpolate(&previous_state, &latest_state, alpha, &current_data);
         
         /* Update GUI */
+        uint64_t update_start = get_timestamp_ns();
+        uint64_t acquired_ns = current_data.acquired_ns;
+        uint64_t age_at_update = update_start > acquired_ns ? update_start - acquired_ns : 0;
+        current_data.data_age_ms = (uint32_t)(age_at_update / 1000000ULL);
         gui_manager_update(&ctx->gui, &current_data);
-        gui_manager_render(&ctx->gui);
+        uint64_t render_start = get_timestamp_ns();
+        bool presented = gui_manager_render(&ctx->gui);
+        uint64_t frame_end = get_timestamp_ns();
         
-        ctx->performance.frames_rendered++;
+        /* GUI thread owns the GUI stage histograms */
+        latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_GUI_UPDATE],
+                                 render_start - update_start);
+        latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_AGE_UPDATE], age_at_update);
+        perf->gui_update_time_ms = (float)(frame_end - update_start) / 1000000.0f;
+        perf->total_frame_time_ms = (float)(frame_end - frame_start) / 1000000.0f;
         
-        nanosleep(&sleep_time, NULL);
+        if (presented) {
+            uint64_t age_at_display = frame_end > acquired_ns ? frame_end - acquired_ns : 0;
+            latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_GUI_RENDER],
+                                     frame_end - render_start);
+            latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_FRAME],
+                                     frame_end - frame_start);
+            latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_AGE_DISPLAY], age_at_display);
+            
+            /* Sensor-to-display latency of this frame against the budget */
+            perf->sensor_to_display_ms = (float)age_at_display / 1000000.0f;
+            if (perf->sensor_to_display_ms > perf->latency_budget_ms) {
+                perf->latency_budget_breaches++;
+            }
+            ctx->performance.frames_rendered++;
+        } else {
+            /* Nothing moved past the visual epsilon and no blink phase changed */
+            ctx->performance.frames_skipped++;
+        }
+        
+        /* Sleep through releases while the screen is still or frames run long */
+        uint32_t releases = frame_scheduler_end_frame(&ctx->gui_scheduler, presented,
+                                                      gui_manager_animating(&ctx->gui),
+                                                      frame_end - frame_start);
+        perf->gui_rate_hz = frame_scheduler_rate_hz(&ctx->gui_scheduler);
+        periodic_task_wait_releases(&ctx->gui_task, releases);
     }
     
     printf("GUI thread terminated\n");
@@ -157,20 +402,50 @@ void *gui_thread_main(void *arg) {
  */
 void *data_thread_main(void *arg) {
     dashboard_context_t *ctx = (dashboard_context_t *)arg;
-    struct timespec sleep_time = {0, DATA_UPDATE_INTERVAL_MS * 1000000};
+    performance_metrics_t *perf = &ctx->performance;
+    signal_sample_t batch[SIGNAL_INGEST_BATCH];
     
     printf("Data thread started\n");
+    periodic_task_start(&ctx->data_task);
     
     while (ctx->running && !g_shutdown_requested) {
-        float delta_time = DATA_UPDATE_INTERVAL_MS / 1000.0f;
+        /* Simulator state is private to this thread; readers use the snapshot */
+        uint64_t physics_start = get_timestamp_ns();
+        
+        /* Drain external samples, bounded so a flooding producer cannot stall the tick */
+        uint32_t drained = 0, count;
+        while (drained < SIGNAL_RING_CAPACITY &&
+               (count = signal_ring_pop_batch(&ctx->ingest_ring, batch, SIGNAL_INGEST_BATCH)) > 0) {
+            data_simulator_ingest(&ctx->simulator, batch, count);
+            drained += count;
+        }
+        
+        /* Fixed steps for the real time elapsed, however late this wake-up was;
+         * every step is recorded, including catch-up steps never published */
+        uint32_t steps = data_simulator_advance(&ctx->simulator, physics_start,
+                                                record_data_step, &ctx->recorder);
+        uint64_t publish_start = get_timestamp_ns();
+        
+        if (steps > 0 || drained > 0) {
+            vehicle_snapshot_publish(&ctx->vehicle_snapshot, &ctx->simulator.current_data);
+            uint64_t publish_end = get_timestamp_ns();
+            uint64_t acquired_ns = ctx->simulator.current_data.acquired_ns;
+            
+            latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_SNAPSHOT],
+                                     publish_end - publish_start);
+            latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_AGE_PUBLISH],
+                                     publish_end > acquired_ns ? publish_end - acquired_ns : 0);
+        }
         
-        pthread_mutex_lock(&ctx->data_mutex);
-        data_simulator_update(&ctx->simulator, delta_time);
-        pthread_mutex_unlock(&ctx->data_mutex);
+        /* Data thread owns the physics and snapshot histograms */
+        latency_histogram_record(&perf->stage_latency[LATENCY_STAGE_PHYSICS],
+                                 publish_start - physics_start);
+        perf->data_update_time_ms = (float)(publish_start - physics_start) / 1000000.0f;
+        data_update_statistics(&ctx->simulator, perf->data_update_time_ms);
         
         ctx->performance.data_updates++;
         
-        nanosleep(&sleep_time, NULL);
+        periodic_task_wait(&ctx->data_task);
     }
     
     printf("Data thread terminated\n");
@@ -182,10 +457,16 @@ void *data_thread_main(void *arg) {
  */
 void *monitor_thread_main(void *arg) {
     dashboard_context_t *ctx = (dashboard_context_t *)arg;
-    struct timespec sleep_time = {0, MONITOR_UPDATE_INTERVAL_MS * 1000000};
     
     printf("Monitor thread started\n");
     
+    /* Attribute CPU time to each application thread */
+    resource_monitor_attach_thread(&ctx->resource_monitor, APP_THREAD_GUI, ctx->gui_thread);
+    resource_monitor_attach_thread(&ctx->resource_monitor, APP_THREAD_DATA, ctx->data_thread);
+    resource_monitor_attach_thread(&ctx->resource_monitor, APP_THREAD_MONITOR, pthread_self());
+    
+    periodic_task_start(&ctx->monitor_task);
+    
     while (ctx->running && !g_shutdown_requested) {
         /* Basic performance monitoring */
         static uint64_t last_frames = 0;
@@ -196,9 +477,33 @@ void *monitor_thread_main(void *arg) {
             ctx->performance.average_fps = (float)(ctx->performance.frames_rendered - last_frames);
             last_frames = ctx->performance.frames_rendered;
             last_time = current_time;
+            
+            /* Refresh tail latency once per second */
+            for (int i = 0; i < LATENCY_STAGE_COUNT; i++) {
+                latency_histogram_summarize(&ctx->performance.stage_latency[i],
+                                            &ctx->performance.stage_summary[i]);
+            }
         }
         
-        nanosleep(&sleep_time, NULL);
+        /* Deadline accounting across all periodic threads */
+        ctx->performance.missed_deadlines = periodic_task_overruns(&ctx->gui_task) +
+                                            periodic_task_overruns(&ctx->data_task) +
+                                            periodic_task_overruns(&ctx->monitor_task);
+        ctx->performance.frame_time_variance =
+            periodic_task_period_variance_ms2(&ctx->gui_task);
+        
+        /* Process and per-thread resource usage against configured limits */
+        bool over_limit = resource_monitor_sample(&ctx->resource_monitor,
+                                                  &ctx->performance.resources);
+        ctx->performance.memory_usage_kb = ctx->performance.resources.rss_kb;
+        ctx->performance.cpu_usage_percent = ctx->performance.resources.process_cpu_percent;
+        if (over_limit && !ctx->performance.performance_warning) {
+            fprintf(stderr, "Warning: Resource limit exceeded (RSS %u KB, CPU %.1f%%)\n",
+                    ctx->performance.memory_usage_kb, ctx->performance.cpu_usage_percent);
+        }
+        ctx->performance.performance_warning = over_limit;
+        
+        periodic_task_wait(&ctx->monitor_task);
     }
     
     printf("Monitor thread terminated\n");
@@ -210,22 +515,47 @@ void *monitor_thread_main(void *arg) {
  */
 int create_application_threads(void) {
     dashboard_context_t *ctx = &g_dashboard_context;
+    rt_thread_config_t configs[APP_THREAD_COUNT];
+    int result;
+    
+    setup_thread_priorities(configs);
     
-    if (pthread_create(&ctx->gui_thread, NULL, gui_thread_main, ctx) != 0) {
-        perror("Failed to create GUI thread");
+    /* Render workers run at the GUI thread's priority, next to its CPU */
+    if (ctx->render_threads > 1 &&
+        gui_manager_set_render_threads(&ctx->gui, ctx->render_threads, &configs[APP_THREAD_GUI]) != 0) {
+        printf("Warning: Rendering on the GUI thread only\n");
+    }
+    
+    result = rt_thread_create(&ctx->gui_thread, &configs[APP_THREAD_GUI], gui_thread_main,
+                              ctx, &ctx->thread_reports[APP_THREAD_GUI]);
+    if (result != 0) {
+        fprintf(stderr, "Failed to create GUI thread: %s\n", strerror(result));
         return -1;
     }
     
-    if (pthread_create(&ctx->data_thread, NULL, data_thread_main, ctx) != 0) {
-        perror("Failed to create data thread");
+    result = rt_thread_create(&ctx->data_thread, &configs[APP_THREAD_DATA], data_thread_main,
+                              ctx, &ctx->thread_reports[APP_THREAD_DATA]);
+    if (result != 0) {
+        fprintf(stderr, "Failed to create data thread: %s\n", strerror(result));
         return -1;
     }
     
-    if (pthread_create(&ctx->monitor_thread, NULL, monitor_thread_main, ctx) != 0) {
-        perror("Failed to create monitor thread");
+    result = rt_thread_create(&ctx->monitor_thread, &configs[APP_THREAD_MONITOR],
+                              monitor_thread_main, ctx,
+                              &ctx->thread_reports[APP_THREAD_MONITOR]);
+    if (result != 0) {
+        fprintf(stderr, "Failed to create monitor thread: %s\n", strerror(result));
         return -1;
     }
     
+    /* Report what actually took effect */
+    printf("Thread scheduling:\n");
+    for (int i = 0; i < APP_THREAD_COUNT; i++) {
+        rt_thread_print_report(&configs[i], &ctx->thread_reports[i]);
+    }
+    printf("  memory   %s\n", ctx->memory_lock_error == 0 ? "locked (mlockall)"
+                                                         : "not locked");
+    
     return 0;
 }
 
@@ -283,6 +613,7 @@ void dashboard_shutdown(void) {
     dashboard_set_state(STATE_SHUTTING_DOWN);
     g_shutdown_requested = 1;
     g_dashboard_context.running = false;
+    event_loop_stop(&g_dashboard_context.event_loop);
 }
 
 /**
@@ -295,6 +626,9 @@ void dashboard_cleanup(void) {
     
     gui_manager_cleanup(&ctx->gui);
     data_simulator_cleanup(&ctx->simulator);
+    recorder_close(&ctx->recorder);
+    resource_monitor_cleanup(&ctx->resource_monitor);
+    event_loop_cleanup(&ctx->event_loop);
     pthread_mutex_destroy(&ctx->data_mutex);
     
     printf("Cleanup complete.\n");
@@ -336,6 +670,9 @@ static void print_startup_banner(void) {
  * Process command line arguments
  */
 static int process_command_line_args(int argc, char *argv[]) {
+    sweep_init(&g_dashboard_context.sweep, 0);
+    strncpy(g_dashboard_context.sweep_file, "sweep.csv", sizeof(g_dashboard_context.sweep_file) - 1);
+    
     /* Simple argument processing */
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--debug") == 0) {
@@ -344,11 +681,60 @@ static int process_command_line_args(int argc, char *argv[]) {
         } else if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
             strncpy(g_dashboard_context.config_file, argv[++i], sizeof(g_dashboard_context.config_file) - 1);
             printf("Using config file: %s\n", g_dashboard_context.config_file);
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            strncpy(g_dashboard_context.replay_file, argv[++i], sizeof(g_dashboard_context.replay_file) - 1);
+            printf("Replaying: %s\n", g_dashboard_context.replay_file);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            strncpy(g_dashboard_context.record_file, argv[++i], sizeof(g_dashboard_context.record_file) - 1);
+            printf("Recording to: %s\n", g_dashboard_context.record_file);
+        } else if (strcmp(argv[i], "--framebuffer") == 0 && i + 1 < argc) {
+            strncpy(g_dashboard_context.framebuffer_output, argv[++i],
+                    sizeof(g_dashboard_context.framebuffer_output) - 1);
+        } else if (strcmp(argv[i], "--layout") == 0 && i + 1 < argc) {
+            strncpy(g_dashboard_context.layout_file, argv[++i], sizeof(g_dashboard_context.layout_file) - 1);
+        } else if (strcmp(argv[i], "--render-threads") == 0 && i + 1 < argc) {
+            g_dashboard_context.render_threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--resolution") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &g_dashboard_context.resolution_width,
+                       &g_dashboard_context.resolution_height) != 2 ||
+                g_dashboard_context.resolution_width <= 0 || g_dashboard_context.resolution_height <= 0 ||
+                g_dashboard_context.resolution_width > FRAMEBUFFER_MAX_DIMENSION ||
+                g_dashboard_context.resolution_height > FRAMEBUFFER_MAX_DIMENSION) {
+                fprintf(stderr, "Invalid resolution: %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--sweep") == 0 && i + 1 < argc) {
+            g_dashboard_context.sweep.runs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sweep-output") == 0 && i + 1 < argc) {
+            strncpy(g_dashboard_context.sweep_file, argv[++i], sizeof(g_dashboard_context.sweep_file) - 1);
+        } else if (strcmp(argv[i], "--sweep-duration") == 0 && i + 1 < argc) {
+            g_dashboard_context.sweep.duration_s = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--sweep-seed") == 0 && i + 1 < argc) {
+            g_dashboard_context.sweep.seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sweep-range") == 0 && i + 1 < argc) {
+            if (sweep_parse_range(&g_dashboard_context.sweep, argv[++i]) != 0) {
+                fprintf(stderr, "Invalid sweep range: %s\n", argv[i]);
+                return 1;
+            }
         } else if (strcmp(argv[i], "--help") == 0) {
             printf("Usage: %s [options]\n", argv[0]);
             printf("Options:\n");
             printf("  --debug           Enable debug mode\n");
             printf("  --config <file>   Specify configuration file\n");
+            printf("  --record <file>   Record vehicle data to a binary log\n");
+            printf("  --replay <file>   Play back a recording instead of simulating\n");
+            printf("  --framebuffer <target>    Present frames to memory (default), a raw\n");
+            printf("                            BGRA frame file or a /dev/fb device\n");
+            printf("  --layout <file>           Widget layout JSON (default built-in)\n");
+            printf("  --render-threads <n>      Rasterize screen tiles on n threads\n");
+            printf("  --resolution <w>x<h>      Framebuffer size (default 1024x768)\n");
+            printf("  --sweep <runs>    Run a headless Monte-Carlo parameter sweep and exit\n");
+            printf("  --sweep-output <file>     Sweep results CSV (default sweep.csv)\n");
+            printf("  --sweep-duration <s>      Simulated seconds per run\n");
+            printf("  --sweep-seed <n>          Seed for the sampled parameters\n");
+            printf("  --sweep-range <p>=<a>:<b> Sample parameter p in [a, b], one of\n");
+            printf("                            vehicle_mass_kg, drag_coefficient,\n");
+            printf("                            rolling_resistance, engine_power_kw\n");
             printf("  --help            Show this help message\n");
             return 1;
         }
@@ -356,14 +742,132 @@ static int process_command_line_args(int argc, char *argv[]) {
     return 0;
 }
 
+/**
+ * Run the configured sweep, write its CSV and print the summary
+ */
+static int run_parameter_sweep(dashboard_context_t *ctx) {
+    sweep_t *sweep = &ctx->sweep;
+    
+    if (sweep->duration_s <= 0.0f) {
+        fprintf(stderr, "Error: Sweep duration must be positive\n");
+        return 1;
+    }
+    
+    printf("Sweeping %u runs of %.0f s:\n", sweep->runs, sweep->duration_s);
+    for (int param = 0; param < SWEEP_PARAM_COUNT; param++) {
+        printf("  %-20s %g - %g\n", sweep_param_name((sweep_param_t)param),
+               sweep->range_min[param], sweep->range_max[param]);
+    }
+    
+    int result = sweep_run(sweep);
+    if (result == 0) {
+        result = sweep_write_csv(sweep, ctx->sweep_file);
+        sweep_print_summary(sweep);
+        if (result == 0) {
+            printf("Results written to %s\n", ctx->sweep_file);
+        }
+    }
+    
+    sweep_free(sweep);
+    return result == 0 ? 0 : 1;
+}
+
 /**
  * Setup thread priorities for real-time performance
  */
-static void setup_thread_priorities(void) {
-    /* Note: In a real QNX system, you would need appropriate privileges
-     * to set real-time thread priorities */
+static void setup_thread_priorities(rt_thread_config_t configs[APP_THREAD_COUNT]) {
+    /* Note: real-time policies need privileges; rt_thread_create() falls
+     * back to inherited scheduling and reports it when they are missing */
+    const performance_config_t *perf = &g_dashboard_config.performance;
+    bool use_config = g_dashboard_config.loaded;
+    
     printf("Setting up real-time thread priorities...\n");
-    printf("  GUI Thread Priority: %d\n", GUI_THREAD_PRIORITY);
-    printf("  Data Thread Priority: %d\n", DATA_THREAD_PRIORITY);
-    printf("  Monitor Thread Priority: %d\n", MONITOR_THREAD_PRIORITY);
-} 
\ No newline at end of file
+    
+    memset(configs, 0, sizeof(rt_thread_config_t) * APP_THREAD_COUNT);
+    
+    configs[APP_THREAD_GUI].name = "gui";
+    configs[APP_THREAD_GUI].policy =
+        rt_policy_from_string(use_config ? perf->gui_thread_policy : NULL, SCHED_FIFO);
+    configs[APP_THREAD_GUI].priority = use_config ? perf->gui_thread_priority : GUI_THREAD_PRIORITY;
+    configs[APP_THREAD_GUI].cpu = use_config ? perf->gui_thread_cpu : RT_NO_AFFINITY;
+    
+    configs[APP_THREAD_DATA].name = "data";
+    configs[APP_THREAD_DATA].policy =
+        rt_policy_from_string(use_config ? perf->data_thread_policy : NULL, SCHED_RR);
+    configs[APP_THREAD_DATA].priority = use_config ? perf->data_thread_priority : DATA_THREAD_PRIORITY;
+    configs[APP_THREAD_DATA].cpu = use_config ? perf->data_thread_cpu : RT_NO_AFFINITY;
+    
+    configs[APP_THREAD_MONITOR].name = "monitor";
+    configs[APP_THREAD_MONITOR].policy =
+        rt_policy_from_string(use_config ? perf->monitor_thread_policy : NULL, SCHED_RR);
+    configs[APP_THREAD_MONITOR].priority = use_config ? perf->monitor_thread_priority
+                                                      : MONITOR_THREAD_PRIORITY;
+    configs[APP_THREAD_MONITOR].cpu = use_config ? perf->monitor_thread_cpu : RT_NO_AFFINITY;
+    
+    for (int i = 0; i < APP_THREAD_COUNT; i++) {
+        configs[i].prefault_stack = true;
+    }
+}
+
+/**
+ * Setup periodic release schedules for the application threads
+ */
+static void setup_periodic_tasks(dashboard_context_t *ctx) {
+    const performance_config_t *perf = &g_dashboard_config.performance;
+    bool use_config = g_dashboard_config.loaded;
+    uint32_t gui_rate_hz = use_config ? (uint32_t)perf->gui_update_rate_hz : GUI_UPDATE_RATE_HZ;
+    
+    /* Configured rates; the data task releases once per physics step */
+    periodic_task_init(&ctx->gui_task, "gui", gui_rate_hz,
+                       periodic_policy_from_string(use_config ? perf->gui_deadline_policy : NULL,
+                                                   PERIODIC_POLICY_SKIP));
+    periodic_task_init(&ctx->data_task, "data", (uint32_t)ctx->simulator.update_rate_hz,
+                       periodic_policy_from_string(use_config ? perf->data_deadline_policy : NULL,
+                                                   PERIODIC_POLICY_CATCH_UP));
+    periodic_task_init(&ctx->monitor_task, "monitor",
+                       use_config ? (uint32_t)perf->monitor_update_rate_hz : MONITOR_UPDATE_RATE_HZ,
+                       periodic_policy_from_string(use_config ? perf->monitor_deadline_policy : NULL,
+                                                   PERIODIC_POLICY_SKIP));
+    
+    /* The GUI runs on the gui_task grid, every release or fewer */
+    frame_scheduler_init(&ctx->gui_scheduler, gui_rate_hz,
+                         use_config ? (uint32_t)perf->min_gui_rate_hz : GUI_MIN_RATE_HZ,
+                         use_config ? (uint32_t)perf->idle_gui_rate_hz : GUI_IDLE_RATE_HZ,
+                         use_config ? perf->adaptive_frame_rate : true);
+}
+
+/**
+ * Main event loop: GUI input is readable
+ */
+static bool handle_gui_input(int fd, void *user_data) {
+    dashboard_context_t *ctx = (dashboard_context_t *)user_data;
+    (void)fd;
+    
+    gui_manager_handle_events(&ctx->gui);
+    return gui_manager_get_event_fd(&ctx->gui) >= 0;
+}
+
+#ifdef USE_PHOTON
+/**
+ * Main event loop: dispatch Photon window events (close)
+ */
+static void handle_window_events(void *user_data) {
+    dashboard_context_t *ctx = (dashboard_context_t *)user_data;
+    
+    gui_manager_process_window_events(&ctx->gui);
+}
+#endif
+
+/**
+ * Main event loop: periodic configuration hot-reload check
+ */
+static void handle_config_timer(void *user_data) {
+    config_reload_if_changed((dashboard_config_t *)user_data);
+}
+
+/**
+ * Data thread: hand each simulation step to the recorder (lock-free)
+ */
+static void record_data_step(void *context, const vehicle_data_t *data) {
+    recorder_submit((recorder_t *)context, data);
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ * QNX Dashboard Simulator - Periodic Task Implementation
+ *
+ * Releases are computed as release(k+1) = release(k) + period on
+ * CLOCK_MONOTONIC and slept on with TIMER_ABSTIME, so the time spent doing
+ * work never accumulates as drift. Each activation's deadline is its next
+ * release (implicit deadline).
+ *
+ * Statistics are kept by the owning thread and published through a
+ * seqlock after every activation, so the monitor thread reads a
+ * consistent copy without locking the task.
+ */
+
+#include "../include/periodic_task.h"
+
+#define NSEC_PER_SEC 1000000000ULL
+
+static uint64_t timespec_to_ns(const struct timespec *ts) {
+    return (uint64_t)ts->tv_sec * NSEC_PER_SEC + (uint64_t)ts->tv_nsec;
+}
+
+static struct timespec ns_to_timespec(uint64_t ns) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(ns / NSEC_PER_SEC);
+    ts.tv_nsec = (long)(ns % NSEC_PER_SEC);
+    return ts;
+}
+
+static uint64_t monotonic_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return timespec_to_ns(&ts);
+}
+
+/**
+ * Initialize periodic task
+ */
+void periodic_task_init(periodic_task_t *task, const char *name,
+                        uint32_t rate_hz, periodic_policy_t policy) {
+    if (!task) return;
+
+    memset(task, 0, sizeof(periodic_task_t));
+    task->name = name ? name : "task";
+    task->period_ns = NSEC_PER_SEC / (rate_hz > 0 ? rate_hz : 1);
+    task->policy = policy < PERIODIC_POLICY_COUNT ? policy : PERIODIC_POLICY_SKIP;
+    task->max_catch_up = PERIODIC_DEFAULT_MAX_CATCH_UP;
+}
+
+/**
+ * Start task; the current time becomes the first release
+ */
+void periodic_task_start(periodic_task_t *task) {
+    if (!task) return;
+
+    clock_gettime(CLOCK_MONOTONIC, &task->release);
+    task->last_wakeup_ns = timespec_to_ns(&task->release);
+}
+
+/**
+ * Record release jitter (Welford's algorithm)
+ *
+ * Jitter is the actual interval since the previous wakeup minus the
+ * interval the schedule asked for, so deliberate multi-release strides
+ * and dropped releases do not count as variation.
+ */
+static void periodic_task_record_jitter(periodic_task_t *task, uint64_t wakeup_ns,
+                                        uint64_t expected_ns) {
+    double jitter_ms = ((double)(wakeup_ns - task->last_wakeup_ns) - (double)expected_ns) /
+                       1000000.0;
+    task->last_wakeup_ns = wakeup_ns;
+
+    task->jitter_samples++;
+    double delta = jitter_ms - task->jitter_mean_ms;
+    task->jitter_mean_ms += delta / (double)task->jitter_samples;
+    task->jitter_m2 += delta * (jitter_ms - task->jitter_mean_ms);
+
+    task->stats.jitter_mean_ms = (float)task->jitter_mean_ms;
+    task->stats.jitter_variance_ms2 = task->jitter_samples < 2 ? 0.0f :
+        (float)(task->jitter_m2 / (double)(task->jitter_samples - 1));
+}
+
+/**
+ * Publish the owning thread's statistics (single writer)
+ */
+static void periodic_task_publish(periodic_task_t *task) {
+    uint32_t seq = __atomic_load_n(&task->published_sequence, __ATOMIC_RELAXED);
+
+    /* Mark the copy busy before any store becomes visible */
+    __atomic_store_n(&task->published_sequence, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&task->published, &task->stats, sizeof(periodic_task_stats_t));
+
+    __atomic_store_n(&task->published_sequence, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * Finish the current activation and wait for the next release
+ *
+ * Returns the number of releases dropped by this call (skip policy or
+ * realignment after an excessive catch-up backlog).
+ */
+uint32_t periodic_task_wait(periodic_task_t *task) {
+    return periodic_task_wait_releases(task, 1);
+}
+
+/**
+ * Finish the current activation and sleep through releases - 1 releases
+ *
+ * The activation's deadline moves out with it, so a task that runs at a
+ * reduced rate stays on its original release grid.
+ */
+uint32_t periodic_task_wait_releases(periodic_task_t *task, uint32_t releases) {
+    if (!task) return 0;
+
+    uint64_t release_ns = timespec_to_ns(&task->release);
+    uint64_t next_ns = release_ns + task->period_ns * (releases > 0 ? releases : 1);
+    uint64_t now_ns = monotonic_now_ns();
+    uint32_t dropped = 0;
+
+    task->stats.activations++;
+
+    if (now_ns > next_ns) {
+        /* Work finished after this activation's deadline */
+        task->stats.overruns++;
+
+        uint64_t backlog = (now_ns - next_ns) / task->period_ns;
+        if (task->policy == PERIODIC_POLICY_SKIP ||
+            backlog >= task->max_catch_up) {
+            /* Drop every release that is already in the past */
+            dropped = (uint32_t)(backlog + 1);
+            next_ns += (uint64_t)dropped * task->period_ns;
+            task->stats.skipped += dropped;
+        }
+    }
+
+    if (next_ns > now_ns) {
+        struct timespec deadline = ns_to_timespec(next_ns);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+            /* Restart after signal delivery; the deadline is absolute */
+        }
+        now_ns = monotonic_now_ns();
+    }
+
+    /* Release latency: how late this activation starts */
+    uint64_t lateness_ns = now_ns > next_ns ? now_ns - next_ns : 0;
+    task->stats.total_lateness_ns += lateness_ns;
+    if (lateness_ns > task->stats.max_lateness_ns) {
+        task->stats.max_lateness_ns = lateness_ns;
+    }
+
+    periodic_task_record_jitter(task, now_ns, next_ns - release_ns);
+    task->release = ns_to_timespec(next_ns);
+    periodic_task_publish(task);
+
+    return dropped;
+}
+
+/**
+ * Statistics functions (safe from any thread)
+ */
+void periodic_task_read_statistics(const periodic_task_t *task, periodic_task_stats_t *out) {
+    if (!out) return;
+    if (!task) {
+        memset(out, 0, sizeof(periodic_task_stats_t));
+        return;
+    }
+
+    for (;;) {
+        uint32_t seq_begin = __atomic_load_n(&task->published_sequence, __ATOMIC_ACQUIRE);
+        if ((seq_begin & 1u) == 0) {
+            memcpy(out, (const void *)&task->published, sizeof(periodic_task_stats_t));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if (__atomic_load_n(&task->published_sequence, __ATOMIC_RELAXED) == seq_begin) {
+                return;
+            }
+        }
+    }
+}
+
+uint32_t periodic_task_overruns(const periodic_task_t *task) {
+    periodic_task_stats_t stats;
+    periodic_task_read_statistics(task, &stats);
+    return stats.overruns;
+}
+
+float periodic_task_period_variance_ms2(const periodic_task_t *task) {
+    periodic_task_stats_t stats;
+    periodic_task_read_statistics(task, &stats);
+    return stats.jitter_variance_ms2;
+}
+
+float periodic_task_average_lateness_ms(const periodic_task_t *task) {
+    periodic_task_stats_t stats;
+    periodic_task_read_statistics(task, &stats);
+    if (stats.activations == 0) return 0.0f;
+    return (float)((double)stats.total_lateness_ns / (double)stats.activations / 1000000.0);
+}
+
+void periodic_task_print_statistics(const periodic_task_t *task) {
+    if (!task) return;
+
+    periodic_task_stats_t stats;
+    periodic_task_read_statistics(task, &stats);
+
+    printf("=== Periodic Task '%s' ===\n", task->name);
+    printf("Period: %.3f ms (%s)\n", (double)task->period_ns / 1000000.0,
+           periodic_policy_to_string(task->policy));
+    printf("Activations: %llu\n", (unsigned long long)stats.activations);
+    printf("Overruns: %u, Skipped Releases: %u\n", stats.overruns, stats.skipped);
+    printf("Lateness: avg %.3f ms, max %.3f ms\n",
+           periodic_task_average_lateness_ms(task),
+           (double)stats.max_lateness_ns / 1000000.0);
+    printf("Release Jitter: mean %.3f ms, variance %.4f ms^2\n",
+           stats.jitter_mean_ms, stats.jitter_variance_ms2);
+}
+
+/**
+ * Utility functions
+ */
+periodic_policy_t periodic_policy_from_string(const char *name, periodic_policy_t fallback) {
+    if (!name) return fallback;
+    if (strcmp(name, "catch_up") == 0) return PERIODIC_POLICY_CATCH_UP;
+    if (strcmp(name, "skip") == 0) return PERIODIC_POLICY_SKIP;
+    return fallback;
+}
+
+const char *periodic_policy_to_string(periodic_policy_t policy) {
+    switch (policy) {
+        case PERIODIC_POLICY_CATCH_UP: return "catch_up";
+        case PERIODIC_POLICY_SKIP: return "skip";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,620 @@
+/**
+ * QNX Dashboard Simulator - Raster Kernels Implementation
+ *
+ * Anti-aliased spans for the software framebuffer. Each pixel gets the
+ * signed distance d from its centre to the shape's edge, a coverage of
+ * clamp(0.5 - d, 0, 1), and is blended towards the shape colour with an
+ * exact division by 255. The scalar kernels are the reference. The SSE2,
+ * AVX2 and NEON kernels perform the same IEEE operations in the same order
+ * on 4 or 8 pixels at a time, so every instruction set yields identical
+ * pixels (bench_raster checks this) as long as floating point is neither
+ * contracted nor reassociated, i.e. without -ffast-math.
+ *
+ * SSE2 is part of x86_64 and NEON of AArch64, so both are compile-time
+ * choices. AVX2 is compiled through a function target attribute next to
+ * SSE2 and only selected when the CPU reports it.
+ */
+
+#include "../include/raster.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define RASTER_HAVE_SSE2
+#endif
+#if defined(RASTER_HAVE_SSE2) && defined(__GNUC__)
+#include <immintrin.h>
+#define RASTER_HAVE_AVX2
+#define RASTER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define RASTER_HAVE_NEON
+#endif
+
+typedef struct {
+    void (*ring)(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring);
+    void (*capsule)(uint32_t *row, int x0, int x1, float py, const raster_capsule_t *capsule);
+    void (*fill)(uint32_t *row, int x0, int x1, uint32_t color);
+} raster_kernels_t;
+
+/**
+ * Per-row terms, computed once so every kernel starts from the same values
+ */
+typedef struct {
+    float fy;                  /* Ring: centre minus py (up); capsule: py minus start */
+    float fy2;
+    float start_term;          /* Ring sector edges */
+    float end_term;
+    float along;               /* Capsule: fy * dy */
+    float alpha;               /* Colour alpha, 0-255 */
+} raster_row_t;
+
+static inline float raster_max(float a, float b) {
+    return a > b ? a : b;
+}
+
+static inline float raster_min(float a, float b) {
+    return a < b ? a : b;
+}
+
+static inline void raster_ring_row(const raster_ring_t *ring, float py, raster_row_t *row) {
+    row->fy = ring->cy - py;
+    row->fy2 = row->fy * row->fy;
+    row->start_term = ring->start_x * row->fy;
+    row->end_term = row->fy * ring->end_x;
+    row->alpha = (float)(ring->color >> 24);
+}
+
+static inline void raster_capsule_row(const raster_capsule_t *capsule, float py, raster_row_t *row) {
+    row->fy = py - capsule->y0;
+    row->along = row->fy * capsule->dy;
+    row->alpha = (float)(capsule->color >> 24);
+}
+
+/**
+ * Scalar reference
+ */
+static inline int raster_alpha(float distance, float alpha) {
+    float coverage = clamp(0.5f - distance, 0.0f, 1.0f);
+    return (int)(coverage * alpha + 0.5f);
+}
+
+/* (src * a + dst * (255 - a)) / 255 per channel, rounded to nearest */
+static inline uint32_t raster_blend(uint32_t dst, uint32_t src, uint32_t alpha) {
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t mix = ((src >> shift) & 0xFF) * alpha + ((dst >> shift) & 0xFF) * (255 - alpha) + 128;
+        result |= ((mix + (mix >> 8)) >> 8) << shift;
+    }
+    return result;
+}
+
+static inline void raster_put(uint32_t *pixel, uint32_t color, int alpha) {
+    if (alpha >= 255) {
+        *pixel = color;
+    } else if (alpha > 0) {
+        *pixel = raster_blend(*pixel, color, (uint32_t)alpha);
+    }
+}
+
+static inline float raster_ring_distance(const raster_ring_t *ring, const raster_row_t *row, float px) {
+    float fx = px - ring->cx;
+    float radius = sqrtf(fx * fx + row->fy2);
+    float distance = raster_max(radius - ring->outer, ring->inner - radius);
+
+    if (ring->sector != RASTER_SECTOR_NONE) {
+        float outside_start = ring->start_y * fx - row->start_term;
+        float outside_end = row->end_term - ring->end_y * fx;
+        float outside = ring->sector == RASTER_SECTOR_REFLEX ? raster_min(outside_start, outside_end)
+                                                             : raster_max(outside_start, outside_end);
+        distance = raster_max(distance, outside);
+    }
+    return distance;
+}
+
+static inline float raster_capsule_distance(const raster_capsule_t *capsule, const raster_row_t *row,
+                                            float px) {
+    float fx = px - capsule->x0;
+    float t = clamp((fx * capsule->dx + row->along) * capsule->inv_length2, 0.0f, 1.0f);
+    float ox = fx - t * capsule->dx;
+    float oy = row->fy - t * capsule->dy;
+    return sqrtf(ox * ox + oy * oy) - capsule->half_width;
+}
+
+static void raster_ring_tail(uint32_t *row, int x0, int x1, const raster_ring_t *ring,
+                             const raster_row_t *terms) {
+    for (int x = x0; x < x1; x++) {
+        float distance = raster_ring_distance(ring, terms, (float)x + 0.5f);
+        raster_put(&row[x], ring->color, raster_alpha(distance, terms->alpha));
+    }
+}
+
+static void raster_capsule_tail(uint32_t *row, int x0, int x1, const raster_capsule_t *capsule,
+                                const raster_row_t *terms) {
+    for (int x = x0; x < x1; x++) {
+        float distance = raster_capsule_distance(capsule, terms, (float)x + 0.5f);
+        raster_put(&row[x], capsule->color, raster_alpha(distance, terms->alpha));
+    }
+}
+
+static void raster_ring_span_scalar(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring) {
+    raster_row_t terms;
+    raster_ring_row(ring, py, &terms);
+    raster_ring_tail(row, x0, x1, ring, &terms);
+}
+
+static void raster_capsule_span_scalar(uint32_t *row, int x0, int x1, float py,
+                                       const raster_capsule_t *capsule) {
+    raster_row_t terms;
+    raster_capsule_row(capsule, py, &terms);
+    raster_capsule_tail(row, x0, x1, capsule, &terms);
+}
+
+static void raster_fill_span_scalar(uint32_t *row, int x0, int x1, uint32_t color) {
+    for (int x = x0; x < x1; x++) {
+        raster_put(&row[x], color, (int)(color >> 24));
+    }
+}
+
+#ifdef RASTER_HAVE_SSE2
+/**
+ * SSE2: 4 pixels per step
+ */
+static inline __m128i raster_mix_sse2(__m128i dst, __m128i src, __m128i alpha) {
+    __m128i mix = _mm_add_epi16(_mm_mullo_epi16(src, alpha),
+                                _mm_mullo_epi16(dst, _mm_sub_epi16(_mm_set1_epi16(255), alpha)));
+    mix = _mm_add_epi16(mix, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(mix, _mm_srli_epi16(mix, 8)), 8);
+}
+
+static inline __m128i raster_alpha_sse2(__m128 distance, __m128 alpha) {
+    __m128 coverage = _mm_sub_ps(_mm_set1_ps(0.5f), distance);
+    coverage = _mm_min_ps(_mm_max_ps(coverage, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(coverage, alpha), _mm_set1_ps(0.5f)));
+}
+
+/* color16 is one pixel of color widened to 16 bits, twice */
+static inline void raster_blend4_sse2(uint32_t *pixels, __m128i alpha, uint32_t color, __m128i color16) {
+    const __m128i zero = _mm_setzero_si128();
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xFFFF) return;
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, _mm_set1_epi32(255))) == 0xFFFF) {
+        _mm_storeu_si128((__m128i *)pixels, _mm_set1_epi32((int)color));
+        return;
+    }
+
+    __m128i dst = _mm_loadu_si128((const __m128i *)pixels);
+    __m128i pairs = _mm_packs_epi32(alpha, alpha);
+    pairs = _mm_unpacklo_epi16(pairs, pairs);                  /* a0 a0 a1 a1 a2 a2 a3 a3 */
+    __m128i lo = raster_mix_sse2(_mm_unpacklo_epi8(dst, zero), color16, _mm_unpacklo_epi32(pairs, pairs));
+    __m128i hi = raster_mix_sse2(_mm_unpackhi_epi8(dst, zero), color16, _mm_unpackhi_epi32(pairs, pairs));
+    _mm_storeu_si128((__m128i *)pixels, _mm_packus_epi16(lo, hi));
+}
+
+static inline __m128 raster_centres_sse2(int x) {
+    __m128i columns = _mm_add_epi32(_mm_set1_epi32(x), _mm_setr_epi32(0, 1, 2, 3));
+    return _mm_add_ps(_mm_cvtepi32_ps(columns), _mm_set1_ps(0.5f));
+}
+
+static void raster_ring_span_sse2(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring) {
+    raster_row_t terms;
+    raster_ring_row(ring, py, &terms);
+
+    const __m128 cx = _mm_set1_ps(ring->cx);
+    const __m128 outer = _mm_set1_ps(ring->outer);
+    const __m128 inner = _mm_set1_ps(ring->inner);
+    const __m128 fy2 = _mm_set1_ps(terms.fy2);
+    const __m128 start_y = _mm_set1_ps(ring->start_y);
+    const __m128 start_term = _mm_set1_ps(terms.start_term);
+    const __m128 end_y = _mm_set1_ps(ring->end_y);
+    const __m128 end_term = _mm_set1_ps(terms.end_term);
+    const __m128 alpha = _mm_set1_ps(terms.alpha);
+    const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)ring->color), _mm_setzero_si128());
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        __m128 fx = _mm_sub_ps(raster_centres_sse2(x), cx);
+        __m128 radius = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(fx, fx), fy2));
+        __m128 distance = _mm_max_ps(_mm_sub_ps(radius, outer), _mm_sub_ps(inner, radius));
+
+        if (ring->sector != RASTER_SECTOR_NONE) {
+            __m128 outside_start = _mm_sub_ps(_mm_mul_ps(start_y, fx), start_term);
+            __m128 outside_end = _mm_sub_ps(end_term, _mm_mul_ps(end_y, fx));
+            __m128 outside = ring->sector == RASTER_SECTOR_REFLEX ? _mm_min_ps(outside_start, outside_end)
+                                                                  : _mm_max_ps(outside_start, outside_end);
+            distance = _mm_max_ps(distance, outside);
+        }
+        raster_blend4_sse2(row + x, raster_alpha_sse2(distance, alpha), ring->color, color16);
+    }
+    raster_ring_tail(row, x, x1, ring, &terms);
+}
+
+static void raster_capsule_span_sse2(uint32_t *row, int x0, int x1, float py,
+                                     const raster_capsule_t *capsule) {
+    raster_row_t terms;
+    raster_capsule_row(capsule, py, &terms);
+
+    const __m128 start_x = _mm_set1_ps(capsule->x0);
+    const __m128 dx = _mm_set1_ps(capsule->dx);
+    const __m128 dy = _mm_set1_ps(capsule->dy);
+    const __m128 fy = _mm_set1_ps(terms.fy);
+    const __m128 along = _mm_set1_ps(terms.along);
+    const __m128 inv_length2 = _mm_set1_ps(capsule->inv_length2);
+    const __m128 half_width = _mm_set1_ps(capsule->half_width);
+    const __m128 alpha = _mm_set1_ps(terms.alpha);
+    const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)capsule->color), _mm_setzero_si128());
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        __m128 fx = _mm_sub_ps(raster_centres_sse2(x), start_x);
+        __m128 t = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(fx, dx), along), inv_length2);
+        t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        __m128 ox = _mm_sub_ps(fx, _mm_mul_ps(t, dx));
+        __m128 oy = _mm_sub_ps(fy, _mm_mul_ps(t, dy));
+        __m128 distance = _mm_sub_ps(_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ox, ox), _mm_mul_ps(oy, oy))),
+                                     half_width);
+        raster_blend4_sse2(row + x, raster_alpha_sse2(distance, alpha), capsule->color, color16);
+    }
+    raster_capsule_tail(row, x, x1, capsule, &terms);
+}
+
+static void raster_fill_span_sse2(uint32_t *row, int x0, int x1, uint32_t color) {
+    const __m128i alpha = _mm_set1_epi32((int)(color >> 24));
+    const __m128i color16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)color), _mm_setzero_si128());
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        raster_blend4_sse2(row + x, alpha, color, color16);
+    }
+    raster_fill_span_scalar(row, x, x1, color);
+}
+#endif /* RASTER_HAVE_SSE2 */
+
+#ifdef RASTER_HAVE_AVX2
+/**
+ * AVX2: 8 pixels per step, then SSE2 for the rest of the span; unpack and
+ * pack work within 128-bit lanes. The SSE2 code is not VEX-encoded, so
+ * each kernel clears the upper halves of the ymm registers before handing
+ * over; GCC does not always insert vzeroupper before a tail call, and
+ * dirty upper halves make every later SSE instruction pay for the
+ * transition.
+ */
+static inline RASTER_TARGET_AVX2 __m256i raster_mix_avx2(__m256i dst, __m256i src, __m256i alpha) {
+    __m256i mix = _mm256_add_epi16(_mm256_mullo_epi16(src, alpha),
+                                   _mm256_mullo_epi16(dst, _mm256_sub_epi16(_mm256_set1_epi16(255), alpha)));
+    mix = _mm256_add_epi16(mix, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(mix, _mm256_srli_epi16(mix, 8)), 8);
+}
+
+static inline RASTER_TARGET_AVX2 __m256i raster_alpha_avx2(__m256 distance, __m256 alpha) {
+    __m256 coverage = _mm256_sub_ps(_mm256_set1_ps(0.5f), distance);
+    coverage = _mm256_min_ps(_mm256_max_ps(coverage, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(coverage, alpha), _mm256_set1_ps(0.5f)));
+}
+
+static inline RASTER_TARGET_AVX2 void raster_blend8_avx2(uint32_t *pixels, __m256i alpha, uint32_t color,
+                                                          __m256i color16) {
+    const __m256i zero = _mm256_setzero_si256();
+    if (_mm256_testz_si256(alpha, alpha)) return;
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(255))) == -1) {
+        _mm256_storeu_si256((__m256i *)pixels, _mm256_set1_epi32((int)color));
+        return;
+    }
+
+    __m256i dst = _mm256_loadu_si256((const __m256i *)pixels);
+    __m256i pairs = _mm256_packs_epi32(alpha, alpha);
+    pairs = _mm256_unpacklo_epi16(pairs, pairs);
+    __m256i lo = raster_mix_avx2(_mm256_unpacklo_epi8(dst, zero), color16,
+                                 _mm256_unpacklo_epi32(pairs, pairs));
+    __m256i hi = raster_mix_avx2(_mm256_unpackhi_epi8(dst, zero), color16,
+                                 _mm256_unpackhi_epi32(pairs, pairs));
+    _mm256_storeu_si256((__m256i *)pixels, _mm256_packus_epi16(lo, hi));
+}
+
+static inline RASTER_TARGET_AVX2 __m256 raster_centres_avx2(int x) {
+    __m256i columns = _mm256_add_epi32(_mm256_set1_epi32(x), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    return _mm256_add_ps(_mm256_cvtepi32_ps(columns), _mm256_set1_ps(0.5f));
+}
+
+static RASTER_TARGET_AVX2 void raster_ring_span_avx2(uint32_t *row, int x0, int x1, float py,
+                                                     const raster_ring_t *ring) {
+    raster_row_t terms;
+    raster_ring_row(ring, py, &terms);
+
+    const __m256 cx = _mm256_set1_ps(ring->cx);
+    const __m256 outer = _mm256_set1_ps(ring->outer);
+    const __m256 inner = _mm256_set1_ps(ring->inner);
+    const __m256 fy2 = _mm256_set1_ps(terms.fy2);
+    const __m256 start_y = _mm256_set1_ps(ring->start_y);
+    const __m256 start_term = _mm256_set1_ps(terms.start_term);
+    const __m256 end_y = _mm256_set1_ps(ring->end_y);
+    const __m256 end_term = _mm256_set1_ps(terms.end_term);
+    const __m256 alpha = _mm256_set1_ps(terms.alpha);
+    const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)ring->color), _mm256_setzero_si256());
+
+    int x = x0;
+    for (; x + 8 <= x1; x += 8) {
+        __m256 fx = _mm256_sub_ps(raster_centres_avx2(x), cx);
+        __m256 radius = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(fx, fx), fy2));
+        __m256 distance = _mm256_max_ps(_mm256_sub_ps(radius, outer), _mm256_sub_ps(inner, radius));
+
+        if (ring->sector != RASTER_SECTOR_NONE) {
+            __m256 outside_start = _mm256_sub_ps(_mm256_mul_ps(start_y, fx), start_term);
+            __m256 outside_end = _mm256_sub_ps(end_term, _mm256_mul_ps(end_y, fx));
+            __m256 outside = ring->sector == RASTER_SECTOR_REFLEX ? _mm256_min_ps(outside_start, outside_end)
+                                                                  : _mm256_max_ps(outside_start, outside_end);
+            distance = _mm256_max_ps(distance, outside);
+        }
+        raster_blend8_avx2(row + x, raster_alpha_avx2(distance, alpha), ring->color, color16);
+    }
+    _mm256_zeroupper();
+    raster_ring_span_sse2(row, x, x1, py, ring);
+}
+
+static RASTER_TARGET_AVX2 void raster_capsule_span_avx2(uint32_t *row, int x0, int x1, float py,
+                                                        const raster_capsule_t *capsule) {
+    raster_row_t terms;
+    raster_capsule_row(capsule, py, &terms);
+
+    const __m256 start_x = _mm256_set1_ps(capsule->x0);
+    const __m256 dx = _mm256_set1_ps(capsule->dx);
+    const __m256 dy = _mm256_set1_ps(capsule->dy);
+    const __m256 fy = _mm256_set1_ps(terms.fy);
+    const __m256 along = _mm256_set1_ps(terms.along);
+    const __m256 inv_length2 = _mm256_set1_ps(capsule->inv_length2);
+    const __m256 half_width = _mm256_set1_ps(capsule->half_width);
+    const __m256 alpha = _mm256_set1_ps(terms.alpha);
+    const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)capsule->color),
+                                                 _mm256_setzero_si256());
+
+    int x = x0;
+    for (; x + 8 <= x1; x += 8) {
+        __m256 fx = _mm256_sub_ps(raster_centres_avx2(x), start_x);
+        __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(fx, dx), along), inv_length2);
+        t = _mm256_min_ps(_mm256_max_ps(t, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+        __m256 ox = _mm256_sub_ps(fx, _mm256_mul_ps(t, dx));
+        __m256 oy = _mm256_sub_ps(fy, _mm256_mul_ps(t, dy));
+        __m256 distance = _mm256_sub_ps(_mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(ox, ox),
+                                                                     _mm256_mul_ps(oy, oy))),
+                                        half_width);
+        raster_blend8_avx2(row + x, raster_alpha_avx2(distance, alpha), capsule->color, color16);
+    }
+    _mm256_zeroupper();
+    raster_capsule_span_sse2(row, x, x1, py, capsule);
+}
+
+static RASTER_TARGET_AVX2 void raster_fill_span_avx2(uint32_t *row, int x0, int x1, uint32_t color) {
+    const __m256i alpha = _mm256_set1_epi32((int)(color >> 24));
+    const __m256i color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)color), _mm256_setzero_si256());
+
+    int x = x0;
+    for (; x + 8 <= x1; x += 8) {
+        raster_blend8_avx2(row + x, alpha, color, color16);
+    }
+    _mm256_zeroupper();
+    raster_fill_span_sse2(row, x, x1, color);
+}
+#endif /* RASTER_HAVE_AVX2 */
+
+#ifdef RASTER_HAVE_NEON
+/**
+ * NEON: 4 pixels per step
+ */
+static inline uint16x8_t raster_mix_neon(uint16x8_t dst, uint16x8_t src, uint16x8_t alpha) {
+    uint16x8_t mix = vaddq_u16(vmulq_u16(src, alpha), vmulq_u16(dst, vsubq_u16(vdupq_n_u16(255), alpha)));
+    mix = vaddq_u16(mix, vdupq_n_u16(128));
+    return vshrq_n_u16(vaddq_u16(mix, vshrq_n_u16(mix, 8)), 8);
+}
+
+static inline uint32x4_t raster_alpha_neon(float32x4_t distance, float32x4_t alpha) {
+    float32x4_t coverage = vsubq_f32(vdupq_n_f32(0.5f), distance);
+    coverage = vminq_f32(vmaxq_f32(coverage, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+    return vreinterpretq_u32_s32(vcvtq_s32_f32(vaddq_f32(vmulq_f32(coverage, alpha), vdupq_n_f32(0.5f))));
+}
+
+static inline void raster_blend4_neon(uint32_t *pixels, uint32x4_t alpha, uint32_t color, uint16x8_t color16) {
+    if (vmaxvq_u32(alpha) == 0) return;
+    if (vminvq_u32(alpha) == 255) {
+        vst1q_u32(pixels, vdupq_n_u32(color));
+        return;
+    }
+
+    uint8x16_t dst = vld1q_u8((const uint8_t *)pixels);
+    uint16x4_t narrow = vmovn_u32(alpha);
+    uint16x8_t pairs = vzip1q_u16(vcombine_u16(narrow, narrow), vcombine_u16(narrow, narrow));
+    uint32x4_t wide = vreinterpretq_u32_u16(pairs);
+    uint16x8_t lo = raster_mix_neon(vmovl_u8(vget_low_u8(dst)), color16,
+                                    vreinterpretq_u16_u32(vzip1q_u32(wide, wide)));
+    uint16x8_t hi = raster_mix_neon(vmovl_u8(vget_high_u8(dst)), color16,
+                                    vreinterpretq_u16_u32(vzip2q_u32(wide, wide)));
+    vst1q_u8((uint8_t *)pixels, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+}
+
+static inline float32x4_t raster_centres_neon(int x) {
+    static const int32_t lanes[4] = {0, 1, 2, 3};
+    int32x4_t columns = vaddq_s32(vdupq_n_s32(x), vld1q_s32(lanes));
+    return vaddq_f32(vcvtq_f32_s32(columns), vdupq_n_f32(0.5f));
+}
+
+static inline uint16x8_t raster_color_neon(uint32_t color) {
+    return vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(color)));
+}
+
+static void raster_ring_span_neon(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring) {
+    raster_row_t terms;
+    raster_ring_row(ring, py, &terms);
+
+    const float32x4_t cx = vdupq_n_f32(ring->cx);
+    const float32x4_t outer = vdupq_n_f32(ring->outer);
+    const float32x4_t inner = vdupq_n_f32(ring->inner);
+    const float32x4_t fy2 = vdupq_n_f32(terms.fy2);
+    const float32x4_t start_y = vdupq_n_f32(ring->start_y);
+    const float32x4_t start_term = vdupq_n_f32(terms.start_term);
+    const float32x4_t end_y = vdupq_n_f32(ring->end_y);
+    const float32x4_t end_term = vdupq_n_f32(terms.end_term);
+    const float32x4_t alpha = vdupq_n_f32(terms.alpha);
+    const uint16x8_t color16 = raster_color_neon(ring->color);
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        float32x4_t fx = vsubq_f32(raster_centres_neon(x), cx);
+        float32x4_t radius = vsqrtq_f32(vaddq_f32(vmulq_f32(fx, fx), fy2));
+        float32x4_t distance = vmaxq_f32(vsubq_f32(radius, outer), vsubq_f32(inner, radius));
+
+        if (ring->sector != RASTER_SECTOR_NONE) {
+            float32x4_t outside_start = vsubq_f32(vmulq_f32(start_y, fx), start_term);
+            float32x4_t outside_end = vsubq_f32(end_term, vmulq_f32(end_y, fx));
+            float32x4_t outside = ring->sector == RASTER_SECTOR_REFLEX ? vminq_f32(outside_start, outside_end)
+                                                                       : vmaxq_f32(outside_start, outside_end);
+            distance = vmaxq_f32(distance, outside);
+        }
+        raster_blend4_neon(row + x, raster_alpha_neon(distance, alpha), ring->color, color16);
+    }
+    raster_ring_tail(row, x, x1, ring, &terms);
+}
+
+static void raster_capsule_span_neon(uint32_t *row, int x0, int x1, float py,
+                                     const raster_capsule_t *capsule) {
+    raster_row_t terms;
+    raster_capsule_row(capsule, py, &terms);
+
+    const float32x4_t start_x = vdupq_n_f32(capsule->x0);
+    const float32x4_t dx = vdupq_n_f32(capsule->dx);
+    const float32x4_t dy = vdupq_n_f32(capsule->dy);
+    const float32x4_t fy = vdupq_n_f32(terms.fy);
+    const float32x4_t along = vdupq_n_f32(terms.along);
+    const float32x4_t inv_length2 = vdupq_n_f32(capsule->inv_length2);
+    const float32x4_t half_width = vdupq_n_f32(capsule->half_width);
+    const float32x4_t alpha = vdupq_n_f32(terms.alpha);
+    const uint16x8_t color16 = raster_color_neon(capsule->color);
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        float32x4_t fx = vsubq_f32(raster_centres_neon(x), start_x);
+        float32x4_t t = vmulq_f32(vaddq_f32(vmulq_f32(fx, dx), along), inv_length2);
+        t = vminq_f32(vmaxq_f32(t, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+        float32x4_t ox = vsubq_f32(fx, vmulq_f32(t, dx));
+        float32x4_t oy = vsubq_f32(fy, vmulq_f32(t, dy));
+        float32x4_t distance = vsubq_f32(vsqrtq_f32(vaddq_f32(vmulq_f32(ox, ox), vmulq_f32(oy, oy))),
+                                         half_width);
+        raster_blend4_neon(row + x, raster_alpha_neon(distance, alpha), capsule->color, color16);
+    }
+    raster_capsule_tail(row, x, x1, capsule, &terms);
+}
+
+static void raster_fill_span_neon(uint32_t *row, int x0, int x1, uint32_t color) {
+    const uint32x4_t alpha = vdupq_n_u32(color >> 24);
+    const uint16x8_t color16 = raster_color_neon(color);
+
+    int x = x0;
+    for (; x + 4 <= x1; x += 4) {
+        raster_blend4_neon(row + x, alpha, color, color16);
+    }
+    raster_fill_span_scalar(row, x, x1, color);
+}
+#endif /* RASTER_HAVE_NEON */
+
+/**
+ * Kernel tables; instruction sets missing from this build stay empty
+ */
+static const raster_kernels_t RASTER_KERNELS[RASTER_ISA_COUNT] = {
+    [RASTER_ISA_SCALAR] = { raster_ring_span_scalar, raster_capsule_span_scalar, raster_fill_span_scalar },
+#ifdef RASTER_HAVE_SSE2
+    [RASTER_ISA_SSE2] = { raster_ring_span_sse2, raster_capsule_span_sse2, raster_fill_span_sse2 },
+#endif
+#ifdef RASTER_HAVE_AVX2
+    [RASTER_ISA_AVX2] = { raster_ring_span_avx2, raster_capsule_span_avx2, raster_fill_span_avx2 },
+#endif
+#ifdef RASTER_HAVE_NEON
+    [RASTER_ISA_NEON] = { raster_ring_span_neon, raster_capsule_span_neon, raster_fill_span_neon },
+#endif
+};
+
+static const raster_kernels_t *g_raster_kernels = NULL;
+static raster_isa_t g_raster_isa = RASTER_ISA_SCALAR;
+static pthread_once_t g_raster_default_once = PTHREAD_ONCE_INIT;
+
+static void raster_select_default(void) {
+    if (!__atomic_load_n(&g_raster_kernels, __ATOMIC_ACQUIRE)) {
+        raster_set_isa(raster_best_isa());
+    }
+}
+
+/**
+ * Kernels in use; render pool workers may be the first to ask, so the
+ * default is chosen exactly once
+ */
+static inline const raster_kernels_t *raster_active(void) {
+    const raster_kernels_t *kernels = __atomic_load_n(&g_raster_kernels, __ATOMIC_ACQUIRE);
+    if (!kernels) {
+        pthread_once(&g_raster_default_once, raster_select_default);
+        kernels = __atomic_load_n(&g_raster_kernels, __ATOMIC_ACQUIRE);
+    }
+    return kernels;
+}
+
+/**
+ * Span kernels
+ */
+void raster_ring_span(uint32_t *row, int x0, int x1, float py, const raster_ring_t *ring) {
+    if (x0 < x1) raster_active()->ring(row, x0, x1, py, ring);
+}
+
+void raster_capsule_span(uint32_t *row, int x0, int x1, float py, const raster_capsule_t *capsule) {
+    if (x0 < x1) raster_active()->capsule(row, x0, x1, py, capsule);
+}
+
+void raster_fill_span(uint32_t *row, int x0, int x1, uint32_t color) {
+    if (x0 < x1) raster_active()->fill(row, x0, x1, color);
+}
+
+/**
+ * Kernel selection
+ *
+ * The first span uses raster_best_isa(); benchmarks switch explicitly to
+ * compare instruction sets. Not meant to change while frames render.
+ */
+int raster_set_isa(raster_isa_t isa) {
+    if (!raster_isa_available(isa)) return -1;
+
+    g_raster_isa = isa;
+    __atomic_store_n(&g_raster_kernels, &RASTER_KERNELS[isa], __ATOMIC_RELEASE);
+    return 0;
+}
+
+raster_isa_t raster_get_isa(void) {
+    raster_active();
+    return g_raster_isa;
+}
+
+raster_isa_t raster_best_isa(void) {
+    static const raster_isa_t preference[] = {
+        RASTER_ISA_AVX2, RASTER_ISA_SSE2, RASTER_ISA_NEON
+    };
+
+    for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); i++) {
+        if (raster_isa_available(preference[i])) return preference[i];
+    }
+    return RASTER_ISA_SCALAR;
+}
+
+bool raster_isa_available(raster_isa_t isa) {
+    if ((unsigned)isa >= RASTER_ISA_COUNT || !RASTER_KERNELS[isa].ring) return false;
+
+#ifdef RASTER_HAVE_AVX2
+    if (isa == RASTER_ISA_AVX2) {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }
+#endif
+    return true;
+}
+
+const char *raster_isa_to_string(raster_isa_t isa) {
+    switch (isa) {
+        case RASTER_ISA_SCALAR: return "scalar";
+        case RASTER_ISA_SSE2: return "SSE2";
+        case RASTER_ISA_AVX2: return "AVX2";
+        case RASTER_ISA_NEON: return "NEON";
+        default: return "unknown";
+    }
+}
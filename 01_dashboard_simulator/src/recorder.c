@@ -0,0 +1,400 @@
+/**
+ * QNX Dashboard Simulator - Vehicle Data Recorder Implementation
+ *
+ * recorder_submit() is the only call on the data thread: it encodes one
+ * 48-byte record into the ring and publishes it with a release store, so
+ * the producer never makes a system call or waits on the writer. The
+ * writer thread runs below every other thread (SCHED_IDLE where it exists,
+ * else the lowest SCHED_OTHER priority), wakes every
+ * RECORDER_WRITER_PERIOD_MS, and batches records into
+ * RECORDER_WRITE_BUFFER_BYTES writes. The ring absorbs fsync stalls and
+ * writer starvation of several seconds at 1 kHz.
+ */
+
+#include <fcntl.h>
+#include "../include/recorder.h"
+#include "../include/rt_thread.h"
+
+#define RECORDER_RING_MASK (RECORDER_RING_CAPACITY - 1)
+
+#if (RECORDER_RING_CAPACITY & RECORDER_RING_MASK) != 0
+#error "RECORDER_RING_CAPACITY must be a power of two"
+#endif
+
+/* The on-disk layout must not depend on compiler padding */
+typedef char recorder_header_size_check[sizeof(vehicle_record_header_t) == 64 ? 1 : -1];
+typedef char recorder_record_size_check[sizeof(vehicle_record_t) == 48 ? 1 : -1];
+
+static uint64_t clock_now_ns(clockid_t clock_id) {
+    struct timespec ts;
+    clock_gettime(clock_id, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Write all bytes, retrying short writes and EINTR
+ */
+static int write_fully(int fd, const uint8_t *data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return 0;
+}
+
+static void recorder_flush_buffer(recorder_t *rec) {
+    if (rec->buffered_bytes == 0) return;
+
+    if (rec->write_error == 0) {
+        uint64_t start = clock_now_ns(CLOCK_MONOTONIC);
+        rec->write_error = write_fully(rec->fd, rec->write_buffer, rec->buffered_bytes);
+        uint64_t elapsed = clock_now_ns(CLOCK_MONOTONIC) - start;
+
+        if (elapsed > rec->max_write_ns) rec->max_write_ns = elapsed;
+        rec->write_calls++;
+        if (rec->write_error == 0) {
+            rec->bytes_written += rec->buffered_bytes;
+            rec->records_written += rec->buffered_bytes / sizeof(vehicle_record_t);
+        } else {
+            fprintf(stderr, "Recorder: write to %s failed: %s\n",
+                    rec->path, strerror(rec->write_error));
+        }
+    }
+    rec->buffered_bytes = 0;
+}
+
+static void recorder_sync(recorder_t *rec) {
+    if (rec->write_error != 0) return;
+
+    uint64_t start = clock_now_ns(CLOCK_MONOTONIC);
+    int error = 0;
+    while (fsync(rec->fd) != 0) {
+        error = errno;
+        if (error != EINTR) break;
+        error = 0; /* Interrupted before the data reached the device; sync again */
+    }
+    uint64_t elapsed = clock_now_ns(CLOCK_MONOTONIC) - start;
+
+    /* EINVAL: a pipe or device that cannot be synchronized, nothing is lost */
+    if (error != 0 && error != EINVAL) {
+        rec->write_error = error;
+        fprintf(stderr, "Recorder: sync of %s failed: %s\n", rec->path, strerror(rec->write_error));
+    }
+
+    if (elapsed > rec->max_fsync_ns) rec->max_fsync_ns = elapsed;
+    rec->fsync_calls++;
+}
+
+/**
+ * Remember where every RECORDER_INDEX_INTERVAL-th record lands in the file
+ */
+static void recorder_index_records(recorder_t *rec, const vehicle_record_t *records,
+                                   size_t count) {
+    uint64_t file_record = rec->records_written + rec->buffered_bytes / sizeof(vehicle_record_t);
+
+    for (size_t i = 0; i < count; i++) {
+        if ((file_record + i) % RECORDER_INDEX_INTERVAL != 0) continue;
+
+        if (rec->index_count == rec->index_capacity) {
+            uint32_t capacity = rec->index_capacity ? rec->index_capacity * 2 : 256;
+            vehicle_record_index_t *grown =
+                realloc(rec->index, capacity * sizeof(vehicle_record_index_t));
+            if (!grown) return; /* Playback falls back to searching the records */
+            rec->index = grown;
+            rec->index_capacity = capacity;
+        }
+        rec->index[rec->index_count].acquired_ns = records[i].acquired_ns;
+        rec->index[rec->index_count].record = file_record + i;
+        rec->index_count++;
+    }
+}
+
+/**
+ * Append the sparse index and trailer after the last record
+ */
+static void recorder_write_index(recorder_t *rec) {
+    if (rec->write_error != 0) return;
+
+    vehicle_record_trailer_t trailer;
+    memset(&trailer, 0, sizeof(trailer));
+    trailer.index_offset = sizeof(vehicle_record_header_t) +
+                           rec->records_written * sizeof(vehicle_record_t);
+    trailer.entry_count = rec->index_count;
+    trailer.interval = RECORDER_INDEX_INTERVAL;
+    trailer.magic = RECORDER_INDEX_MAGIC;
+
+    rec->write_error = write_fully(rec->fd, (const uint8_t *)rec->index,
+                                   rec->index_count * sizeof(vehicle_record_index_t));
+    if (rec->write_error == 0) {
+        rec->write_error = write_fully(rec->fd, (const uint8_t *)&trailer, sizeof(trailer));
+    }
+    if (rec->write_error == 0) {
+        rec->bytes_written += rec->index_count * sizeof(vehicle_record_index_t) + sizeof(trailer);
+    }
+}
+
+/**
+ * Move everything queued into the write buffer, flushing when it fills
+ */
+static void recorder_drain(recorder_t *rec) {
+    const size_t buffer_records = RECORDER_WRITE_BUFFER_BYTES / sizeof(vehicle_record_t);
+    uint32_t tail = __atomic_load_n(&rec->tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&rec->head, __ATOMIC_ACQUIRE);
+
+    while (tail != head) {
+        size_t space = buffer_records - rec->buffered_bytes / sizeof(vehicle_record_t);
+        size_t contiguous = RECORDER_RING_CAPACITY - (tail & RECORDER_RING_MASK);
+        size_t count = head - tail;
+        if (count > contiguous) count = contiguous;
+        if (count > space) count = space;
+
+        recorder_index_records(rec, &rec->records[tail & RECORDER_RING_MASK], count);
+        memcpy(rec->write_buffer + rec->buffered_bytes,
+               &rec->records[tail & RECORDER_RING_MASK],
+               count * sizeof(vehicle_record_t));
+        rec->buffered_bytes += count * sizeof(vehicle_record_t);
+        tail += (uint32_t)count;
+
+        /* Hand the slots back before the (possibly slow) write */
+        __atomic_store_n(&rec->tail, tail, __ATOMIC_RELEASE);
+
+        if (rec->buffered_bytes + sizeof(vehicle_record_t) > RECORDER_WRITE_BUFFER_BYTES) {
+            recorder_flush_buffer(rec);
+        }
+    }
+}
+
+static void *recorder_writer_main(void *arg) {
+    recorder_t *rec = (recorder_t *)arg;
+    struct timespec next;
+    uint64_t last_sync_ns = clock_now_ns(CLOCK_MONOTONIC);
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (rec->writer_running) {
+        next.tv_nsec += RECORDER_WRITER_PERIOD_MS * 1000000L;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        recorder_drain(rec);
+
+        uint64_t now_ns = clock_now_ns(CLOCK_MONOTONIC);
+        if (now_ns - last_sync_ns >= RECORDER_FSYNC_INTERVAL_MS * 1000000ULL) {
+            recorder_flush_buffer(rec);
+            recorder_sync(rec);
+            last_sync_ns = now_ns;
+        }
+    }
+
+    /* Producer has stopped: persist whatever is left, then the index */
+    recorder_drain(rec);
+    recorder_flush_buffer(rec);
+    recorder_write_index(rec);
+    recorder_sync(rec);
+    return NULL;
+}
+
+/**
+ * Create the recording file and start the writer thread
+ */
+int recorder_open(recorder_t *rec, const char *path, uint32_t sample_rate_hz) {
+    if (!rec || !path) return -1;
+
+    memset(rec, 0, sizeof(recorder_t));
+    rec->fd = -1;
+    strncpy(rec->path, path, sizeof(rec->path) - 1);
+
+    rec->write_buffer = malloc(RECORDER_WRITE_BUFFER_BYTES);
+    if (!rec->write_buffer) {
+        fprintf(stderr, "Recorder: out of memory\n");
+        return -1;
+    }
+
+    rec->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (rec->fd < 0) {
+        fprintf(stderr, "Recorder: cannot open %s: %s\n", path, strerror(errno));
+        free(rec->write_buffer);
+        rec->write_buffer = NULL;
+        return -1;
+    }
+
+    vehicle_record_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = RECORDER_MAGIC;
+    header.version = RECORDER_FORMAT_VERSION;
+    header.header_size = sizeof(vehicle_record_header_t);
+    header.record_size = sizeof(vehicle_record_t);
+    header.sample_rate_hz = sample_rate_hz;
+    header.start_realtime_ns = clock_now_ns(CLOCK_REALTIME);
+    header.start_monotonic_ns = clock_now_ns(CLOCK_MONOTONIC);
+
+    int error = write_fully(rec->fd, (const uint8_t *)&header, sizeof(header));
+    if (error != 0) {
+        fprintf(stderr, "Recorder: cannot write header to %s: %s\n", path, strerror(error));
+        close(rec->fd);
+        free(rec->write_buffer);
+        rec->fd = -1;
+        rec->write_buffer = NULL;
+        return -1;
+    }
+    rec->bytes_written = sizeof(header);
+
+    /* Writer must never preempt the real-time threads, nor the GUI */
+    rt_thread_config_t config;
+    rt_thread_report_t report;
+    memset(&config, 0, sizeof(config));
+    config.name = "recorder";
+#ifdef SCHED_IDLE
+    config.policy = SCHED_IDLE;
+#else
+    config.policy = SCHED_OTHER;
+    config.priority = sched_get_priority_min(SCHED_OTHER);
+#endif
+    config.cpu = RT_NO_AFFINITY;
+
+    rec->writer_running = 1;
+    error = rt_thread_create(&rec->writer_thread, &config, recorder_writer_main, rec, &report);
+    if (error != 0) {
+        fprintf(stderr, "Recorder: cannot start writer thread: %s\n", strerror(error));
+        rec->writer_running = 0;
+        close(rec->fd);
+        free(rec->write_buffer);
+        rec->fd = -1;
+        rec->write_buffer = NULL;
+        return -1;
+    }
+
+    rec->open = true;
+    printf("Recording vehicle data to %s\n", path);
+    return 0;
+}
+
+/**
+ * Queue one sample (single producer only, never blocks)
+ *
+ * Returns false if the sample was dropped because the ring is full.
+ */
+bool recorder_submit(recorder_t *rec, const vehicle_data_t *data) {
+    if (!rec || !rec->open || !data) return false;
+
+    uint32_t sequence = rec->next_sequence++;
+    uint32_t head = __atomic_load_n(&rec->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&rec->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= RECORDER_RING_CAPACITY) {
+        rec->dropped++;
+        return false;
+    }
+
+    recorder_encode(data, sequence, &rec->records[head & RECORDER_RING_MASK]);
+    __atomic_store_n(&rec->head, head + 1, __ATOMIC_RELEASE);
+    rec->submitted++;
+    return true;
+}
+
+/**
+ * Stop the writer, flush and close the file
+ *
+ * The producer must have stopped submitting before this is called.
+ */
+void recorder_close(recorder_t *rec) {
+    if (!rec || !rec->open) return;
+
+    rec->writer_running = 0;
+    pthread_join(rec->writer_thread, NULL);
+
+    close(rec->fd);
+    free(rec->write_buffer);
+    free(rec->index);
+    rec->fd = -1;
+    rec->write_buffer = NULL;
+    rec->index = NULL;
+    rec->open = false;
+}
+
+/**
+ * Record encoding
+ */
+void recorder_encode(const vehicle_data_t *data, uint32_t sequence, vehicle_record_t *record) {
+    record->acquired_ns = data->acquired_ns;
+    record->sequence = sequence;
+    record->speed_kmh = data->speed_kmh;
+    record->rpm = data->rpm;
+    record->acceleration = data->acceleration;
+    record->fuel_level = data->fuel_level;
+    record->engine_temp = data->engine_temp;
+    record->oil_pressure = data->oil_pressure;
+    record->battery_voltage = data->battery_voltage;
+    record->alternator_current = data->alternator_current;
+    record->gear_position = (int8_t)data->gear_position;
+    record->flags = (uint8_t)((data->ignition_on ? VEHICLE_RECORD_FLAG_IGNITION : 0) |
+                              (data->engine_running ? VEHICLE_RECORD_FLAG_ENGINE_RUNNING : 0) |
+                              (data->parking_brake ? VEHICLE_RECORD_FLAG_PARKING_BRAKE : 0) |
+                              (data->seatbelt_fastened ? VEHICLE_RECORD_FLAG_SEATBELT : 0) |
+                              (data->data_valid ? VEHICLE_RECORD_FLAG_VALID : 0));
+    record->reserved = 0;
+}
+
+void recorder_decode(const vehicle_record_t *record, vehicle_data_t *data) {
+    memset(data, 0, sizeof(vehicle_data_t));
+    data->acquired_ns = record->acquired_ns;
+    data->speed_kmh = record->speed_kmh;
+    data->rpm = record->rpm;
+    data->acceleration = record->acceleration;
+    data->fuel_level = record->fuel_level;
+    data->engine_temp = record->engine_temp;
+    data->oil_pressure = record->oil_pressure;
+    data->battery_voltage = record->battery_voltage;
+    data->alternator_current = record->alternator_current;
+    data->gear_position = record->gear_position;
+    data->ignition_on = (record->flags & VEHICLE_RECORD_FLAG_IGNITION) != 0;
+    data->engine_running = (record->flags & VEHICLE_RECORD_FLAG_ENGINE_RUNNING) != 0;
+    data->parking_brake = (record->flags & VEHICLE_RECORD_FLAG_PARKING_BRAKE) != 0;
+    data->seatbelt_fastened = (record->flags & VEHICLE_RECORD_FLAG_SEATBELT) != 0;
+    data->data_valid = (record->flags & VEHICLE_RECORD_FLAG_VALID) != 0;
+}
+
+/**
+ * Check that a header describes a file this build can read
+ *
+ * Returns 0 if compatible, -1 otherwise.
+ */
+int recorder_validate_header(const vehicle_record_header_t *header) {
+    if (!header) return -1;
+    if (header->magic != RECORDER_MAGIC) return -1;
+    if (header->version == 0 || header->version > RECORDER_FORMAT_VERSION) return -1;
+    if (header->header_size < sizeof(vehicle_record_header_t)) return -1;
+    if (header->record_size != sizeof(vehicle_record_t)) return -1;
+    return 0;
+}
+
+/**
+ * Statistics functions
+ */
+void recorder_print_statistics(const recorder_t *rec) {
+    if (!rec) return;
+
+    printf("=== Vehicle Data Recorder ===\n");
+    printf("File: %s\n", rec->path[0] ? rec->path : "(none)");
+    printf("Submitted: %llu, Written: %llu, Dropped: %llu\n",
+           (unsigned long long)rec->submitted,
+           (unsigned long long)rec->records_written,
+           (unsigned long long)rec->dropped);
+    printf("Bytes: %llu in %llu writes, %llu fsyncs\n",
+           (unsigned long long)rec->bytes_written,
+           (unsigned long long)rec->write_calls,
+           (unsigned long long)rec->fsync_calls);
+    printf("Max write: %.3f ms, Max fsync: %.3f ms\n",
+           (double)rec->max_write_ns / 1000000.0,
+           (double)rec->max_fsync_ns / 1000000.0);
+    if (rec->write_error) {
+        printf("Write error: %s\n", strerror(rec->write_error));
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * QNX Dashboard Simulator - Render Pool Implementation
+ *
+ * Same hand-off as the simulator pool: workers park on a condition variable
+ * between passes and claim tiles through an atomic counter. The thread that
+ * calls render_pool_run() draws tiles alongside them and then waits for the
+ * stragglers, so returning from a pass is the barrier before present. Workers
+ * inherit the scheduling of the thread they render for; a SCHED_OTHER helper
+ * holding up a real-time GUI frame would be a priority inversion. When that
+ * thread is pinned, the workers take the CPUs after it.
+ */
+
+#include "../include/render_pool.h"
+#include "../include/framebuffer.h"
+#include "../include/rt_thread.h"
+
+/**
+ * Claim and draw tiles until none are left
+ *
+ * Each tile is drawn through a copy of the target whose clip is the tile,
+ * so threads share pixels but never write the same one.
+ */
+static uint32_t render_pool_draw_tiles(render_pool_t *pool) {
+    framebuffer_t view = *pool->target;
+    uint32_t drawn = 0;
+    
+    for (;;) {
+        uint32_t index = __atomic_fetch_add(&pool->next_tile, 1, __ATOMIC_RELAXED);
+        if (index >= pool->tile_count) break;
+        
+        const framebuffer_rect_t *tile = &pool->tiles[index];
+        framebuffer_set_clip(&view, tile->x, tile->y, tile->width, tile->height);
+        pool->render_tile(pool->context, &view);
+        drawn++;
+    }
+    
+    return drawn;
+}
+
+static void *render_pool_worker(void *arg) {
+    render_pool_t *pool = (render_pool_t *)arg;
+    uint64_t seen_generation = 0;
+    
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen_generation) {
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        }
+        if (pool->shutdown) break;
+        
+        seen_generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        
+        render_pool_draw_tiles(pool);
+        
+        pthread_mutex_lock(&pool->lock);
+        if (++pool->workers_done == pool->worker_count) {
+            pthread_cond_signal(&pool->done_cond);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    return NULL;
+}
+
+/**
+ * Start threads - 1 workers; the caller is the remaining thread
+ *
+ * config is the calling thread's configuration, whose policy and priority
+ * the workers copy. NULL runs them SCHED_OTHER and unpinned. threads = 0
+ * uses one thread per online CPU.
+ */
+int render_pool_init(render_pool_t *pool, uint32_t threads, const rt_thread_config_t *config) {
+    if (!pool) return -1;
+    
+    memset(pool, 0, sizeof(render_pool_t));
+    
+    if (threads == 0) threads = render_pool_default_threads();
+    if (threads > RENDER_POOL_MAX_THREADS) threads = RENDER_POOL_MAX_THREADS;
+    
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) online = 1;
+    
+    for (uint32_t w = 0; w + 1 < threads; w++) {
+        rt_thread_config_t worker_config;
+        rt_thread_report_t report;
+        memset(&worker_config, 0, sizeof(worker_config));
+        worker_config.policy = SCHED_OTHER;
+        worker_config.cpu = RT_NO_AFFINITY;
+        if (config) {
+            worker_config = *config;
+            if (config->cpu != RT_NO_AFFINITY) {
+                worker_config.cpu = (int)(((uint32_t)config->cpu + 1 + w) % (uint32_t)online);
+            }
+        }
+        worker_config.name = "render";
+        
+        int error = rt_thread_create(&pool->workers[w], &worker_config, render_pool_worker, pool, &report);
+        if (error != 0) {
+            fprintf(stderr, "Render pool: cannot start worker %u: %s\n", w, strerror(error));
+            pool->worker_count = w;
+            render_pool_destroy(pool);
+            return -1;
+        }
+        pool->worker_count = w + 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * Draw every tile of target with render_tile
+ *
+ * Returns once all tiles are finished, so the caller may present straight
+ * away. Without workers the tiles are drawn in order on the calling thread.
+ */
+void render_pool_run(render_pool_t *pool, const framebuffer_t *target,
+                     const framebuffer_rect_t *tiles, uint32_t tile_count,
+                     render_tile_fn_t render_tile, void *context) {
+    if (!pool || !target || !tiles || tile_count == 0 || !render_tile) return;
+    
+    uint64_t start_ns = get_timestamp_ns();
+    
+    pool->target = target;
+    pool->tiles = tiles;
+    pool->tile_count = tile_count;
+    pool->render_tile = render_tile;
+    pool->context = context;
+    __atomic_store_n(&pool->next_tile, 0, __ATOMIC_RELAXED);
+    
+    if (pool->worker_count > 0) {
+        pthread_mutex_lock(&pool->lock);
+        pool->workers_done = 0;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->work_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    
+    render_pool_draw_tiles(pool);
+    
+    if (pool->worker_count > 0) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->workers_done < pool->worker_count) {
+            pthread_cond_wait(&pool->done_cond, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+    
+    pool->run_time_ns += get_timestamp_ns() - start_ns;
+    pool->passes++;
+    pool->tiles_rendered += tile_count;
+}
+
+/**
+ * Stop the workers
+ */
+void render_pool_destroy(render_pool_t *pool) {
+    if (!pool) return;
+    
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (uint32_t w = 0; w < pool->worker_count; w++) {
+        pthread_join(pool->workers[w], NULL);
+    }
+    
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+    memset(pool, 0, sizeof(render_pool_t));
+}
+
+/**
+ * Utility functions
+ */
+uint32_t render_pool_threads(const render_pool_t *pool) {
+    return pool ? pool->worker_count + 1 : 1;
+}
+
+uint32_t render_pool_default_threads(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) return 1;
+    if (online > RENDER_POOL_MAX_THREADS) return RENDER_POOL_MAX_THREADS;
+    return (uint32_t)online;
+}
+
+void render_pool_print_statistics(const render_pool_t *pool) {
+    if (!pool || pool->passes == 0) return;
+    
+    printf("Render Pool Statistics:\n");
+    printf("  Threads: %u, passes: %llu, tiles/pass: %.1f\n", pool->worker_count + 1,
+           (unsigned long long)pool->passes, (double)pool->tiles_rendered / (double)pool->passes);
+    printf("  Average pass: %.3f ms\n", (double)pool->run_time_ns / (double)pool->passes / 1e6);
+}
@@ -0,0 +1,299 @@
+/**
+ * QNX Dashboard Simulator - Recording Replay Implementation
+ *
+ * The log is mapped read-only; nothing is read up front. A seek does a
+ * binary search over the sparse index (a few KB per hour of recording)
+ * and then over at most RECORDER_INDEX_INTERVAL records, so it touches a
+ * handful of pages however large the file is. Normal playback walks
+ * forward one record at a time and relies on sequential read-ahead.
+ */
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include "../include/replay.h"
+#include "../include/recorder.h"
+
+/* Forward jumps longer than this use a seek instead of a linear walk */
+#define REPLAY_LINEAR_LIMIT  64
+
+/* Records and index entries are read in place, so they must stay aligned */
+#define REPLAY_ALIGNMENT     8
+
+/**
+ * Every entry must name a record in the file, in record and time order
+ */
+static bool replay_index_valid(const vehicle_record_index_t *index, uint32_t count,
+                               uint64_t record_count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (index[i].record >= record_count) return false;
+        if (i > 0 && (index[i].record < index[i - 1].record ||
+                      index[i].acquired_ns < index[i - 1].acquired_ns)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Locate the optional index trailer
+ *
+ * Returns true and sets record_count if a trailer bounds the records;
+ * replay->index stays NULL when there is none or its entries are corrupt.
+ */
+static bool replay_load_index(replay_t *replay, size_t data_offset) {
+    if (replay->map_size < data_offset + sizeof(vehicle_record_trailer_t)) return false;
+
+    vehicle_record_trailer_t trailer;
+    memcpy(&trailer, replay->map + replay->map_size - sizeof(trailer), sizeof(trailer));
+    if (trailer.magic != RECORDER_INDEX_MAGIC || trailer.interval == 0) return false;
+
+    /* Trailer must describe exactly the bytes between the records and itself */
+    uint64_t index_bytes = (uint64_t)trailer.entry_count * sizeof(vehicle_record_index_t);
+    if (trailer.index_offset < data_offset ||
+        (trailer.index_offset - data_offset) % sizeof(vehicle_record_t) != 0 ||
+        trailer.index_offset + index_bytes + sizeof(trailer) != replay->map_size) {
+        return false;
+    }
+
+    replay->record_count = (trailer.index_offset - data_offset) / sizeof(vehicle_record_t);
+
+    const vehicle_record_index_t *index =
+        (const vehicle_record_index_t *)(replay->map + trailer.index_offset);
+    if (!replay_index_valid(index, trailer.entry_count, replay->record_count)) {
+        fprintf(stderr, "Replay: ignoring corrupt index, searching records\n");
+        return true;
+    }
+
+    replay->index = index;
+    replay->index_count = trailer.entry_count;
+    replay->index_interval = trailer.interval;
+    return true;
+}
+
+/**
+ * Map a recording for playback
+ */
+int replay_open(replay_t *replay, const char *path) {
+    if (!replay || !path) return -1;
+
+    memset(replay, 0, sizeof(replay_t));
+    replay->fd = open(path, O_RDONLY);
+    if (replay->fd < 0) {
+        fprintf(stderr, "Replay: cannot open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(replay->fd, &st) != 0 || (size_t)st.st_size < sizeof(vehicle_record_header_t)) {
+        fprintf(stderr, "Replay: %s is not a recording\n", path);
+        replay_close(replay);
+        return -1;
+    }
+
+    replay->map_size = (size_t)st.st_size;
+    void *map = mmap(NULL, replay->map_size, PROT_READ, MAP_SHARED, replay->fd, 0);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "Replay: cannot map %s: %s\n", path, strerror(errno));
+        replay->map_size = 0;
+        replay_close(replay);
+        return -1;
+    }
+    replay->map = (const uint8_t *)map;
+
+    const vehicle_record_header_t *header = (const vehicle_record_header_t *)replay->map;
+    if (recorder_validate_header(header) != 0) {
+        fprintf(stderr, "Replay: %s has an unsupported header\n", path);
+        replay_close(replay);
+        return -1;
+    }
+
+    size_t data_offset = header->header_size;
+    if (data_offset > replay->map_size || data_offset % REPLAY_ALIGNMENT != 0) {
+        fprintf(stderr, "Replay: %s has a corrupt header size\n", path);
+        replay_close(replay);
+        return -1;
+    }
+    replay->records = (const vehicle_record_t *)(replay->map + data_offset);
+
+    /* Without a trailer the rest of the file must be whole records */
+    if (!replay_load_index(replay, data_offset)) {
+        if ((replay->map_size - data_offset) % sizeof(vehicle_record_t) != 0) {
+            fprintf(stderr, "Replay: %s ends in a partial record\n", path);
+            replay_close(replay);
+            return -1;
+        }
+        replay->record_count = (replay->map_size - data_offset) / sizeof(vehicle_record_t);
+    }
+
+    if (replay->record_count == 0) {
+        fprintf(stderr, "Replay: %s contains no samples\n", path);
+        replay_close(replay);
+        return -1;
+    }
+
+    /* Playback is a forward scan: read ahead, drop pages behind */
+    posix_madvise(map, replay->map_size, POSIX_MADV_SEQUENTIAL);
+
+    replay->first_ns = replay->records[0].acquired_ns;
+    replay->last_ns = replay->records[replay->record_count - 1].acquired_ns;
+    replay->cursor_ns = (double)replay->first_ns;
+
+    printf("Replaying %s: %llu samples, %.1f s%s\n", path,
+           (unsigned long long)replay->record_count, replay_duration_seconds(replay),
+           replay->index ? "" : " (no index, searching records)");
+    return 0;
+}
+
+/**
+ * Unmap and close
+ */
+void replay_close(replay_t *replay) {
+    if (!replay) return;
+
+    if (replay->map) {
+        munmap((void *)replay->map, replay->map_size);
+    }
+    if (replay->fd >= 0) {
+        close(replay->fd);
+    }
+    memset(replay, 0, sizeof(replay_t));
+    replay->fd = -1;
+}
+
+bool replay_is_open(const replay_t *replay) {
+    return replay && replay->map != NULL;
+}
+
+/**
+ * Last record in [low, high) with acquired_ns <= time_ns (low if none)
+ */
+static uint64_t replay_search_records(const replay_t *replay, uint64_t low, uint64_t high,
+                                      uint64_t time_ns) {
+    while (high - low > 1) {
+        uint64_t mid = low + (high - low) / 2;
+        if (replay->records[mid].acquired_ns <= time_ns) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * Find the record current at time_ns and move the cursor there
+ */
+static void replay_locate(replay_t *replay, uint64_t time_ns) {
+    uint64_t low = 0, high = replay->record_count;
+
+    if (replay->index_count > 0) {
+        /* Narrow to one index interval first */
+        uint32_t entry_low = 0, entry_high = replay->index_count;
+        while (entry_high - entry_low > 1) {
+            uint32_t mid = entry_low + (entry_high - entry_low) / 2;
+            if (replay->index[mid].acquired_ns <= time_ns) {
+                entry_low = mid;
+            } else {
+                entry_high = mid;
+            }
+        }
+        low = replay->index[entry_low].record;
+        if (entry_high < replay->index_count) {
+            high = replay->index[entry_high].record;
+        }
+    }
+
+    replay->position = replay_search_records(replay, low, high, time_ns);
+    replay->cursor_ns = (double)(time_ns < replay->first_ns ? replay->first_ns : time_ns);
+    replay->complete = false;
+    replay->seeks++;
+}
+
+/**
+ * Position playback at a recording timestamp
+ *
+ * Returns the record now current.
+ */
+uint64_t replay_seek(replay_t *replay, uint64_t time_ns) {
+    if (!replay_is_open(replay)) return 0;
+
+    replay_locate(replay, time_ns);
+
+    /* Start reading ahead from the new position straight away */
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t offset = (size_t)((const uint8_t *)&replay->records[replay->position] - replay->map);
+    offset &= ~(page - 1);
+    size_t length = replay->map_size - offset;
+    if (length > RECORDER_WRITE_BUFFER_BYTES) length = RECORDER_WRITE_BUFFER_BYTES;
+    posix_madvise((void *)(replay->map + offset), length, POSIX_MADV_WILLNEED);
+
+    return replay->position;
+}
+
+/**
+ * Advance playback by delta_time * speed and decode the current sample
+ *
+ * Returns false once a non-looping replay has played its last sample
+ * (out then keeps the final sample).
+ */
+bool replay_advance(replay_t *replay, float delta_time, float speed, bool loop,
+                    vehicle_data_t *out) {
+    if (!replay_is_open(replay) || !out) return false;
+
+    if (!replay->complete) {
+        replay->cursor_ns += (double)delta_time * (double)speed * 1000000000.0;
+    }
+
+    if (replay->cursor_ns > (double)replay->last_ns) {
+        double duration = (double)(replay->last_ns - replay->first_ns);
+        if (loop && duration > 0.0) {
+            double overshoot = fmod(replay->cursor_ns - (double)replay->last_ns, duration);
+            replay_locate(replay, replay->first_ns + (uint64_t)overshoot);
+            replay->loops++;
+        } else {
+            replay->cursor_ns = (double)replay->last_ns;
+            replay->position = replay->record_count - 1;
+            replay->complete = true;
+        }
+    } else {
+        /* Short hops walk forward, long ones (fast-forward) seek */
+        uint64_t cursor = (uint64_t)replay->cursor_ns;
+        uint64_t steps = 0;
+        while (replay->position + 1 < replay->record_count &&
+               replay->records[replay->position + 1].acquired_ns <= cursor) {
+            if (++steps > REPLAY_LINEAR_LIMIT) {
+                replay_locate(replay, cursor);
+                break;
+            }
+            replay->position++;
+        }
+    }
+
+    recorder_decode(&replay->records[replay->position], out);
+    replay->records_played++;
+    return !replay->complete;
+}
+
+float replay_elapsed_seconds(const replay_t *replay) {
+    if (!replay_is_open(replay)) return 0.0f;
+    return (float)((replay->cursor_ns - (double)replay->first_ns) / 1000000000.0);
+}
+
+float replay_duration_seconds(const replay_t *replay) {
+    if (!replay_is_open(replay)) return 0.0f;
+    return (float)((double)(replay->last_ns - replay->first_ns) / 1000000000.0);
+}
+
+/**
+ * Statistics functions
+ */
+void replay_print_statistics(const replay_t *replay) {
+    if (!replay_is_open(replay)) return;
+
+    printf("=== Replay ===\n");
+    printf("Samples: %llu, Index entries: %u\n",
+           (unsigned long long)replay->record_count, replay->index_count);
+    printf("Position: %.1f / %.1f s, Loops: %u, Seeks: %llu\n",
+           replay_elapsed_seconds(replay), replay_duration_seconds(replay),
+           replay->loops, (unsigned long long)replay->seeks);
+}
@@ -0,0 +1,187 @@
+/**
+ * QNX Dashboard Simulator - Resource Monitor Implementation
+ *
+ * One sample costs a pread() of /proc/self/statm, one getrusage() and a
+ * clock_gettime() per tracked thread, which is cheap enough for
+ * MONITOR_UPDATE_RATE_HZ. getrusage() reports the same fault and context
+ * switch counters as /proc/self/stat and /proc/self/status without
+ * parsing text.
+ */
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include "../include/resource_monitor.h"
+
+#define STATM_PATH "/proc/self/statm"
+
+static uint64_t clock_now_ns(clockid_t clock_id) {
+    struct timespec ts;
+    if (clock_gettime(clock_id, &ts) != 0) return 0;
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static float cpu_percent(uint64_t cpu_delta_ns, uint64_t wall_delta_ns) {
+    if (wall_delta_ns == 0) return 0.0f;
+    return (float)((double)cpu_delta_ns * 100.0 / (double)wall_delta_ns);
+}
+
+/**
+ * Read resident set size from /proc/self/statm
+ */
+static bool read_rss_kb(const resource_monitor_t *mon, uint32_t *rss_kb) {
+    char buffer[128];
+
+    if (mon->statm_fd < 0) return false;
+
+    ssize_t len = pread(mon->statm_fd, buffer, sizeof(buffer) - 1, 0);
+    if (len <= 0) return false;
+    buffer[len] = '\0';
+
+    /* Format: size resident shared text lib data dt (pages) */
+    char *cursor = buffer;
+    strtoul(cursor, &cursor, 10);
+    unsigned long resident_pages = strtoul(cursor, NULL, 10);
+
+    *rss_kb = (uint32_t)(resident_pages * mon->page_size_kb);
+    return true;
+}
+
+/**
+ * Initialize resource monitor
+ */
+int resource_monitor_initialize(resource_monitor_t *mon, uint32_t max_memory_mb,
+                                float max_cpu_percent) {
+    if (!mon) return -1;
+
+    memset(mon, 0, sizeof(resource_monitor_t));
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    mon->page_size_kb = page_size > 0 ? (uint32_t)(page_size / 1024) : 4;
+    mon->max_memory_kb = max_memory_mb * 1024;
+    mon->max_cpu_percent = max_cpu_percent;
+
+    mon->statm_fd = open(STATM_PATH, O_RDONLY);
+    if (mon->statm_fd < 0) {
+        /* Not all targets provide statm; fall back to peak RSS */
+        DEBUG_PRINT("%s unavailable, using getrusage() peak RSS", STATM_PATH);
+    }
+
+    mon->last_wall_ns = clock_now_ns(CLOCK_MONOTONIC);
+    mon->last_process_cpu_ns = clock_now_ns(CLOCK_PROCESS_CPUTIME_ID);
+
+    return 0;
+}
+
+/**
+ * Cleanup resource monitor
+ */
+void resource_monitor_cleanup(resource_monitor_t *mon) {
+    if (!mon) return;
+
+    if (mon->statm_fd >= 0) {
+        close(mon->statm_fd);
+    }
+    mon->statm_fd = -1;
+}
+
+/**
+ * Attribute CPU time of a thread to an application role
+ */
+int resource_monitor_attach_thread(resource_monitor_t *mon, app_thread_t which,
+                                   pthread_t thread) {
+    if (!mon || which >= APP_THREAD_COUNT) return -1;
+
+    clockid_t clock_id;
+    if (pthread_getcpuclockid(thread, &clock_id) != 0) {
+        mon->thread_clock_valid[which] = false;
+        return -1;
+    }
+
+    mon->thread_clocks[which] = clock_id;
+    mon->thread_clock_valid[which] = true;
+    mon->last_thread_cpu_ns[which] = clock_now_ns(clock_id);
+    return 0;
+}
+
+/**
+ * Take one resource sample
+ *
+ * Returns true if memory or CPU usage exceeds the configured limits.
+ */
+bool resource_monitor_sample(resource_monitor_t *mon, resource_usage_t *usage) {
+    if (!mon || !usage) return false;
+
+    uint64_t wall_ns = clock_now_ns(CLOCK_MONOTONIC);
+    uint64_t wall_delta = wall_ns - mon->last_wall_ns;
+    mon->last_wall_ns = wall_ns;
+
+    /* Memory, faults and context switches */
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) {
+        usage->peak_rss_kb = (uint32_t)ru.ru_maxrss;
+        usage->minor_faults = (uint64_t)ru.ru_minflt;
+        usage->major_faults = (uint64_t)ru.ru_majflt;
+        usage->voluntary_switches = (uint64_t)ru.ru_nvcsw;
+        usage->involuntary_switches = (uint64_t)ru.ru_nivcsw;
+    }
+    if (!read_rss_kb(mon, &usage->rss_kb)) {
+        usage->rss_kb = usage->peak_rss_kb;
+    }
+
+    /* Process CPU */
+    uint64_t process_cpu_ns = clock_now_ns(CLOCK_PROCESS_CPUTIME_ID);
+    usage->process_cpu_percent = cpu_percent(process_cpu_ns - mon->last_process_cpu_ns,
+                                             wall_delta);
+    mon->last_process_cpu_ns = process_cpu_ns;
+
+    /* Per-thread CPU */
+    for (int i = 0; i < APP_THREAD_COUNT; i++) {
+        if (!mon->thread_clock_valid[i]) {
+            usage->thread_cpu_percent[i] = 0.0f;
+            continue;
+        }
+
+        uint64_t thread_ns = clock_now_ns(mon->thread_clocks[i]);
+        usage->thread_cpu_ns[i] = thread_ns;
+        usage->thread_cpu_percent[i] = cpu_percent(thread_ns - mon->last_thread_cpu_ns[i],
+                                                   wall_delta);
+        mon->last_thread_cpu_ns[i] = thread_ns;
+    }
+
+    bool over_memory = mon->max_memory_kb > 0 && usage->rss_kb > mon->max_memory_kb;
+    bool over_cpu = mon->max_cpu_percent > 0.0f &&
+                    usage->process_cpu_percent > mon->max_cpu_percent;
+    return over_memory || over_cpu;
+}
+
+/**
+ * Utility functions
+ */
+const char *app_thread_to_string(app_thread_t which) {
+    switch (which) {
+        case APP_THREAD_GUI: return "gui";
+        case APP_THREAD_DATA: return "data";
+        case APP_THREAD_MONITOR: return "monitor";
+        default: return "unknown";
+    }
+}
+
+void resource_monitor_print(const resource_usage_t *usage) {
+    if (!usage) return;
+
+    printf("=== Resource Usage ===\n");
+    printf("RSS: %u KB (peak %u KB)\n", usage->rss_kb, usage->peak_rss_kb);
+    printf("Page Faults: %llu minor, %llu major\n",
+           (unsigned long long)usage->minor_faults,
+           (unsigned long long)usage->major_faults);
+    printf("Context Switches: %llu voluntary, %llu involuntary\n",
+           (unsigned long long)usage->voluntary_switches,
+           (unsigned long long)usage->involuntary_switches);
+    printf("Process CPU: %.1f%%\n", usage->process_cpu_percent);
+    for (int i = 0; i < APP_THREAD_COUNT; i++) {
+        printf("  %-8s %5.1f%% (%.3f s total)\n",
+               app_thread_to_string((app_thread_t)i),
+               usage->thread_cpu_percent[i],
+               (double)usage->thread_cpu_ns[i] / 1000000000.0);
+    }
+}
@@ -0,0 +1,237 @@
+/**
+ * QNX Dashboard Simulator - Random Number Generator Implementation
+ *
+ * xoshiro128+ (Blackman and Vigna): four words of state, no locks, and
+ * reproducible per instance from a 64-bit seed expanded with splitmix64.
+ * Floats take the top 24 bits of each output, where xoshiro128+ is
+ * strongest. The batch generator runs RNG_LANES streams side by side
+ * with AVX2, SSE2 or NEON integer ops, picked at compile time; every ISA
+ * produces the same bits as the scalar loop.
+ */
+
+#include "../include/rng.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RNG_SIMD_NAME       "avx2"
+#define RNG_VECTOR_WIDTH    8
+typedef __m256i vu_t;
+typedef __m256 vfl_t;
+#define vu_load(p)          _mm256_loadu_si256((const __m256i *)(p))
+#define vu_store(p, v)      _mm256_storeu_si256((__m256i *)(p), v)
+#define vu_add(a, b)        _mm256_add_epi32(a, b)
+#define vu_xor(a, b)        _mm256_xor_si256(a, b)
+#define vu_or(a, b)         _mm256_or_si256(a, b)
+#define vu_shl(a, n)        _mm256_slli_epi32(a, n)
+#define vu_shr(a, n)        _mm256_srli_epi32(a, n)
+#define vu_to_float(a)      _mm256_cvtepi32_ps(a)   /* Inputs < 2^24 */
+#define vfl_set1(x)         _mm256_set1_ps(x)
+#define vfl_load(p)         _mm256_loadu_ps(p)
+#define vfl_store(p, v)     _mm256_storeu_ps(p, v)
+#define vfl_sub(a, b)       _mm256_sub_ps(a, b)
+#define vfl_mul(a, b)       _mm256_mul_ps(a, b)
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RNG_SIMD_NAME       "sse2"
+#define RNG_VECTOR_WIDTH    4
+typedef __m128i vu_t;
+typedef __m128 vfl_t;
+#define vu_load(p)          _mm_loadu_si128((const __m128i *)(p))
+#define vu_store(p, v)      _mm_storeu_si128((__m128i *)(p), v)
+#define vu_add(a, b)        _mm_add_epi32(a, b)
+#define vu_xor(a, b)        _mm_xor_si128(a, b)
+#define vu_or(a, b)         _mm_or_si128(a, b)
+#define vu_shl(a, n)        _mm_slli_epi32(a, n)
+#define vu_shr(a, n)        _mm_srli_epi32(a, n)
+#define vu_to_float(a)      _mm_cvtepi32_ps(a)
+#define vfl_set1(x)         _mm_set1_ps(x)
+#define vfl_load(p)         _mm_loadu_ps(p)
+#define vfl_store(p, v)     _mm_storeu_ps(p, v)
+#define vfl_sub(a, b)       _mm_sub_ps(a, b)
+#define vfl_mul(a, b)       _mm_mul_ps(a, b)
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RNG_SIMD_NAME       "neon"
+#define RNG_VECTOR_WIDTH    4
+typedef uint32x4_t vu_t;
+typedef float32x4_t vfl_t;
+#define vu_load(p)          vld1q_u32(p)
+#define vu_store(p, v)      vst1q_u32(p, v)
+#define vu_add(a, b)        vaddq_u32(a, b)
+#define vu_xor(a, b)        veorq_u32(a, b)
+#define vu_or(a, b)         vorrq_u32(a, b)
+#define vu_shl(a, n)        vshlq_n_u32(a, n)
+#define vu_shr(a, n)        vshrq_n_u32(a, n)
+#define vu_to_float(a)      vcvtq_f32_u32(a)
+#define vfl_set1(x)         vdupq_n_f32(x)
+#define vfl_load(p)         vld1q_f32(p)
+#define vfl_store(p, v)     vst1q_f32(p, v)
+#define vfl_sub(a, b)       vsubq_f32(a, b)
+#define vfl_mul(a, b)       vmulq_f32(a, b)
+#endif
+
+#define RNG_FLOAT_SCALE     (1.0f / 8388608.0f)   /* 2^-23: 24 bits -> [0, 2) */
+
+static inline uint32_t rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Single stream
+ */
+void rng_seed(rng_t *rng, uint64_t seed) {
+    if (!rng) return;
+    
+    uint64_t a = splitmix64(&seed);
+    uint64_t b = splitmix64(&seed);
+    rng->s[0] = (uint32_t)a;
+    rng->s[1] = (uint32_t)(a >> 32);
+    rng->s[2] = (uint32_t)b;
+    rng->s[3] = (uint32_t)(b >> 32);
+    if ((rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3]) == 0) {
+        rng->s[0] = 1;
+    }
+}
+
+uint32_t rng_next(rng_t *rng) {
+    uint32_t *s = rng->s;
+    uint32_t result = s[0] + s[3];
+    uint32_t t = s[1] << 9;
+    
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl32(s[3], 11);
+    
+    return result;
+}
+
+/**
+ * Uniform integer below bound (multiply-shift, no division)
+ */
+uint32_t rng_below(rng_t *rng, uint32_t bound) {
+    return (uint32_t)(((uint64_t)rng_next(rng) * bound) >> 32);
+}
+
+float rng_uniform(rng_t *rng) {
+    return (float)(rng_next(rng) >> 8) * (RNG_FLOAT_SCALE * 0.5f);
+}
+
+float rng_symmetric(rng_t *rng) {
+    return (float)(rng_next(rng) >> 8) * RNG_FLOAT_SCALE - 1.0f;
+}
+
+/**
+ * Batch generation
+ */
+void rng_lanes_seed(rng_lanes_t *rng, uint64_t seed) {
+    if (!rng) return;
+    
+    for (uint32_t lane = 0; lane < RNG_LANES; lane++) {
+        rng_t stream;
+        rng_seed(&stream, seed + lane * 0x632BE59BD9B4E019ULL);
+        for (int word = 0; word < 4; word++) {
+            rng->s[word][lane] = stream.s[word];
+        }
+    }
+}
+
+void rng_lanes_get(const rng_lanes_t *rng, uint32_t lane, rng_t *out) {
+    if (!rng || !out || lane >= RNG_LANES) return;
+    
+    for (int word = 0; word < 4; word++) {
+        out->s[word] = rng->s[word][lane];
+    }
+}
+
+/**
+ * One output per lane, scaled to [-amplitude, amplitude)
+ */
+static void rng_lanes_noise(rng_lanes_t *rng, float out[RNG_LANES], const float amplitude[RNG_LANES]) {
+#ifdef RNG_SIMD_NAME
+    const vfl_t scale = vfl_set1(RNG_FLOAT_SCALE);
+    const vfl_t one = vfl_set1(1.0f);
+    
+    for (uint32_t lane = 0; lane < RNG_LANES; lane += RNG_VECTOR_WIDTH) {
+        vu_t s0 = vu_load(&rng->s[0][lane]);
+        vu_t s1 = vu_load(&rng->s[1][lane]);
+        vu_t s2 = vu_load(&rng->s[2][lane]);
+        vu_t s3 = vu_load(&rng->s[3][lane]);
+        
+        vu_t result = vu_add(s0, s3);
+        vu_t t = vu_shl(s1, 9);
+        s2 = vu_xor(s2, s0);
+        s3 = vu_xor(s3, s1);
+        s1 = vu_xor(s1, s2);
+        s0 = vu_xor(s0, s3);
+        s2 = vu_xor(s2, t);
+        s3 = vu_or(vu_shl(s3, 11), vu_shr(s3, 21));
+        
+        vu_store(&rng->s[0][lane], s0);
+        vu_store(&rng->s[1][lane], s1);
+        vu_store(&rng->s[2][lane], s2);
+        vu_store(&rng->s[3][lane], s3);
+        
+        vfl_t unit = vfl_sub(vfl_mul(vu_to_float(vu_shr(result, 8)), scale), one);
+        vfl_store(&out[lane], vfl_mul(unit, vfl_load(&amplitude[lane])));
+    }
+#else
+    for (uint32_t lane = 0; lane < RNG_LANES; lane++) {
+        rng_t stream;
+        rng_lanes_get(rng, lane, &stream);
+        out[lane] = rng_symmetric(&stream) * amplitude[lane];
+        for (int word = 0; word < 4; word++) {
+            rng->s[word][lane] = stream.s[word];
+        }
+    }
+#endif
+}
+
+/**
+ * Fill out[0..count) with noise in [-amplitude[i], amplitude[i])
+ *
+ * amplitude may be NULL for unit noise. Element i always comes from lane
+ * i % RNG_LANES, so a fixed channel layout gets a fixed stream per
+ * channel and runs are reproducible from the seed alone.
+ */
+void rng_fill_noise(rng_lanes_t *rng, float *out, const float *amplitude, uint32_t count) {
+    if (!rng || !out) return;
+    
+    float unit[RNG_LANES];
+    float block[RNG_LANES];
+    for (uint32_t lane = 0; lane < RNG_LANES; lane++) {
+        unit[lane] = 1.0f;
+    }
+    
+    uint32_t i = 0;
+    for (; i + RNG_LANES <= count; i += RNG_LANES) {
+        rng_lanes_noise(rng, out + i, amplitude ? amplitude + i : unit);
+    }
+    
+    if (i < count) {
+        /* Partial block: unused lanes still advance */
+        float scale[RNG_LANES];
+        for (uint32_t lane = 0; lane < RNG_LANES; lane++) {
+            scale[lane] = (amplitude && i + lane < count) ? amplitude[i + lane] : 1.0f;
+        }
+        rng_lanes_noise(rng, block, scale);
+        memcpy(out + i, block, (count - i) * sizeof(float));
+    }
+}
+
+const char *rng_simd_name(void) {
+#ifdef RNG_SIMD_NAME
+    return RNG_SIMD_NAME;
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,221 @@
+/**
+ * QNX Dashboard Simulator - Real-Time Thread Launch Implementation
+ *
+ * Scheduling attributes are only honoured with PTHREAD_EXPLICIT_SCHED; the
+ * default (inherit) silently discards policy and priority. When the process
+ * lacks the privilege for a real-time policy the thread is started with
+ * inherited scheduling instead and the report records the refusal.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  /* sched_setaffinity() */
+#endif
+
+#include <sched.h>
+#include <alloca.h>
+#ifdef __QNX__
+#include <sys/neutrino.h>
+#endif
+#include "../include/rt_thread.h"
+
+/**
+ * Startup hand-off between creator and new thread
+ */
+typedef struct {
+    const rt_thread_config_t *config;
+    rt_thread_report_t *report;
+    void *(*start_routine)(void *);
+    void *arg;
+
+    pthread_mutex_t lock;
+    pthread_cond_t started_cond;
+    bool started;
+} rt_thread_start_t;
+
+/**
+ * Pin the calling thread to one CPU
+ */
+static int rt_apply_affinity(int cpu) {
+#if defined(__QNX__)
+    unsigned runmask = 1u << cpu;
+    return ThreadCtl(_NTO_TCTL_RUNMASK, (void *)(uintptr_t)runmask) == -1 ? errno : 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0 ? 0 : errno;
+#else
+    (void)cpu;
+    return ENOTSUP;
+#endif
+}
+
+/**
+ * Touch the stack so later deep calls do not take page faults
+ */
+static void rt_prefault_stack(size_t bytes) {
+    volatile unsigned char *stack = alloca(bytes);
+    long page = sysconf(_SC_PAGESIZE);
+    size_t step = page > 0 ? (size_t)page : 4096;
+
+    for (size_t offset = 0; offset < bytes; offset += step) {
+        stack[offset] = 0;
+    }
+}
+
+static void *rt_thread_trampoline(void *arg) {
+    rt_thread_start_t *start = (rt_thread_start_t *)arg;
+    const rt_thread_config_t *config = start->config;
+    rt_thread_report_t *report = start->report;
+
+    /* Copy out before the creator's stack frame goes away */
+    void *(*start_routine)(void *) = start->start_routine;
+    void *routine_arg = start->arg;
+
+    if (config->cpu != RT_NO_AFFINITY) {
+        report->affinity_error = rt_apply_affinity(config->cpu);
+        report->affinity_applied = (report->affinity_error == 0);
+    }
+
+    if (config->prefault_stack) {
+        size_t bytes = RT_PREFAULT_STACK_BYTES;
+        if (config->stack_size > 0 && bytes > config->stack_size / 2) {
+            bytes = config->stack_size / 2;
+        }
+        rt_prefault_stack(bytes);
+        report->stack_prefaulted = true;
+    }
+
+    /* Verify what the kernel actually gave us */
+    struct sched_param param;
+    int policy;
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+        report->actual_policy = policy;
+        report->actual_priority = param.sched_priority;
+        report->sched_applied = (policy == config->policy &&
+                                 (policy == SCHED_OTHER ||
+                                  param.sched_priority == config->priority));
+    }
+
+    pthread_mutex_lock(&start->lock);
+    start->started = true;
+    pthread_cond_signal(&start->started_cond);
+    pthread_mutex_unlock(&start->lock);
+
+    return start_routine(routine_arg);
+}
+
+/**
+ * Create a thread with the requested policy, priority, affinity and stack
+ *
+ * Returns 0 on success (possibly with reduced settings, see report).
+ */
+int rt_thread_create(pthread_t *thread, const rt_thread_config_t *config,
+                     void *(*start_routine)(void *), void *arg,
+                     rt_thread_report_t *report) {
+    if (!thread || !config || !start_routine || !report) return EINVAL;
+
+    memset(report, 0, sizeof(rt_thread_report_t));
+
+    rt_thread_start_t start;
+    memset(&start, 0, sizeof(start));
+    start.config = config;
+    start.report = report;
+    start.start_routine = start_routine;
+    start.arg = arg;
+    pthread_mutex_init(&start.lock, NULL);
+    pthread_cond_init(&start.started_cond, NULL);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (config->stack_size > 0) {
+        pthread_attr_setstacksize(&attr, config->stack_size);
+    }
+
+    /* Without EXPLICIT_SCHED the policy below is ignored */
+    struct sched_param param;
+    memset(&param, 0, sizeof(param));
+    int min_priority = sched_get_priority_min(config->policy);
+    int max_priority = sched_get_priority_max(config->policy);
+    param.sched_priority = (int)clamp((float)config->priority,
+                                      (float)min_priority, (float)max_priority);
+
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, config->policy);
+    pthread_attr_setschedparam(&attr, &param);
+
+    int result = pthread_create(thread, &attr, rt_thread_trampoline, &start);
+    if (result == EPERM || result == EINVAL) {
+        /* No privilege (or unsupported policy): inherit the creator's */
+        report->sched_error = result;
+        pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        result = pthread_create(thread, &attr, rt_thread_trampoline, &start);
+    }
+    pthread_attr_destroy(&attr);
+
+    if (result == 0) {
+        pthread_mutex_lock(&start.lock);
+        while (!start.started) {
+            pthread_cond_wait(&start.started_cond, &start.lock);
+        }
+        pthread_mutex_unlock(&start.lock);
+    }
+
+    pthread_cond_destroy(&start.started_cond);
+    pthread_mutex_destroy(&start.lock);
+    return result;
+}
+
+/**
+ * Lock current and future pages into RAM
+ *
+ * Returns 0 on success or the errno from mlockall().
+ */
+int rt_lock_memory(void) {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        return errno;
+    }
+    return 0;
+}
+
+/**
+ * Utility functions
+ */
+int rt_policy_from_string(const char *name, int fallback) {
+    if (!name) return fallback;
+    if (strcmp(name, "fifo") == 0) return SCHED_FIFO;
+    if (strcmp(name, "rr") == 0) return SCHED_RR;
+    if (strcmp(name, "other") == 0) return SCHED_OTHER;
+    return fallback;
+}
+
+const char *rt_policy_to_string(int policy) {
+    switch (policy) {
+        case SCHED_FIFO: return "fifo";
+        case SCHED_RR: return "rr";
+        case SCHED_OTHER: return "other";
+        default: return "unknown";
+    }
+}
+
+void rt_thread_print_report(const rt_thread_config_t *config,
+                            const rt_thread_report_t *report) {
+    if (!config || !report) return;
+
+    printf("  %-8s requested %s/%d -> %s/%d %s",
+           config->name,
+           rt_policy_to_string(config->policy), config->priority,
+           rt_policy_to_string(report->actual_policy), report->actual_priority,
+           report->sched_applied ? "[ok]" : "[fallback]");
+    if (report->sched_error) {
+        printf(" (%s)", strerror(report->sched_error));
+    }
+
+    if (config->cpu != RT_NO_AFFINITY) {
+        printf(", cpu %d %s", config->cpu, report->affinity_applied ? "[ok]" : "[failed]");
+    }
+    if (report->stack_prefaulted) {
+        printf(", stack prefaulted");
+    }
+    printf("\n");
+}
@@ -0,0 +1,314 @@
+/**
+ * QNX Dashboard Simulator - Scenario Compiler Implementation
+ *
+ * Loading is the only expensive step: the file is read in one go, parsed
+ * by recursive-descent rules over the shared JSON reader that only
+ * understand the scenario schema (unknown keys are skipped), and every
+ * track is compiled into one contiguous allocation of start time, start
+ * value and slope.
+ * Evaluating a tick then moves each track's cursor forward (normally by
+ * zero or one segment) and does one fused multiply-add per signal.
+ */
+
+#include "../include/scenario.h"
+#include "../include/json_reader.h"
+#include "../include/signal_ring.h"
+
+/**
+ * Keyframes collected per signal while parsing
+ */
+typedef struct {
+    float *times;
+    float *values;
+    uint32_t count;
+    uint32_t capacity;
+} scenario_builder_track_t;
+
+typedef struct {
+    json_reader_t json;
+    scenario_t *scenario;
+    scenario_builder_track_t tracks[SIGNAL_COUNT];
+} scenario_parser_t;
+
+static bool signal_is_discrete(signal_id_t signal) {
+    switch (signal) {
+        case SIGNAL_GEAR_POSITION:
+        case SIGNAL_IGNITION_ON:
+        case SIGNAL_ENGINE_RUNNING:
+        case SIGNAL_PARKING_BRAKE:
+        case SIGNAL_SEATBELT_FASTENED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool builder_append(scenario_parser_t *parser, scenario_builder_track_t *track,
+                           float time_s, float value) {
+    if (track->count > 0 && time_s < track->times[track->count - 1]) {
+        return json_reader_fail(&parser->json, "keyframe times must not decrease");
+    }
+
+    if (track->count == track->capacity) {
+        uint32_t capacity = track->capacity ? track->capacity * 2 : 64;
+        float *times = realloc(track->times, capacity * sizeof(float));
+        if (!times) return json_reader_fail(&parser->json, "out of memory");
+        track->times = times;
+        float *values = realloc(track->values, capacity * sizeof(float));
+        if (!values) return json_reader_fail(&parser->json, "out of memory");
+        track->values = values;
+        track->capacity = capacity;
+    }
+
+    track->times[track->count] = time_s;
+    track->values[track->count] = value;
+    track->count++;
+    return true;
+}
+
+/* [[t, v], [t, v], ...] */
+static bool parser_keyframes(scenario_parser_t *parser, scenario_builder_track_t *track) {
+    if (!json_reader_expect(&parser->json, '[')) return false;
+    if (json_reader_accept(&parser->json, ']')) return true;
+
+    do {
+        float time_s, value;
+        if (!json_reader_expect(&parser->json, '[') || !json_reader_number(&parser->json, &time_s) ||
+            !json_reader_expect(&parser->json, ',') || !json_reader_number(&parser->json, &value) ||
+            !json_reader_expect(&parser->json, ']')) {
+            return false;
+        }
+        if (time_s < 0.0f) return json_reader_fail(&parser->json, "keyframe time is negative");
+        if (!builder_append(parser, track, time_s, value)) return false;
+    } while (json_reader_accept(&parser->json, ','));
+
+    return json_reader_expect(&parser->json, ']');
+}
+
+static bool parser_signals(scenario_parser_t *parser) {
+    if (!json_reader_expect(&parser->json, '{')) return false;
+    if (json_reader_accept(&parser->json, '}')) return true;
+
+    do {
+        const char *key;
+        size_t length;
+        if (!json_reader_string(&parser->json, &key, &length) || !json_reader_expect(&parser->json, ':')) return false;
+
+        int signal = signal_id_from_string(key, length);
+        if (signal < 0) return json_reader_fail(&parser->json, "unknown signal");
+        if (parser->tracks[signal].count > 0) return json_reader_fail(&parser->json, "duplicate signal");
+        if (!parser_keyframes(parser, &parser->tracks[signal])) return false;
+    } while (json_reader_accept(&parser->json, ','));
+
+    return json_reader_expect(&parser->json, '}');
+}
+
+static bool parser_document(scenario_parser_t *parser) {
+    scenario_t *scenario = parser->scenario;
+
+    if (!json_reader_expect(&parser->json, '{')) return false;
+    if (json_reader_accept(&parser->json, '}')) return true;
+
+    do {
+        const char *key;
+        size_t length;
+        if (!json_reader_string(&parser->json, &key, &length) || !json_reader_expect(&parser->json, ':')) return false;
+
+        if (json_key_is(key, length, "name")) {
+            if (!json_reader_string_copy(&parser->json, scenario->name, sizeof(scenario->name))) {
+                return false;
+            }
+        } else if (json_key_is(key, length, "duration")) {
+            if (!json_reader_number(&parser->json, &scenario->duration)) return false;
+        } else if (json_key_is(key, length, "signals")) {
+            if (!parser_signals(parser)) return false;
+        } else if (!json_reader_skip_value(&parser->json, 0)) {
+            return false;
+        }
+    } while (json_reader_accept(&parser->json, ','));
+
+    if (!json_reader_expect(&parser->json, '}')) return false;
+    return json_reader_finish(&parser->json);
+}
+
+/**
+ * Lay all tracks out in one allocation and precompute the slopes
+ */
+static int scenario_compile(scenario_t *scenario, const scenario_builder_track_t tracks[SIGNAL_COUNT]) {
+    uint32_t total = 0;
+    float last_time = 0.0f;
+
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        if (tracks[signal].count == 0) continue;
+        /* Implicit keyframe at t = 0 so evaluation never looks before the first */
+        total += tracks[signal].count + (tracks[signal].times[0] > 0.0f ? 1 : 0);
+        float end = tracks[signal].times[tracks[signal].count - 1];
+        if (end > last_time) last_time = end;
+    }
+
+    if (total == 0) return -1;
+
+    float *storage = malloc((size_t)total * 3 * sizeof(float));
+    if (!storage) return -1;
+    scenario->times = storage;
+    scenario->values = storage + total;
+    scenario->slopes = storage + 2 * (size_t)total;
+    scenario->keyframe_count = total;
+
+    uint32_t offset = 0;
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        const scenario_builder_track_t *source = &tracks[signal];
+        scenario_track_t *track = &scenario->tracks[signal];
+        if (source->count == 0) continue;
+
+        track->first = offset;
+        if (source->times[0] > 0.0f) {
+            scenario->times[offset] = 0.0f;
+            scenario->values[offset] = source->values[0];
+            offset++;
+        }
+        memcpy(&scenario->times[offset], source->times, source->count * sizeof(float));
+        memcpy(&scenario->values[offset], source->values, source->count * sizeof(float));
+        offset += source->count;
+        track->count = offset - track->first;
+        track->cursor = 0;
+
+        bool discrete = signal_is_discrete((signal_id_t)signal);
+        for (uint32_t i = track->first; i < offset; i++) {
+            float span = i + 1 < offset ? scenario->times[i + 1] - scenario->times[i] : 0.0f;
+            scenario->slopes[i] = (!discrete && span > 0.0f) ?
+                (scenario->values[i + 1] - scenario->values[i]) / span : 0.0f;
+        }
+    }
+
+    if (scenario->duration <= 0.0f) {
+        scenario->duration = last_time;
+    }
+    return 0;
+}
+
+/**
+ * Parse and compile a scenario held in memory
+ */
+int scenario_parse(scenario_t *scenario, const char *json, size_t length) {
+    if (!scenario || !json) return -1;
+
+    memset(scenario, 0, sizeof(scenario_t));
+
+    scenario_parser_t parser;
+    memset(&parser, 0, sizeof(parser));
+    json_reader_init(&parser.json, json, length);
+    parser.scenario = scenario;
+
+    int result = parser_document(&parser) ? scenario_compile(scenario, parser.tracks) : -1;
+    if (result != 0 && parser.json.error[0] == '\0') {
+        snprintf(parser.json.error, sizeof(parser.json.error), "no keyframes");
+    }
+
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        free(parser.tracks[signal].times);
+        free(parser.tracks[signal].values);
+    }
+
+    if (result != 0) {
+        fprintf(stderr, "Scenario: %s\n", parser.json.error);
+        scenario_free(scenario);
+        return -1;
+    }
+
+    scenario->loaded = true;
+    return 0;
+}
+
+/**
+ * Read and compile a scenario file
+ */
+int scenario_load(scenario_t *scenario, const char *filename) {
+    if (!scenario || !filename) return -1;
+
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        fprintf(stderr, "Scenario: cannot open %s: %s\n", filename, strerror(errno));
+        return -1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0 || size > SCENARIO_MAX_FILE_BYTES) {
+        fprintf(stderr, "Scenario: %s has an unsupported size\n", filename);
+        fclose(file);
+        return -1;
+    }
+
+    /* NUL-terminated so strtod() cannot run off the end */
+    char *json = malloc((size_t)size + 1);
+    if (!json) {
+        fclose(file);
+        return -1;
+    }
+    size_t read_bytes = fread(json, 1, (size_t)size, file);
+    fclose(file);
+    json[read_bytes] = '\0';
+
+    int result = scenario_parse(scenario, json, read_bytes);
+    free(json);
+
+    if (result == 0) {
+        printf("Loaded scenario '%s' from %s: %u keyframes, %.1f s\n",
+               scenario->name[0] ? scenario->name : "unnamed", filename,
+               scenario->keyframe_count, scenario->duration);
+    }
+    return result;
+}
+
+void scenario_free(scenario_t *scenario) {
+    if (!scenario) return;
+
+    free(scenario->times);  /* values and slopes share this block */
+    memset(scenario, 0, sizeof(scenario_t));
+}
+
+/**
+ * Rewind every track to its first keyframe
+ */
+void scenario_reset(scenario_t *scenario) {
+    if (!scenario) return;
+
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        scenario->tracks[signal].cursor = 0;
+    }
+}
+
+/**
+ * Evaluate all driven signals at time_s
+ *
+ * Only entries for signals the scenario drives are written.
+ */
+void scenario_evaluate(scenario_t *scenario, float time_s, float values[SIGNAL_COUNT]) {
+    if (!scenario || !scenario->loaded || !values) return;
+
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        scenario_track_t *track = &scenario->tracks[signal];
+        if (track->count == 0) continue;
+
+        const float *times = scenario->times + track->first;
+        uint32_t cursor = track->cursor;
+
+        /* Time went backwards (loop or reset): restart the walk */
+        if (time_s < times[cursor]) cursor = 0;
+        while (cursor + 1 < track->count && times[cursor + 1] <= time_s) {
+            cursor++;
+        }
+        track->cursor = cursor;
+
+        uint32_t key = track->first + cursor;
+        values[signal] = fmaf(scenario->slopes[key], time_s - scenario->times[key],
+                              scenario->values[key]);
+    }
+}
+
+bool scenario_drives_signal(const scenario_t *scenario, signal_id_t signal) {
+    return scenario && scenario->loaded && signal < SIGNAL_COUNT &&
+           scenario->tracks[signal].count > 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * QNX Dashboard Simulator - Signal Ingest Ring Implementation
+ *
+ * Indices run freely and are masked on access, so head - tail is always the
+ * fill level. The producer publishes a sample with a release store of head;
+ * the consumer copies a whole batch and then claims it by moving tail.
+ *
+ * Drop-oldest eviction lets the producer move tail as well. A sample can only
+ * be overwritten after tail has passed it, so once the consumer's claim CAS
+ * succeeds every copied entry at or above the tail value it saw is intact.
+ */
+
+#include "../include/signal_ring.h"
+
+#define SIGNAL_RING_MASK (SIGNAL_RING_CAPACITY - 1)
+
+#if (SIGNAL_RING_CAPACITY & SIGNAL_RING_MASK) != 0
+#error "SIGNAL_RING_CAPACITY must be a power of two"
+#endif
+
+/**
+ * Initialize an empty ring
+ */
+void signal_ring_init(signal_ring_t *ring, signal_ring_policy_t policy) {
+    if (!ring) return;
+
+    memset(ring, 0, sizeof(signal_ring_t));
+    ring->policy = policy;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * Queue one sample (single producer only)
+ *
+ * Returns false if the sample was rejected (DROP_NEWEST with a full ring).
+ */
+bool signal_ring_push(signal_ring_t *ring, uint32_t signal, float value, uint64_t timestamp_ns) {
+    if (!ring) return false;
+
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= SIGNAL_RING_CAPACITY) {
+        if (ring->policy == SIGNAL_RING_DROP_NEWEST) {
+            ring->dropped_newest++;
+            return false;
+        }
+
+        /* Evict the oldest entry unless the consumer freed space meanwhile */
+        if (__atomic_compare_exchange_n(&ring->tail, &tail, tail + 1, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            ring->dropped_oldest++;
+        }
+    }
+
+    signal_sample_t *slot = &ring->samples[head & SIGNAL_RING_MASK];
+    slot->timestamp_ns = timestamp_ns;
+    slot->signal = signal;
+    slot->value = value;
+
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    ring->pushed++;
+    return true;
+}
+
+/**
+ * Copy up to max_samples queued samples, oldest first (single consumer only)
+ *
+ * Returns the number of samples written to out.
+ */
+uint32_t signal_ring_pop_batch(signal_ring_t *ring, signal_sample_t *out, uint32_t max_samples) {
+    if (!ring || !out || max_samples == 0) return 0;
+
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t available = head - tail;
+    if (available == 0) return 0;
+    if (available > SIGNAL_RING_CAPACITY) available = SIGNAL_RING_CAPACITY;
+    if (available > max_samples) available = max_samples;
+
+    for (uint32_t i = 0; i < available; i++) {
+        out[i] = ring->samples[(tail + i) & SIGNAL_RING_MASK];
+    }
+
+    /* Claim the batch; the producer may have evicted part of it */
+    uint32_t end = tail + available;
+    uint32_t current = tail;
+    while (!__atomic_compare_exchange_n(&ring->tail, &current, end, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        if ((int32_t)(end - current) <= 0) {
+            return 0; /* Whole batch evicted; tail already past it */
+        }
+    }
+
+    uint32_t skipped = current - tail;
+    uint32_t count = available - skipped;
+    if (skipped > 0) {
+        memmove(out, out + skipped, count * sizeof(signal_sample_t));
+    }
+
+    ring->popped += count;
+    ring->batches++;
+    return count;
+}
+
+/**
+ * Approximate fill level (exact when called by either endpoint at rest)
+ */
+uint32_t signal_ring_size(const signal_ring_t *ring) {
+    if (!ring) return 0;
+
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+/**
+ * Utility functions
+ */
+static const char *const g_signal_names[SIGNAL_COUNT] = {
+    "speed_kmh", "rpm", "acceleration", "fuel_level", "engine_temp",
+    "oil_pressure", "battery_voltage", "alternator_current", "gear_position",
+    "ignition_on", "engine_running", "parking_brake", "seatbelt_fastened"
+};
+
+const char *signal_id_to_string(signal_id_t signal) {
+    return signal < SIGNAL_COUNT ? g_signal_names[signal] : "unknown";
+}
+
+/* Returns the signal_id_t for a (not necessarily NUL-terminated) name, or -1 */
+int signal_id_from_string(const char *name, size_t length) {
+    if (!name) return -1;
+    for (int i = 0; i < SIGNAL_COUNT; i++) {
+        if (strlen(g_signal_names[i]) == length && strncmp(g_signal_names[i], name, length) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+signal_ring_policy_t signal_ring_policy_from_string(const char *name,
+                                                    signal_ring_policy_t fallback) {
+    if (!name) return fallback;
+    if (strcmp(name, "drop_oldest") == 0) return SIGNAL_RING_DROP_OLDEST;
+    if (strcmp(name, "drop_newest") == 0) return SIGNAL_RING_DROP_NEWEST;
+    return fallback;
+}
+
+const char *signal_ring_policy_to_string(signal_ring_policy_t policy) {
+    switch (policy) {
+        case SIGNAL_RING_DROP_OLDEST: return "drop_oldest";
+        case SIGNAL_RING_DROP_NEWEST: return "drop_newest";
+        default: return "unknown";
+    }
+}
+
+void signal_ring_print_statistics(const signal_ring_t *ring) {
+    if (!ring) return;
+
+    printf("=== Signal Ingest Ring ===\n");
+    printf("Policy: %s, Capacity: %d\n",
+           signal_ring_policy_to_string(ring->policy), SIGNAL_RING_CAPACITY);
+    printf("Pushed: %llu, Popped: %llu in %llu batches\n",
+           (unsigned long long)ring->pushed,
+           (unsigned long long)ring->popped,
+           (unsigned long long)ring->batches);
+    printf("Dropped: %llu oldest, %llu newest\n",
+           (unsigned long long)ring->dropped_oldest,
+           (unsigned long long)ring->dropped_newest);
+}
@@ -0,0 +1,196 @@
+/**
+ * QNX Dashboard Simulator - Simulator Pool Implementation
+ *
+ * Workers are created once and parked on a condition variable between
+ * batches. A batch hands out simulators in small chunks through an atomic
+ * counter, which balances uneven modes without a shared queue. Worker w is
+ * pinned to CPU w modulo the online CPU count and runs SCHED_OTHER so the
+ * pool never competes with the dashboard's real-time threads.
+ */
+
+#include "../include/simulator_pool.h"
+#include "../include/data_simulator.h"
+#include "../include/scenario.h"
+#include "../include/replay.h"
+#include "../include/rt_thread.h"
+
+static void *simulator_pool_worker(void *arg) {
+    simulator_pool_t *pool = (simulator_pool_t *)arg;
+    uint64_t seen_generation = 0;
+    
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen_generation) {
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        }
+        if (pool->shutdown) break;
+        
+        seen_generation = pool->generation;
+        float delta_time = pool->delta_time;
+        uint32_t steps = pool->steps;
+        pthread_mutex_unlock(&pool->lock);
+        
+        for (;;) {
+            uint32_t first = __atomic_fetch_add(&pool->next_simulator, SIMULATOR_POOL_CHUNK,
+                                                __ATOMIC_RELAXED);
+            if (first >= pool->simulator_count) break;
+            
+            uint32_t last = first + SIMULATOR_POOL_CHUNK;
+            if (last > pool->simulator_count) last = pool->simulator_count;
+            
+            for (uint32_t i = first; i < last; i++) {
+                for (uint32_t step = 0; step < steps; step++) {
+                    data_simulator_update(&pool->simulators[i], delta_time);
+                }
+            }
+        }
+        
+        pthread_mutex_lock(&pool->lock);
+        if (++pool->workers_done == pool->worker_count) {
+            pthread_cond_signal(&pool->done_cond);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    return NULL;
+}
+
+/**
+ * Create simulators and start the workers
+ *
+ * Simulator i is seeded with i + 1 so every instance produces its own
+ * data. workers = 0 uses one worker per online CPU.
+ */
+int simulator_pool_init(simulator_pool_t *pool, uint32_t simulators, uint32_t workers) {
+    if (!pool || simulators == 0) return -1;
+    
+    memset(pool, 0, sizeof(simulator_pool_t));
+    
+    if (workers == 0) workers = simulator_pool_default_workers();
+    if (workers > SIMULATOR_POOL_MAX_WORKERS) workers = SIMULATOR_POOL_MAX_WORKERS;
+    
+    void *storage = NULL;
+    if (posix_memalign(&storage, CACHE_LINE_SIZE, (size_t)simulators * sizeof(data_simulator_t)) != 0) {
+        fprintf(stderr, "Simulator pool: cannot allocate %u simulators\n", simulators);
+        return -1;
+    }
+    pool->simulators = (data_simulator_t *)storage;
+    pool->simulator_count = simulators;
+    
+    for (uint32_t i = 0; i < simulators; i++) {
+        data_simulator_reset(&pool->simulators[i], i + 1);
+    }
+    
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) online = 1;
+    
+    for (uint32_t w = 0; w < workers; w++) {
+        rt_thread_config_t config;
+        rt_thread_report_t report;
+        memset(&config, 0, sizeof(config));
+        config.name = "sim_pool";
+        config.policy = SCHED_OTHER;
+        config.cpu = (int)(w % (uint32_t)online);
+        
+        int error = rt_thread_create(&pool->workers[w], &config, simulator_pool_worker, pool, &report);
+        if (error != 0) {
+            fprintf(stderr, "Simulator pool: cannot start worker %u: %s\n", w, strerror(error));
+            pool->worker_count = w;
+            simulator_pool_destroy(pool);
+            return -1;
+        }
+        pool->worker_count = w + 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * Advance every simulator by steps updates of delta_time
+ *
+ * Blocks until the batch is complete; simulators may be read freely
+ * between runs.
+ */
+void simulator_pool_run(simulator_pool_t *pool, float delta_time, uint32_t steps) {
+    if (!pool || pool->worker_count == 0 || steps == 0) return;
+    
+    uint64_t start_ns = get_timestamp_ns();
+    
+    pthread_mutex_lock(&pool->lock);
+    pool->delta_time = delta_time;
+    pool->steps = steps;
+    pool->workers_done = 0;
+    __atomic_store_n(&pool->next_simulator, 0, __ATOMIC_RELAXED);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_cond);
+    
+    while (pool->workers_done < pool->worker_count) {
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    pool->run_time_ns += get_timestamp_ns() - start_ns;
+    pool->batches++;
+    pool->simulator_updates += (uint64_t)pool->simulator_count * steps;
+}
+
+/**
+ * Stop the workers and release the simulators
+ */
+void simulator_pool_destroy(simulator_pool_t *pool) {
+    if (!pool || !pool->simulators) return;
+    
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (uint32_t w = 0; w < pool->worker_count; w++) {
+        pthread_join(pool->workers[w], NULL);
+    }
+    
+    for (uint32_t i = 0; i < pool->simulator_count; i++) {
+        if (replay_is_open(&pool->simulators[i].replay)) {
+            replay_close(&pool->simulators[i].replay);
+        }
+        scenario_free(&pool->simulators[i].scenario);
+    }
+    free(pool->simulators);
+    
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+    memset(pool, 0, sizeof(simulator_pool_t));
+}
+
+/**
+ * Utility functions
+ */
+data_simulator_t *simulator_pool_get(simulator_pool_t *pool, uint32_t index) {
+    if (!pool || index >= pool->simulator_count) return NULL;
+    return &pool->simulators[index];
+}
+
+uint32_t simulator_pool_default_workers(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) return 1;
+    if (online > SIMULATOR_POOL_MAX_WORKERS) return SIMULATOR_POOL_MAX_WORKERS;
+    return (uint32_t)online;
+}
+
+void simulator_pool_print_statistics(const simulator_pool_t *pool) {
+    if (!pool) return;
+    
+    printf("Simulator Pool Statistics:\n");
+    printf("  Simulators: %u, workers: %u\n", pool->simulator_count, pool->worker_count);
+    printf("  Batches: %llu, updates: %llu\n",
+           (unsigned long long)pool->batches, (unsigned long long)pool->simulator_updates);
+    if (pool->run_time_ns > 0) {
+        printf("  Throughput: %.2f M updates/s\n",
+               (double)pool->simulator_updates * 1e3 / (double)pool->run_time_ns);
+    }
+}
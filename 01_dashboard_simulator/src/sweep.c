@@ -0,0 +1,288 @@
+/**
+ * QNX Dashboard Simulator - Parameter Sweep Implementation
+ *
+ * Each run is a headless data_simulator_t stepped as fast as the CPU
+ * allows: a full-throttle launch until 100 km/h, limited only by engine
+ * power, road load and grip, then the realistic driving model for the
+ * rest of duration_s. Runs share nothing, so
+ * workers just claim the next run index with an atomic increment and
+ * write their result into a slot nobody else touches; throughput scales
+ * with the number of cores.
+ */
+
+#include "../include/sweep.h"
+#include "../include/data_simulator.h"
+#include "../include/rng.h"
+#include "../include/rt_thread.h"
+
+static const char *g_sweep_param_names[SWEEP_PARAM_COUNT] = {
+    "vehicle_mass_kg",
+    "drag_coefficient",
+    "rolling_resistance",
+    "engine_power_kw"
+};
+
+/**
+ * Default configuration: 2 minutes per run, ranges around the defaults
+ */
+void sweep_init(sweep_t *sweep, uint32_t runs) {
+    if (!sweep) return;
+    
+    memset(sweep, 0, sizeof(sweep_t));
+    sweep->runs = runs;
+    sweep->duration_s = SWEEP_DEFAULT_DURATION_S;
+    sweep->step_s = 1.0f / DATA_UPDATE_RATE_HZ;
+    sweep->seed = 1;
+    
+    sweep_set_range(sweep, SWEEP_PARAM_MASS, 1000.0f, 2500.0f);
+    sweep_set_range(sweep, SWEEP_PARAM_DRAG, 0.25f, 0.45f);
+    sweep_set_range(sweep, SWEEP_PARAM_ROLLING, 0.008f, 0.02f);
+    sweep_set_range(sweep, SWEEP_PARAM_POWER, 60.0f, 250.0f);
+}
+
+int sweep_set_range(sweep_t *sweep, sweep_param_t param, float min_value, float max_value) {
+    if (!sweep || param >= SWEEP_PARAM_COUNT) return -1;
+    if (!(min_value <= max_value) || min_value < 0.0f) return -1;
+    
+    sweep->range_min[param] = min_value;
+    sweep->range_max[param] = max_value;
+    return 0;
+}
+
+/**
+ * Parse "name=min:max" (or "name=value" for a fixed parameter)
+ */
+int sweep_parse_range(sweep_t *sweep, const char *spec) {
+    if (!sweep || !spec) return -1;
+    
+    const char *equals = strchr(spec, '=');
+    if (!equals) return -1;
+    
+    size_t name_length = (size_t)(equals - spec);
+    for (int param = 0; param < SWEEP_PARAM_COUNT; param++) {
+        const char *name = g_sweep_param_names[param];
+        if (strlen(name) != name_length || strncmp(spec, name, name_length) != 0) continue;
+        
+        char *end;
+        float min_value = strtof(equals + 1, &end);
+        if (end == equals + 1) return -1;
+        float max_value = min_value;
+        if (*end == ':') {
+            const char *max_text = end + 1;
+            max_value = strtof(max_text, &end);
+            if (end == max_text) return -1;
+        }
+        if (*end != '\0') return -1;
+        return sweep_set_range(sweep, (sweep_param_t)param, min_value, max_value);
+    }
+    return -1;
+}
+
+/**
+ * Simulate one run (deterministic for a given seed and run index)
+ */
+void sweep_run_one(const sweep_t *sweep, uint32_t run, sweep_result_t *result) {
+    if (!sweep || !result) return;
+    
+    rng_t rng;
+    rng_seed(&rng, sweep->seed + (uint64_t)run * 0x9E3779B97F4A7C15ULL);
+    
+    memset(result, 0, sizeof(sweep_result_t));
+    for (int param = 0; param < SWEEP_PARAM_COUNT; param++) {
+        result->params[param] = sweep->range_min[param] +
+            rng_uniform(&rng) * (sweep->range_max[param] - sweep->range_min[param]);
+    }
+    
+    data_simulator_t sim;
+    uint64_t sim_seed = (uint64_t)rng_next(&rng) << 32;
+    sim_seed |= rng_next(&rng);
+    data_simulator_reset(&sim, sim_seed);
+    sim.vehicle_mass = result->params[SWEEP_PARAM_MASS];
+    sim.drag_coefficient = result->params[SWEEP_PARAM_DRAG];
+    sim.rolling_resistance = result->params[SWEEP_PARAM_ROLLING];
+    sim.engine_power = result->params[SWEEP_PARAM_POWER];
+    
+    const vehicle_data_t *data = &sim.current_data;
+    float start_fuel = data->fuel_level;
+    uint32_t steps = (uint32_t)(sweep->duration_s / sweep->step_s);
+    
+    result->zero_to_100_s = -1.0f;
+    result->peak_engine_temp = data->engine_temp;
+    
+    for (uint32_t step = 0; step < steps; step++) {
+        float time_s = (float)step * sweep->step_s;
+        bool launching = result->zero_to_100_s < 0.0f && time_s < SWEEP_LAUNCH_TIMEOUT_S;
+        sim.full_throttle = launching;
+        if (launching) {
+            /* Hold the driver's target until the launch is measured */
+            sim.target_speed = SWEEP_LAUNCH_TARGET_KMH;
+            sim.speed_change_timer = 0.0f;
+        }
+        
+        data_simulator_update(&sim, sweep->step_s);
+        
+        if (launching && data->speed_kmh >= 100.0f) {
+            result->zero_to_100_s = time_s + sweep->step_s;
+        }
+        if (data->engine_temp > result->peak_engine_temp) {
+            result->peak_engine_temp = data->engine_temp;
+        }
+        if (data->speed_kmh > result->max_speed_kmh) {
+            result->max_speed_kmh = data->speed_kmh;
+        }
+        result->distance_km += data->speed_kmh * sweep->step_s / 3600.0f;
+    }
+    
+    /* Including the burn the simulator has not yet taken off fuel_level */
+    result->fuel_used_pct = start_fuel - data->fuel_level + sim.fuel_burn_pct;
+}
+
+static void *sweep_worker(void *arg) {
+    sweep_t *sweep = (sweep_t *)arg;
+    
+    for (;;) {
+        uint32_t run = __atomic_fetch_add(&sweep->next_run, 1, __ATOMIC_RELAXED);
+        if (run >= sweep->runs) break;
+        sweep_run_one(sweep, run, &sweep->results[run]);
+    }
+    return NULL;
+}
+
+/**
+ * Run every configured simulation across the workers
+ *
+ * Blocks until all runs are complete. Returns 0 on success.
+ */
+int sweep_run(sweep_t *sweep) {
+    if (!sweep || sweep->runs == 0 || sweep->step_s <= 0.0f) return -1;
+    
+    free(sweep->results);
+    sweep->results = calloc(sweep->runs, sizeof(sweep_result_t));
+    if (!sweep->results) {
+        fprintf(stderr, "Sweep: cannot allocate %u results\n", sweep->runs);
+        return -1;
+    }
+    
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) online = 1;
+    uint32_t workers = sweep->worker_count ? sweep->worker_count : (uint32_t)online;
+    if (workers > SWEEP_MAX_WORKERS) workers = SWEEP_MAX_WORKERS;
+    if (workers > sweep->runs) workers = sweep->runs;
+    
+    pthread_t threads[SWEEP_MAX_WORKERS];
+    uint32_t started = 0;
+    __atomic_store_n(&sweep->next_run, 0, __ATOMIC_RELAXED);
+    uint64_t start_ns = get_timestamp_ns();
+    
+    for (uint32_t w = 0; w < workers; w++) {
+        rt_thread_config_t config;
+        rt_thread_report_t report;
+        memset(&config, 0, sizeof(config));
+        config.name = "sweep";
+        config.policy = SCHED_OTHER;
+        config.cpu = (int)(w % (uint32_t)online);
+        
+        int error = rt_thread_create(&threads[w], &config, sweep_worker, sweep, &report);
+        if (error != 0) {
+            fprintf(stderr, "Sweep: cannot start worker %u: %s\n", w, strerror(error));
+            break;
+        }
+        started++;
+    }
+    
+    /* Whatever started finishes the work; with no workers run inline */
+    if (started == 0) {
+        sweep_worker(sweep);
+    }
+    for (uint32_t w = 0; w < started; w++) {
+        pthread_join(threads[w], NULL);
+    }
+    
+    sweep->wall_time_ns = get_timestamp_ns() - start_ns;
+    sweep->worker_count = started ? started : 1;
+    return 0;
+}
+
+void sweep_free(sweep_t *sweep) {
+    if (!sweep) return;
+    
+    free(sweep->results);
+    sweep->results = NULL;
+}
+
+/**
+ * Write one CSV row per run
+ */
+int sweep_write_csv(const sweep_t *sweep, const char *path) {
+    if (!sweep || !sweep->results || !path) return -1;
+    
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Sweep: cannot create %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    
+    fprintf(file, "run");
+    for (int param = 0; param < SWEEP_PARAM_COUNT; param++) {
+        fprintf(file, ",%s", g_sweep_param_names[param]);
+    }
+    fprintf(file, ",zero_to_100_s,fuel_used_pct,peak_engine_temp_c,distance_km,max_speed_kmh\n");
+    
+    for (uint32_t run = 0; run < sweep->runs; run++) {
+        const sweep_result_t *r = &sweep->results[run];
+        fprintf(file, "%u,%.1f,%.4f,%.5f,%.1f,%.2f,%.6g,%.2f,%.3f,%.1f\n", run,
+                r->params[SWEEP_PARAM_MASS], r->params[SWEEP_PARAM_DRAG],
+                r->params[SWEEP_PARAM_ROLLING], r->params[SWEEP_PARAM_POWER],
+                r->zero_to_100_s, r->fuel_used_pct, r->peak_engine_temp,
+                r->distance_km, r->max_speed_kmh);
+    }
+    
+    int error = ferror(file);
+    if (fclose(file) != 0 || error) {
+        fprintf(stderr, "Sweep: write to %s failed\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+void sweep_print_summary(const sweep_t *sweep) {
+    if (!sweep || !sweep->results || sweep->runs == 0) return;
+    
+    double sum_launch = 0.0, sum_fuel = 0.0, sum_temp = 0.0;
+    float min_launch = 1e9f, max_launch = 0.0f, max_temp = 0.0f;
+    uint32_t launched = 0;
+    
+    for (uint32_t run = 0; run < sweep->runs; run++) {
+        const sweep_result_t *r = &sweep->results[run];
+        if (r->zero_to_100_s >= 0.0f) {
+            launched++;
+            sum_launch += r->zero_to_100_s;
+            if (r->zero_to_100_s < min_launch) min_launch = r->zero_to_100_s;
+            if (r->zero_to_100_s > max_launch) max_launch = r->zero_to_100_s;
+        }
+        sum_fuel += r->fuel_used_pct;
+        sum_temp += r->peak_engine_temp;
+        if (r->peak_engine_temp > max_temp) max_temp = r->peak_engine_temp;
+    }
+    
+    double simulated_s = (double)sweep->runs * sweep->duration_s;
+    double wall_s = (double)sweep->wall_time_ns / 1e9;
+    
+    printf("=== Parameter Sweep Summary ===\n");
+    printf("Runs: %u x %.0f s simulated, %u workers\n", sweep->runs, sweep->duration_s,
+           sweep->worker_count);
+    printf("Wall time: %.2f s (%.0f runs/s, %.0fx real time)\n", wall_s,
+           wall_s > 0.0 ? sweep->runs / wall_s : 0.0, wall_s > 0.0 ? simulated_s / wall_s : 0.0);
+    if (launched > 0) {
+        printf("0-100 km/h: mean %.2f s, range %.2f-%.2f s (%u of %u runs reached 100)\n",
+               sum_launch / launched, min_launch, max_launch, launched, sweep->runs);
+    } else {
+        printf("0-100 km/h: never reached\n");
+    }
+    printf("Fuel used: mean %.4g%%\n", sum_fuel / sweep->runs);
+    printf("Peak engine temp: mean %.1f°C, max %.1f°C\n", sum_temp / sweep->runs, max_temp);
+}
+
+const char *sweep_param_name(sweep_param_t param) {
+    return param < SWEEP_PARAM_COUNT ? g_sweep_param_names[param] : "unknown";
+}
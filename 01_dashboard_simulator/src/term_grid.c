@@ -0,0 +1,530 @@
+/**
+ * QNX Dashboard Simulator - Terminal Cell Grid Implementation
+ *
+ * The application draws a whole frame into the back buffer; rendering
+ * compares it cell by cell with the front buffer (what the terminal
+ * already shows) and encodes only the differences. Cursor moves are
+ * skipped or replaced by re-sending a few unchanged cells when that is
+ * shorter, and SGR attributes are only sent when they change. The frame
+ * leaves in one write(), so a steady dashboard costs a few dozen bytes
+ * instead of a clear-screen and a full repaint.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include "../include/term_grid.h"
+
+/* Worst case per cell: cursor move, full SGR and the glyph */
+#define TERM_CELL_OUT_BYTES   32
+#define TERM_FRAME_OUT_BYTES  64
+
+static uint64_t term_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void term_cell_blank(term_cell_t *cell, uint16_t attr) {
+    static const term_cell_t blank = { { ' ' }, TERM_ATTR_NORMAL, 1, 0 };
+    *cell = blank;
+    cell->attr = attr;
+}
+
+/**
+ * Decode one UTF-8 sequence; malformed bytes decode as U+FFFD
+ */
+static int term_utf8_decode(const unsigned char *s, uint32_t *codepoint) {
+    int length;
+    uint32_t value;
+    
+    if (s[0] < 0x80) { *codepoint = s[0]; return 1; }
+    else if ((s[0] & 0xE0) == 0xC0) { length = 2; value = s[0] & 0x1F; }
+    else if ((s[0] & 0xF0) == 0xE0) { length = 3; value = s[0] & 0x0F; }
+    else if ((s[0] & 0xF8) == 0xF0) { length = 4; value = s[0] & 0x07; }
+    else { *codepoint = 0xFFFD; return 1; }
+    
+    for (int i = 1; i < length; i++) {
+        if ((s[i] & 0xC0) != 0x80) { *codepoint = 0xFFFD; return i; }
+        value = (value << 6) | (s[i] & 0x3F);
+    }
+    *codepoint = value;
+    return length;
+}
+
+/**
+ * Columns a code point occupies (a wcwidth() subset for what we draw)
+ */
+static int term_codepoint_width(uint32_t cp) {
+    if (cp < 0x0300) return 1;
+    
+    /* Combining marks, zero-width joiners and variation selectors */
+    if ((cp >= 0x0300 && cp <= 0x036F) || (cp >= 0x200B && cp <= 0x200F) ||
+        (cp >= 0x20D0 && cp <= 0x20FF) || (cp >= 0xFE00 && cp <= 0xFE0F)) {
+        return 0;
+    }
+    
+    /* East Asian wide and emoji presentation */
+    if ((cp >= 0x1100 && cp <= 0x115F) || (cp >= 0x2E80 && cp <= 0xA4CF) ||
+        (cp >= 0xAC00 && cp <= 0xD7A3) || (cp >= 0xF900 && cp <= 0xFAFF) ||
+        (cp >= 0xFF00 && cp <= 0xFF60) || (cp >= 0xFFE0 && cp <= 0xFFE6) ||
+        (cp >= 0x1F300 && cp <= 0x1F64F) || (cp >= 0x1F680 && cp <= 0x1F6FF) ||
+        (cp >= 0x1F900 && cp <= 0x1F9FF) ||
+        cp == 0x231A || cp == 0x231B || cp == 0x23F0 || cp == 0x23F3 ||
+        cp == 0x26A1 || cp == 0x26D4 || cp == 0x26FD || cp == 0x2705 ||
+        cp == 0x274C || cp == 0x2757 || cp == 0x2B50 || cp == 0x2B55) {
+        return 2;
+    }
+    return 1;
+}
+
+/**
+ * Allocate both buffers; the first render clears the screen
+ */
+int term_grid_init(term_grid_t *grid, int rows, int cols) {
+    if (!grid || rows < 1 || cols < 1 || rows > TERM_GRID_MAX_ROWS || cols > TERM_GRID_MAX_COLS) {
+        return -1;
+    }
+    
+    memset(grid, 0, sizeof(term_grid_t));
+    grid->rows = rows;
+    grid->cols = cols;
+    grid->back = malloc((size_t)rows * cols * sizeof(term_cell_t));
+    grid->front = malloc((size_t)rows * cols * sizeof(term_cell_t));
+    grid->out_capacity = (size_t)rows * cols * TERM_CELL_OUT_BYTES + TERM_FRAME_OUT_BYTES;
+    grid->out = malloc(grid->out_capacity);
+    
+    if (!grid->back || !grid->front || !grid->out) {
+        term_grid_free(grid);
+        return -1;
+    }
+    
+    term_grid_clear(grid, TERM_ATTR_NORMAL);
+    term_grid_invalidate(grid);
+    return 0;
+}
+
+void term_grid_free(term_grid_t *grid) {
+    if (!grid) return;
+    
+    free(grid->back);
+    free(grid->front);
+    free(grid->out);
+    grid->back = NULL;
+    grid->front = NULL;
+    grid->out = NULL;
+}
+
+void term_grid_clear(term_grid_t *grid, uint16_t attr) {
+    if (!grid || !grid->back) return;
+    
+    /* Doubling copies: a per-cell loop stalls on store forwarding */
+    size_t total = (size_t)grid->rows * grid->cols;
+    term_cell_blank(&grid->back[0], attr);
+    for (size_t done = 1; done < total; done *= 2) {
+        size_t count = done < total - done ? done : total - done;
+        memcpy(&grid->back[done], grid->back, count * sizeof(term_cell_t));
+    }
+}
+
+/**
+ * Forget what the terminal shows (after other output or a resize)
+ */
+void term_grid_invalidate(term_grid_t *grid) {
+    if (!grid) return;
+    grid->full_redraw = true;
+}
+
+/**
+ * Store one glyph, blanking any wide glyph it cuts in half
+ */
+static void term_grid_set_cell(term_grid_t *grid, int row, int col, const char *glyph,
+                               int length, uint16_t attr, int width) {
+    term_cell_t *cell = &grid->back[row * grid->cols + col];
+    
+    if (cell->width == 0 && col > 0) {
+        term_cell_blank(cell - 1, cell[-1].attr);
+    }
+    if (cell->width == 2 && col + 1 < grid->cols) {
+        term_cell_blank(cell + 1, cell[1].attr);
+    }
+    if (width == 2 && cell[1].width == 2 && col + 2 < grid->cols) {
+        term_cell_blank(cell + 2, cell[2].attr);
+    }
+    
+    /* Field stores: building a cell on the stack and copying it stalls */
+    memset(cell->glyph, 0, TERM_GLYPH_BYTES);
+    for (int i = 0; i < length; i++) {
+        cell->glyph[i] = glyph[i];
+    }
+    cell->attr = attr;
+    cell->width = (uint8_t)width;
+    cell->reserved = 0;
+    
+    if (width == 2) {
+        memset(cell[1].glyph, 0, TERM_GLYPH_BYTES);
+        cell[1].attr = attr;
+        cell[1].width = 0;
+        cell[1].reserved = 0;
+    }
+}
+
+int term_grid_put(term_grid_t *grid, int row, int col, uint16_t attr, const char *text) {
+    if (!grid || !text || row < 0 || row >= grid->rows || col < 0) return col;
+    
+    const unsigned char *s = (const unsigned char *)text;
+    int last_col = -1;
+    
+    while (*s) {
+        uint32_t codepoint;
+        int length = term_utf8_decode(s, &codepoint);
+        int width = term_codepoint_width(codepoint);
+        
+        if (width == 0) {
+            /* Attach to the previous glyph if it has room */
+            if (last_col >= 0) {
+                term_cell_t *cell = &grid->back[row * grid->cols + last_col];
+                size_t used = strlen(cell->glyph);
+                if (used + (size_t)length < TERM_GLYPH_BYTES) {
+                    memcpy(cell->glyph + used, s, (size_t)length);
+                }
+            }
+        } else {
+            if (col + width > grid->cols) break;
+            if (codepoint == 0xFFFD) {
+                term_grid_set_cell(grid, row, col, "?", 1, attr, 1);
+            } else {
+                term_grid_set_cell(grid, row, col, (const char *)s, length, attr, width);
+            }
+            last_col = col;
+            col += width;
+        }
+        s += length;
+    }
+    return col;
+}
+
+int term_grid_printf(term_grid_t *grid, int row, int col, uint16_t attr, const char *format, ...) {
+    char text[TERM_GRID_MAX_COLS * 4 + 1];
+    va_list args;
+    
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    
+    return term_grid_put(grid, row, col, attr, text);
+}
+
+int term_grid_fill(term_grid_t *grid, int row, int col, int count, uint16_t attr, const char *glyph) {
+    if (!grid || !glyph || row < 0 || row >= grid->rows || col < 0) return col;
+    
+    /* Decode once, then stamp cells */
+    uint32_t codepoint;
+    int length = term_utf8_decode((const unsigned char *)glyph, &codepoint);
+    int width = term_codepoint_width(codepoint);
+    if (width == 0 || glyph[length] != '\0' || codepoint == 0xFFFD) {
+        for (int i = 0; i < count; i++) {
+            int next = term_grid_put(grid, row, col, attr, glyph);
+            if (next == col) break;
+            col = next;
+        }
+        return col;
+    }
+    
+    for (int i = 0; i < count && col + width <= grid->cols; i++) {
+        term_grid_set_cell(grid, row, col, glyph, length, attr, width);
+        col += width;
+    }
+    return col;
+}
+
+/**
+ * Pre-decode one glyph so per-frame drawing is a plain cell copy
+ */
+void term_cell_make(term_cell_t *cell, const char *glyph, uint16_t attr) {
+    if (!cell) return;
+    
+    term_cell_blank(cell, attr);
+    if (!glyph || !*glyph) return;
+    
+    uint32_t codepoint;
+    int length = term_utf8_decode((const unsigned char *)glyph, &codepoint);
+    int width = term_codepoint_width(codepoint);
+    if (width == 0 || codepoint == 0xFFFD) return;
+    
+    /* Keep trailing variation selectors when they fit */
+    size_t total = strlen(glyph);
+    if (total >= TERM_GLYPH_BYTES) total = (size_t)length;
+    memset(cell->glyph, 0, TERM_GLYPH_BYTES);
+    memcpy(cell->glyph, glyph, total);
+    cell->width = (uint8_t)width;
+}
+
+int term_grid_put_cell(term_grid_t *grid, int row, int col, const term_cell_t *cell) {
+    if (!grid || !cell || row < 0 || row >= grid->rows || col < 0 ||
+        col + cell->width > grid->cols || cell->width == 0) {
+        return col;
+    }
+    
+    term_cell_t *target = &grid->back[row * grid->cols + col];
+    if (target->width == 1 && cell->width == 1) {
+        *target = *cell;
+    } else {
+        term_grid_set_cell(grid, row, col, cell->glyph, (int)strlen(cell->glyph),
+                           cell->attr, cell->width);
+    }
+    return col + cell->width;
+}
+
+/**
+ * Right-align ASCII text in a slot; too long shows as '#'s
+ */
+static int term_grid_put_slot(term_grid_t *grid, int row, int col, int width, uint16_t attr,
+                              const char *text, int length, char pad) {
+    if (!grid || row < 0 || row >= grid->rows || col < 0) return col;
+    if (col + width > grid->cols) width = grid->cols - col;
+    
+    for (int i = 0; i < width; i++) {
+        char ch;
+        if (length > width) ch = '#';
+        else if (i < width - length) ch = pad;
+        else ch = text[i - (width - length)];
+        term_grid_set_cell(grid, row, col + i, &ch, 1, attr, 1);
+    }
+    return col + width;
+}
+
+/**
+ * Equivalent of "%*.*f" for a fixed slot (decimals 0-4)
+ */
+int term_grid_put_fixed(term_grid_t *grid, int row, int col, int width, int decimals,
+                        uint16_t attr, float value) {
+    static const double scales[5] = { 1.0, 10.0, 100.0, 1000.0, 10000.0 };
+    char buffer[16];
+    char *p = buffer + sizeof(buffer);
+    
+    if (decimals < 0) decimals = 0;
+    if (decimals > 4) decimals = 4;
+    
+    /* Exact in double for any float, so rounding matches printf() */
+    double scaled = (double)value * scales[decimals];
+    bool negative = scaled < 0.0;
+    if (negative) scaled = -scaled;
+    if (!(scaled < 4.0e9)) {
+        /* Out of range or NaN */
+        return term_grid_put_slot(grid, row, col, width, attr, "", width + 1, ' ');
+    }
+    
+    uint32_t units = (uint32_t)scaled;
+    double fraction = scaled - units;
+    if (fraction > 0.5 || (fraction == 0.5 && (units & 1))) units++;
+    for (int i = 0; i < decimals; i++) {
+        *--p = (char)('0' + units % 10);
+        units /= 10;
+    }
+    if (decimals > 0) *--p = '.';
+    do {
+        *--p = (char)('0' + units % 10);
+        units /= 10;
+    } while (units);
+    if (negative) *--p = '-';
+    
+    return term_grid_put_slot(grid, row, col, width, attr, p, (int)(buffer + sizeof(buffer) - p), ' ');
+}
+
+int term_grid_put_uint(term_grid_t *grid, int row, int col, int width, uint16_t attr,
+                       unsigned value, bool zero_pad) {
+    char buffer[12];
+    char *p = buffer + sizeof(buffer);
+    
+    do {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    
+    return term_grid_put_slot(grid, row, col, width, attr, p, (int)(buffer + sizeof(buffer) - p),
+                              zero_pad ? '0' : ' ');
+}
+
+/**
+ * Output encoding helpers
+ */
+static char *term_emit_uint(char *p, unsigned value) {
+    char digits[10];
+    int count = 0;
+    
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    while (count) *p++ = digits[--count];
+    return p;
+}
+
+static char *term_emit_move(char *p, int row, int col) {
+    *p++ = '\033'; *p++ = '[';
+    p = term_emit_uint(p, (unsigned)row + 1);
+    *p++ = ';';
+    p = term_emit_uint(p, (unsigned)col + 1);
+    *p++ = 'H';
+    return p;
+}
+
+static char *term_emit_attr(char *p, uint16_t attr) {
+    int fg = attr & 0xF;
+    int bg = (attr >> 4) & 0xF;
+    
+    *p++ = '\033'; *p++ = '['; *p++ = '0';
+    if (attr & TERM_BOLD) { *p++ = ';'; *p++ = '1'; }
+    if (fg != TERM_DEFAULT) { *p++ = ';'; *p++ = '3'; *p++ = (char)('0' + fg); }
+    if (bg != TERM_DEFAULT) { *p++ = ';'; *p++ = '4'; *p++ = (char)('0' + bg); }
+    *p++ = 'm';
+    return p;
+}
+
+static int term_uint_digits(unsigned value) {
+    int digits = 1;
+    while (value >= 10) { value /= 10; digits++; }
+    return digits;
+}
+
+/**
+ * Encode the changes since the last frame into grid->out
+ *
+ * The front buffer is updated as if the output had been written; the
+ * cursor is parked below the grid with default attributes. Returns the
+ * number of bytes to send.
+ */
+size_t term_grid_render(term_grid_t *grid) {
+    if (!grid || !grid->out) return 0;
+    
+    uint64_t start_ns = term_now_ns();
+    char *p = grid->out;
+    int cursor_row = -1;
+    int cursor_col = -1;
+    int cursor_attr = -1;   /* Unknown: other output may have run since */
+    uint64_t changed = 0;
+    
+    if (grid->full_redraw) {
+        static const char clear[] = "\033[0m\033[H\033[2J";
+        memcpy(p, clear, sizeof(clear) - 1);
+        p += sizeof(clear) - 1;
+        for (int i = 0; i < grid->rows * grid->cols; i++) {
+            term_cell_blank(&grid->front[i], TERM_ATTR_NORMAL);
+        }
+        cursor_row = 0;
+        cursor_col = 0;
+        cursor_attr = TERM_ATTR_NORMAL;
+        grid->full_redraw = false;
+    }
+    
+    for (int row = 0; row < grid->rows; row++) {
+        term_cell_t *back = &grid->back[row * grid->cols];
+        term_cell_t *front = &grid->front[row * grid->cols];
+        if (memcmp(back, front, (size_t)grid->cols * sizeof(term_cell_t)) == 0) continue;
+        
+        for (int col = 0; col < grid->cols; col++) {
+            if (back[col].width == 0) continue;   /* Sent with its left half */
+            if (memcmp(&back[col], &front[col], sizeof(term_cell_t)) == 0) continue;
+            
+            if (cursor_row != row || cursor_col != col) {
+                bool moved = false;
+                if (cursor_row == row && cursor_col < col) {
+                    /* Re-sending a short unchanged run beats a cursor move */
+                    int gap = col - cursor_col;
+                    size_t gap_bytes = 0;
+                    bool resend = true;
+                    for (int c = cursor_col; c < col && resend; c++) {
+                        resend = back[c].width == 1 && back[c].attr == cursor_attr;
+                        gap_bytes += strlen(back[c].glyph);
+                    }
+                    if (resend && gap_bytes <= (size_t)(3 + term_uint_digits((unsigned)gap))) {
+                        for (int c = cursor_col; c < col; c++) {
+                            size_t length = strlen(back[c].glyph);
+                            memcpy(p, back[c].glyph, length);
+                            p += length;
+                        }
+                    } else {
+                        *p++ = '\033'; *p++ = '[';
+                        p = term_emit_uint(p, (unsigned)gap);
+                        *p++ = 'C';
+                    }
+                    moved = true;
+                }
+                if (!moved) {
+                    p = term_emit_move(p, row, col);
+                }
+            }
+            
+            if (back[col].attr != cursor_attr) {
+                p = term_emit_attr(p, back[col].attr);
+                cursor_attr = back[col].attr;
+            }
+            
+            size_t length = strlen(back[col].glyph);
+            memcpy(p, back[col].glyph, length);
+            p += length;
+            
+            front[col] = back[col];
+            if (back[col].width == 2 && col + 1 < grid->cols) {
+                front[col + 1] = back[col + 1];
+            }
+            cursor_row = row;
+            cursor_col = col + back[col].width;
+            changed++;
+        }
+    }
+    
+    if (p != grid->out) {
+        if (cursor_attr != TERM_ATTR_NORMAL) {
+            p = term_emit_attr(p, TERM_ATTR_NORMAL);
+        }
+        p = term_emit_move(p, grid->rows, 0);
+    }
+    
+    size_t bytes = (size_t)(p - grid->out);
+    grid->frames++;
+    grid->cells_changed += changed;
+    grid->render_time_ns += term_now_ns() - start_ns;
+    if (bytes > grid->max_frame_bytes) grid->max_frame_bytes = bytes;
+    return bytes;
+}
+
+/**
+ * Render and send the frame with a single write() (retried only if short)
+ *
+ * Returns the number of bytes written or -1 on error.
+ */
+ssize_t term_grid_flush(term_grid_t *grid, int fd) {
+    size_t bytes = term_grid_render(grid);
+    size_t sent = 0;
+    
+    while (sent < bytes) {
+        ssize_t result = write(fd, grid->out + sent, bytes - sent);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            term_grid_invalidate(grid);
+            return -1;
+        }
+        sent += (size_t)result;
+    }
+    
+    grid->bytes_written += sent;
+    return (ssize_t)sent;
+}
+
+void term_grid_print_statistics(const term_grid_t *grid) {
+    if (!grid || grid->frames == 0) return;
+    
+    printf("Terminal output: %llu frames, %.0f bytes/frame (max %zu), %.1f cells/frame, "
+           "%.1f us/frame encode\n",
+           (unsigned long long)grid->frames,
+           (double)grid->bytes_written / grid->frames,
+           grid->max_frame_bytes,
+           (double)grid->cells_changed / grid->frames,
+           (double)grid->render_time_ns / grid->frames / 1000.0);
+}
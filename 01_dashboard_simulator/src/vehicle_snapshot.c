@@ -0,0 +1,86 @@
+/**
+ * QNX Dashboard Simulator - Vehicle Snapshot Implementation
+ *
+ * Multi-slot seqlock: the single writer never reuses the slot readers are
+ * directed to, so a writer preempted mid-copy (e.g. the data thread at
+ * DATA_THREAD_PRIORITY under the GUI thread) cannot make a reader spin.
+ * A reader only retries if the writer completes a full lap of slots while
+ * that reader is copying.
+ */
+
+#include "../include/vehicle_snapshot.h"
+
+#define SNAPSHOT_SLOT_MASK (VEHICLE_SNAPSHOT_SLOTS - 1)
+
+#if (VEHICLE_SNAPSHOT_SLOTS & SNAPSHOT_SLOT_MASK) != 0
+#error "VEHICLE_SNAPSHOT_SLOTS must be a power of two"
+#endif
+
+/**
+ * Initialize snapshot with initial vehicle data
+ */
+void vehicle_snapshot_init(vehicle_snapshot_t *snap, const vehicle_data_t *initial) {
+    if (!snap) return;
+
+    memset(snap, 0, sizeof(vehicle_snapshot_t));
+    if (initial) {
+        snap->slots[0].data = *initial;
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * Publish new vehicle data (single writer only)
+ */
+void vehicle_snapshot_publish(vehicle_snapshot_t *snap, const vehicle_data_t *data) {
+    if (!snap || !data) return;
+
+    uint32_t next = __atomic_load_n(&snap->latest, __ATOMIC_RELAXED) + 1;
+    vehicle_snapshot_slot_t *slot = &snap->slots[next & SNAPSHOT_SLOT_MASK];
+    uint32_t seq = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+
+    /* Mark slot busy before any data store becomes visible */
+    __atomic_store_n(&slot->sequence, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&slot->data, data, sizeof(vehicle_data_t));
+
+    __atomic_store_n(&slot->sequence, seq + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&snap->latest, next, __ATOMIC_RELEASE);
+}
+
+/**
+ * Copy the latest published vehicle data
+ *
+ * Returns the number of retries needed (0 in the common case).
+ */
+uint32_t vehicle_snapshot_read(const vehicle_snapshot_t *snap, vehicle_data_t *out) {
+    if (!snap || !out) return 0;
+
+    uint32_t retries = 0;
+
+    for (;;) {
+        uint32_t latest = __atomic_load_n(&snap->latest, __ATOMIC_ACQUIRE);
+        const vehicle_snapshot_slot_t *slot = &snap->slots[latest & SNAPSHOT_SLOT_MASK];
+
+        uint32_t seq_begin = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        if ((seq_begin & 1u) == 0) {
+            memcpy(out, (const void *)&slot->data, sizeof(vehicle_data_t));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) == seq_begin) {
+                return retries;
+            }
+        }
+
+        /* Writer lapped us; 'latest' already points at a newer slot */
+        retries++;
+    }
+}
+
+/**
+ * Get publish counter (changes whenever new data is available)
+ */
+uint32_t vehicle_snapshot_version(const vehicle_snapshot_t *snap) {
+    return snap ? __atomic_load_n(&snap->latest, __ATOMIC_ACQUIRE) : 0;
+}
@@ -0,0 +1,677 @@
+/**
+ * QNX Dashboard Simulator - Widget Tree Implementation
+ *
+ * A layout is a flat array of nodes in pre-order: a group's descendants
+ * follow it directly, so walking the tree is a loop over the array and a
+ * subtree that lies outside the clip (or holds no damage) is skipped by
+ * jumping to its subtree_end. Bounds are the union of a node's box and its
+ * descendants' bounds.
+ *
+ * Each signal keeps a list of the nodes bound to it. An update compares
+ * the new vehicle data with the values last applied and visits only the
+ * subscribers of signals that changed; those nodes, and the ones still
+ * animating or blinking, form the active list that the GUI compares with
+ * the screen. Damage is recorded on the node, merging overlapping areas,
+ * and the node joins a dirty list, so collecting it touches only damaged
+ * nodes. A frame therefore costs in proportion to what changed, not to the
+ * number of widgets; drawing skips whole subtrees outside the clip.
+ *
+ * Layout files are read with the JSON reader the scenario compiler uses;
+ * unknown keys are skipped.
+ */
+
+#include <float.h>
+
+#include "../include/widget_tree.h"
+#include "../include/json_reader.h"
+#include "../include/signal_ring.h"
+
+/**
+ * Attributes of one node, collected before they are applied (keys may
+ * come in any order, children before the type or position)
+ */
+typedef struct {
+    widget_kind_t kind;
+    bool has_kind;
+    char id[WIDGET_ID_LENGTH];
+    char label[32];
+    int signal;
+    float x, y, width, height;
+    float min_value, max_value;
+    bool has_min, has_max;
+    float warning, critical;
+    float threshold;
+    bool below;
+    bool has_threshold;
+    bool blink;
+    bool panel;
+    warning_level_t level;
+    widget_format_t format;
+    int decimals;
+    char unit[WIDGET_UNIT_LENGTH];
+    float animation_speed;
+} layout_attributes_t;
+
+typedef struct {
+    json_reader_t json;
+    widget_tree_t *tree;
+} layout_parser_t;
+
+static const char *const g_widget_kind_names[WIDGET_KIND_COUNT] = {
+    "group", "dial", "bar", "readout", "light"
+};
+
+/**
+ * Initialize an empty tree
+ */
+int widget_tree_init(widget_tree_t *tree) {
+    if (!tree) return -1;
+
+    memset(tree, 0, sizeof(widget_tree_t));
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        tree->subscribers[signal] = -1;
+    }
+    return 0;
+}
+
+void widget_tree_free(widget_tree_t *tree) {
+    if (!tree) return;
+
+    free(tree->nodes);
+    free(tree->active);
+    free(tree->dirty);
+    widget_tree_init(tree);
+}
+
+/**
+ * Append a node; returns its index or -1
+ *
+ * Nodes must be added in pre-order: parent is -1 or a group on the path
+ * to the node added last. box is in design coordinates, which are also
+ * the screen's until widget_tree_fit() is called.
+ */
+int widget_tree_add(widget_tree_t *tree, int parent, widget_kind_t kind, framebuffer_rect_t box) {
+    if (!tree || (unsigned)kind >= WIDGET_KIND_COUNT || parent >= tree->count) return -1;
+    if (parent >= 0 && (tree->nodes[parent].kind != WIDGET_GROUP ||
+                        tree->nodes[parent].subtree_end != tree->count)) {
+        fprintf(stderr, "Widget tree: node %d is not an open group\n", parent);
+        return -1;
+    }
+
+    if (tree->count == tree->capacity) {
+        int capacity = tree->capacity ? tree->capacity * 2 : 32;
+        widget_node_t *nodes = realloc(tree->nodes, (size_t)capacity * sizeof(widget_node_t));
+        if (!nodes) return -1;
+        tree->nodes = nodes;
+        int *active = realloc(tree->active, (size_t)capacity * sizeof(int));
+        if (!active) return -1;
+        tree->active = active;
+        int *dirty = realloc(tree->dirty, (size_t)capacity * sizeof(int));
+        if (!dirty) return -1;
+        tree->dirty = dirty;
+        tree->capacity = capacity;
+    }
+
+    int index = tree->count++;
+    widget_node_t *node = &tree->nodes[index];
+    memset(node, 0, sizeof(widget_node_t));
+    node->kind = kind;
+    node->parent = parent;
+    node->subtree_end = index + 1;
+    node->box = box;
+    node->design_box = box;
+    node->bounds = box;
+    node->signal = -1;
+    node->next_subscriber = -1;
+
+    /* Every open ancestor now ends after this node */
+    for (int p = parent; p >= 0; p = tree->nodes[p].parent) {
+        tree->nodes[p].subtree_end = index + 1;
+    }
+    return index;
+}
+
+/**
+ * Smallest rectangle covering a and b; empty rectangles are ignored
+ */
+framebuffer_rect_t widget_rect_union(framebuffer_rect_t a, framebuffer_rect_t b) {
+    if (a.width <= 0 || a.height <= 0) return b;
+    if (b.width <= 0 || b.height <= 0) return a;
+
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+    int y1 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+    return (framebuffer_rect_t){x0, y0, x1 - x0, y1 - y0};
+}
+
+bool widget_rect_intersects(framebuffer_rect_t a, framebuffer_rect_t b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+/**
+ * Recompute bounds and subscriptions and copy boxes into the widgets
+ *
+ * Call after building, loading or scaling; clears all damage and marks
+ * every signal as changed, so the next update applies them all.
+ */
+void widget_tree_finalize(widget_tree_t *tree) {
+    if (!tree) return;
+
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        tree->subscribers[signal] = -1;
+    }
+
+    for (int i = 0; i < tree->count; i++) {
+        widget_node_t *node = &tree->nodes[i];
+        PhPoint_t position = {node->box.x, node->box.y};
+        PhDim_t size = {node->box.width, node->box.height};
+
+        if (node->kind == WIDGET_LIGHT) {
+            node->data.light.position = position;
+            node->data.light.size = size;
+        } else if (node->kind != WIDGET_GROUP) {
+            node->data.gauge.position = position;
+            node->data.gauge.size = size;
+        }
+        node->bounds = node->box;
+        node->active = false;
+        node->dirty = false;
+        node->damage_count = 0;
+    }
+
+    /* Children come after their parent, so a reverse pass sees them first */
+    for (int i = tree->count - 1; i >= 0; i--) {
+        widget_node_t *node = &tree->nodes[i];
+        if (node->parent >= 0) {
+            widget_node_t *parent = &tree->nodes[node->parent];
+            parent->bounds = widget_rect_union(parent->bounds, node->bounds);
+        }
+        /* Prepending in reverse keeps each list in layout order */
+        if (node->signal >= 0 && node->signal < SIGNAL_COUNT) {
+            node->next_subscriber = tree->subscribers[node->signal];
+            tree->subscribers[node->signal] = i;
+        } else {
+            node->signal = -1;
+            node->next_subscriber = -1;
+        }
+    }
+
+    tree->active_count = 0;
+    tree->dirty_count = 0;
+    tree->signals_valid = false;
+}
+
+/**
+ * Lay the design boxes out on a width x height screen
+ *
+ * Positions scale with each axis and sizes with the smaller of the two,
+ * always from the design size, so repeated fits do not compound. A tree
+ * without a design size keeps its boxes as they are.
+ */
+void widget_tree_fit(widget_tree_t *tree, int width, int height) {
+    if (!tree) return;
+
+    float sx = 1.0f, sy = 1.0f;
+    if (tree->design_width > 0 && tree->design_height > 0 && width > 0 && height > 0) {
+        sx = (float)width / tree->design_width;
+        sy = (float)height / tree->design_height;
+    }
+    float size_scale = sx < sy ? sx : sy;
+
+    for (int i = 0; i < tree->count; i++) {
+        const framebuffer_rect_t *design = &tree->nodes[i].design_box;
+        tree->nodes[i].box = (framebuffer_rect_t){(int)lroundf(design->x * sx), (int)lroundf(design->y * sy),
+                                                  (int)lroundf(design->width * size_scale),
+                                                  (int)lroundf(design->height * size_scale)};
+    }
+    widget_tree_finalize(tree);
+}
+
+/**
+ * Queue a node for the next damage pass
+ */
+void widget_tree_activate(widget_tree_t *tree, int index) {
+    if (!tree || index < 0 || index >= tree->count || tree->nodes[index].active) return;
+
+    tree->nodes[index].active = true;
+    tree->active[tree->active_count++] = index;
+}
+
+/**
+ * Signal values of vehicle data, in signal_id_t order
+ */
+static void widget_signal_values(const vehicle_data_t *data, float values[SIGNAL_COUNT]) {
+    values[SIGNAL_SPEED_KMH] = data->speed_kmh;
+    values[SIGNAL_RPM] = data->rpm;
+    values[SIGNAL_ACCELERATION] = data->acceleration;
+    values[SIGNAL_FUEL_LEVEL] = data->fuel_level;
+    values[SIGNAL_ENGINE_TEMP] = data->engine_temp;
+    values[SIGNAL_OIL_PRESSURE] = data->oil_pressure;
+    values[SIGNAL_BATTERY_VOLTAGE] = data->battery_voltage;
+    values[SIGNAL_ALTERNATOR_CURRENT] = data->alternator_current;
+    values[SIGNAL_GEAR_POSITION] = (float)data->gear_position;
+    values[SIGNAL_IGNITION_ON] = data->ignition_on ? 1.0f : 0.0f;
+    values[SIGNAL_ENGINE_RUNNING] = data->engine_running ? 1.0f : 0.0f;
+    values[SIGNAL_PARKING_BRAKE] = data->parking_brake ? 1.0f : 0.0f;
+    values[SIGNAL_SEATBELT_FASTENED] = data->seatbelt_fastened ? 1.0f : 0.0f;
+}
+
+/**
+ * Apply new vehicle data to the nodes bound to changed signals
+ *
+ * Gauges get a new target and lights a new state; every touched node is
+ * activated. Returns the number of signals that changed.
+ */
+int widget_tree_update(widget_tree_t *tree, const vehicle_data_t *data) {
+    if (!tree || !data) return 0;
+
+    float values[SIGNAL_COUNT];
+    widget_signal_values(data, values);
+
+    int changed = 0;
+    for (int signal = 0; signal < SIGNAL_COUNT; signal++) {
+        float value = values[signal];
+        if (tree->signals_valid && value == tree->signal_values[signal]) continue;
+        tree->signal_values[signal] = value;
+        changed++;
+
+        for (int i = tree->subscribers[signal]; i >= 0; i = tree->nodes[i].next_subscriber) {
+            widget_node_t *node = &tree->nodes[i];
+
+            if (node->kind == WIDGET_LIGHT) {
+                bool lit = node->below ? value < node->threshold : value > node->threshold;
+                node->data.light.active = lit;
+                node->data.light.blinking = lit && node->blink;
+            } else if (node->kind == WIDGET_READOUT) {
+                node->data.gauge.target_value = value;
+            } else if (node->kind != WIDGET_GROUP) {
+                node->data.gauge.target_value = clamp(value, node->data.gauge.min_value,
+                                                      node->data.gauge.max_value);
+            }
+            widget_tree_activate(tree, i);
+        }
+    }
+
+    tree->signals_valid = true;
+    tree->updates++;
+    tree->signals_changed += (uint64_t)changed;
+    return changed;
+}
+
+/**
+ * Record a damaged area of a node
+ */
+void widget_tree_mark_dirty(widget_tree_t *tree, int index, framebuffer_rect_t rect) {
+    if (!tree || index < 0 || index >= tree->count || rect.width <= 0 || rect.height <= 0) return;
+
+    widget_node_t *node = &tree->nodes[index];
+    int i;
+    for (i = 0; i < node->damage_count; i++) {
+        if (widget_rect_intersects(node->damage[i], rect)) break;
+    }
+    if (i == WIDGET_NODE_DAMAGE_RECTS) i--;
+    if (i < node->damage_count) {
+        node->damage[i] = widget_rect_union(node->damage[i], rect);
+    } else {
+        node->damage[node->damage_count++] = rect;
+    }
+
+    if (!node->dirty) {
+        node->dirty = true;
+        tree->dirty[tree->dirty_count++] = index;
+    }
+}
+
+/**
+ * Hand every recorded damage area to emit and empty the dirty list
+ *
+ * emit may be NULL to drop the damage.
+ */
+void widget_tree_collect_damage(widget_tree_t *tree, widget_damage_fn_t emit, void *context) {
+    if (!tree) return;
+
+    for (int i = 0; i < tree->dirty_count; i++) {
+        widget_node_t *node = &tree->nodes[tree->dirty[i]];
+        for (int r = 0; r < node->damage_count; r++) {
+            if (emit) emit(context, node->damage[r]);
+        }
+        node->dirty = false;
+        node->damage_count = 0;
+    }
+    tree->nodes_damaged += (uint64_t)tree->dirty_count;
+    tree->dirty_count = 0;
+}
+
+/**
+ * Layout parsing
+ */
+
+/**
+ * Turn collected attributes into the node's widget state
+ */
+static bool layout_apply(layout_parser_t *parser, int index, const layout_attributes_t *attributes) {
+    widget_node_t *node = &parser->tree->nodes[index];
+
+    if (!attributes->has_kind) return json_reader_fail(&parser->json, "widget without a type");
+    if (attributes->kind != WIDGET_GROUP && (attributes->width <= 0.0f || attributes->height <= 0.0f)) {
+        return json_reader_fail(&parser->json, "widget needs a positive width and height");
+    }
+
+    node->kind = attributes->kind;
+    memcpy(node->id, attributes->id, sizeof(node->id));
+    node->box = (framebuffer_rect_t){(int)lroundf(attributes->x), (int)lroundf(attributes->y),
+                                     (int)lroundf(attributes->width), (int)lroundf(attributes->height)};
+    node->panel = attributes->panel && node->kind == WIDGET_GROUP;
+    node->signal = attributes->signal;
+    node->threshold = attributes->threshold;
+    node->below = attributes->below;
+    node->blink = attributes->blink;
+    node->format = attributes->format;
+    node->decimals = attributes->decimals;
+    memcpy(node->unit, attributes->unit, sizeof(node->unit));
+
+    if (node->kind == WIDGET_LIGHT) {
+        warning_light_t *light = &node->data.light;
+        memcpy(light->label, attributes->label, sizeof(light->label));
+        light->level = attributes->level;
+        light->blink_interval_ms = 500;
+        light->blink_state = true;
+        if (node->signal >= 0 && !attributes->has_threshold) {
+            return json_reader_fail(&parser->json, "bound light needs \"above\" or \"below\"");
+        }
+        return true;
+    }
+
+    gauge_widget_t *gauge = &node->data.gauge;
+    memcpy(gauge->label, attributes->label, sizeof(gauge->label));
+    gauge->min_value = attributes->has_min ? attributes->min_value : 0.0f;
+    gauge->max_value = attributes->has_max ? attributes->max_value :
+                       (node->kind == WIDGET_READOUT ? FLT_MAX : 100.0f);
+    if (node->kind != WIDGET_GROUP && gauge->max_value <= gauge->min_value) {
+        return json_reader_fail(&parser->json, "max must be above min");
+    }
+    gauge->warning_threshold = attributes->warning;
+    gauge->critical_threshold = attributes->critical;
+    gauge->animation_speed = attributes->animation_speed;
+    gauge->current_value = node->kind == WIDGET_READOUT ? 0.0f : gauge->min_value;
+    gauge->target_value = gauge->current_value;
+    gauge->visible = true;
+    gauge->enabled = true;
+    return true;
+}
+
+static bool parser_widgets(layout_parser_t *parser, int parent, int depth);
+
+/* One widget object, children included */
+static bool parser_widget(layout_parser_t *parser, int parent, int depth) {
+    if (parser->tree->count >= LAYOUT_MAX_NODES) return json_reader_fail(&parser->json, "too many widgets");
+
+    /* Added first so children follow it; the real box comes in layout_apply() */
+    int index = widget_tree_add(parser->tree, parent, WIDGET_GROUP, (framebuffer_rect_t){0, 0, 0, 0});
+    if (index < 0) return json_reader_fail(&parser->json, "out of memory");
+
+    layout_attributes_t attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.signal = -1;
+    attributes.level = WARNING_MEDIUM;
+    attributes.animation_speed = 1.0f;
+
+    if (!json_reader_expect(&parser->json, '{')) return false;
+    if (json_reader_accept(&parser->json, '}')) return json_reader_fail(&parser->json, "widget without a type");
+
+    do {
+        const char *key;
+        size_t length;
+        if (!json_reader_string(&parser->json, &key, &length) || !json_reader_expect(&parser->json, ':')) return false;
+
+        bool ok = true;
+        if (json_key_is(key, length, "type")) {
+            const char *name;
+            size_t name_length;
+            ok = json_reader_string(&parser->json, &name, &name_length);
+            attributes.has_kind = false;
+            for (int kind = 0; ok && kind < WIDGET_KIND_COUNT; kind++) {
+                if (json_key_is(name, name_length, g_widget_kind_names[kind])) {
+                    attributes.kind = (widget_kind_t)kind;
+                    attributes.has_kind = true;
+                }
+            }
+            if (ok && !attributes.has_kind) return json_reader_fail(&parser->json, "unknown widget type");
+        } else if (json_key_is(key, length, "id")) {
+            ok = json_reader_string_copy(&parser->json, attributes.id, sizeof(attributes.id));
+        } else if (json_key_is(key, length, "label")) {
+            ok = json_reader_string_copy(&parser->json, attributes.label, sizeof(attributes.label));
+        } else if (json_key_is(key, length, "unit")) {
+            ok = json_reader_string_copy(&parser->json, attributes.unit, sizeof(attributes.unit));
+        } else if (json_key_is(key, length, "signal")) {
+            const char *name;
+            size_t name_length;
+            ok = json_reader_string(&parser->json, &name, &name_length);
+            if (ok && (attributes.signal = signal_id_from_string(name, name_length)) < 0) {
+                return json_reader_fail(&parser->json, "unknown signal");
+            }
+        } else if (json_key_is(key, length, "format")) {
+            const char *name;
+            size_t name_length;
+            ok = json_reader_string(&parser->json, &name, &name_length);
+            if (ok && json_key_is(name, name_length, "gear")) {
+                attributes.format = WIDGET_FORMAT_GEAR;
+            } else if (ok && json_key_is(name, name_length, "number")) {
+                attributes.format = WIDGET_FORMAT_NUMBER;
+            } else if (ok) {
+                return json_reader_fail(&parser->json, "unknown format");
+            }
+        } else if (json_key_is(key, length, "level")) {
+            const char *name;
+            size_t name_length;
+            ok = json_reader_string(&parser->json, &name, &name_length);
+            if (ok && json_key_is(name, name_length, "info")) {
+                attributes.level = WARNING_LOW;
+            } else if (ok && json_key_is(name, name_length, "warning")) {
+                attributes.level = WARNING_MEDIUM;
+            } else if (ok && json_key_is(name, name_length, "critical")) {
+                attributes.level = WARNING_CRITICAL;
+            } else if (ok) {
+                return json_reader_fail(&parser->json, "unknown level");
+            }
+        } else if (json_key_is(key, length, "x")) {
+            ok = json_reader_number(&parser->json, &attributes.x);
+        } else if (json_key_is(key, length, "y")) {
+            ok = json_reader_number(&parser->json, &attributes.y);
+        } else if (json_key_is(key, length, "width")) {
+            ok = json_reader_number(&parser->json, &attributes.width);
+        } else if (json_key_is(key, length, "height")) {
+            ok = json_reader_number(&parser->json, &attributes.height);
+        } else if (json_key_is(key, length, "size")) {
+            ok = json_reader_number(&parser->json, &attributes.width);
+            attributes.height = attributes.width;
+        } else if (json_key_is(key, length, "min")) {
+            ok = json_reader_number(&parser->json, &attributes.min_value);
+            attributes.has_min = true;
+        } else if (json_key_is(key, length, "max")) {
+            ok = json_reader_number(&parser->json, &attributes.max_value);
+            attributes.has_max = true;
+        } else if (json_key_is(key, length, "warning")) {
+            ok = json_reader_number(&parser->json, &attributes.warning);
+        } else if (json_key_is(key, length, "critical")) {
+            ok = json_reader_number(&parser->json, &attributes.critical);
+        } else if (json_key_is(key, length, "above") || json_key_is(key, length, "below")) {
+            ok = json_reader_number(&parser->json, &attributes.threshold);
+            attributes.below = key[0] == 'b';
+            attributes.has_threshold = true;
+        } else if (json_key_is(key, length, "blink")) {
+            ok = json_reader_bool(&parser->json, &attributes.blink);
+        } else if (json_key_is(key, length, "panel")) {
+            ok = json_reader_bool(&parser->json, &attributes.panel);
+        } else if (json_key_is(key, length, "decimals")) {
+            float decimals;
+            ok = json_reader_number(&parser->json, &decimals);
+            attributes.decimals = (int)clamp(decimals, 0.0f, 6.0f);
+        } else if (json_key_is(key, length, "animation_speed")) {
+            ok = json_reader_number(&parser->json, &attributes.animation_speed);
+            if (ok && attributes.animation_speed <= 0.0f) {
+                return json_reader_fail(&parser->json, "animation_speed must be positive");
+            }
+        } else if (json_key_is(key, length, "children")) {
+            if (depth + 1 >= LAYOUT_MAX_DEPTH) return json_reader_fail(&parser->json, "groups nested too deep");
+            ok = parser_widgets(parser, index, depth + 1);
+        } else {
+            ok = json_reader_skip_value(&parser->json, 0);
+        }
+        if (!ok) return false;
+    } while (json_reader_accept(&parser->json, ','));
+
+    if (!json_reader_expect(&parser->json, '}')) return false;
+    if (parser->tree->nodes[index].subtree_end > index + 1 && attributes.kind != WIDGET_GROUP) {
+        return json_reader_fail(&parser->json, "only groups have children");
+    }
+    return layout_apply(parser, index, &attributes);
+}
+
+/* [widget, widget, ...] */
+static bool parser_widgets(layout_parser_t *parser, int parent, int depth) {
+    if (!json_reader_expect(&parser->json, '[')) return false;
+    if (json_reader_accept(&parser->json, ']')) return true;
+
+    do {
+        if (!parser_widget(parser, parent, depth)) return false;
+    } while (json_reader_accept(&parser->json, ','));
+
+    return json_reader_expect(&parser->json, ']');
+}
+
+static bool parser_document(layout_parser_t *parser) {
+    widget_tree_t *tree = parser->tree;
+
+    if (!json_reader_expect(&parser->json, '{')) return false;
+    if (json_reader_accept(&parser->json, '}')) return true;
+
+    do {
+        const char *key;
+        size_t length;
+        if (!json_reader_string(&parser->json, &key, &length) || !json_reader_expect(&parser->json, ':')) return false;
+
+        bool ok = true;
+        if (json_key_is(key, length, "name")) {
+            ok = json_reader_string_copy(&parser->json, tree->name, sizeof(tree->name));
+        } else if (json_key_is(key, length, "width") || json_key_is(key, length, "height")) {
+            float value;
+            ok = json_reader_number(&parser->json, &value);
+            if (ok && value < 0.0f) return json_reader_fail(&parser->json, "negative screen size");
+            *(key[0] == 'w' ? &tree->design_width : &tree->design_height) = (int)value;
+        } else if (json_key_is(key, length, "widgets")) {
+            if (tree->count > 0) return json_reader_fail(&parser->json, "duplicate widgets");
+            ok = parser_widgets(parser, -1, 0);
+        } else {
+            ok = json_reader_skip_value(&parser->json, 0);
+        }
+        if (!ok) return false;
+    } while (json_reader_accept(&parser->json, ','));
+
+    if (!json_reader_expect(&parser->json, '}')) return false;
+    return json_reader_finish(&parser->json);
+}
+
+/**
+ * Parse a layout held in memory into an initialized tree
+ */
+int widget_tree_parse(widget_tree_t *tree, const char *json, size_t length) {
+    if (!tree || !json) return -1;
+
+    widget_tree_free(tree);
+
+    layout_parser_t parser;
+    memset(&parser, 0, sizeof(parser));
+    json_reader_init(&parser.json, json, length);
+    parser.tree = tree;
+
+    bool ok = parser_document(&parser);
+    if (ok && tree->count == 0) {
+        snprintf(parser.json.error, sizeof(parser.json.error), "no widgets");
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "Layout: %s\n", parser.json.error);
+        widget_tree_free(tree);
+        return -1;
+    }
+
+    /* Children were positioned relative to their group; parents come first */
+    for (int i = 0; i < tree->count; i++) {
+        widget_node_t *node = &tree->nodes[i];
+        if (node->parent >= 0) {
+            node->box.x += tree->nodes[node->parent].box.x;
+            node->box.y += tree->nodes[node->parent].box.y;
+        }
+        node->design_box = node->box;
+    }
+    widget_tree_finalize(tree);
+    return 0;
+}
+
+/**
+ * Read and parse a layout file
+ */
+int widget_tree_load(widget_tree_t *tree, const char *filename) {
+    if (!tree || !filename) return -1;
+
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        fprintf(stderr, "Layout: cannot open %s: %s\n", filename, strerror(errno));
+        return -1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0 || size > LAYOUT_MAX_FILE_BYTES) {
+        fprintf(stderr, "Layout: %s has an unsupported size\n", filename);
+        fclose(file);
+        return -1;
+    }
+
+    /* NUL-terminated so strtod() cannot run off the end */
+    char *json = malloc((size_t)size + 1);
+    if (!json) {
+        fclose(file);
+        return -1;
+    }
+    size_t read_bytes = fread(json, 1, (size_t)size, file);
+    fclose(file);
+    json[read_bytes] = '\0';
+
+    int result = widget_tree_parse(tree, json, read_bytes);
+    free(json);
+
+    if (result == 0) {
+        printf("Loaded layout '%s' from %s: %d widgets\n",
+               tree->name[0] ? tree->name : "unnamed", filename, tree->count);
+    }
+    return result;
+}
+
+/**
+ * Utility functions
+ */
+const char *widget_kind_to_string(widget_kind_t kind) {
+    return (unsigned)kind < WIDGET_KIND_COUNT ? g_widget_kind_names[kind] : "unknown";
+}
+
+void widget_tree_print_statistics(const widget_tree_t *tree) {
+    if (!tree || tree->updates == 0) return;
+
+    int bound = 0;
+    for (int i = 0; i < tree->count; i++) {
+        if (tree->nodes[i].signal >= 0) bound++;
+    }
+
+    double updates = (double)tree->updates;
+    printf("=== Widget Tree ===\n");
+    printf("Layout: %s, %d nodes (%d bound to signals)\n",
+           tree->name[0] ? tree->name : "built-in", tree->count, bound);
+    printf("Per update: %.2f signals changed, %.2f nodes refreshed, %.2f damaged\n",
+           tree->signals_changed / updates, tree->nodes_refreshed / updates,
+           tree->nodes_damaged / updates);
+}